@@ -0,0 +1,288 @@
+#include "Benchmark.h"
+#include "FrameCapture.h"
+#include "FrameClock.h"
+#include "FrameStats.h"
+#include <cassert>
+#include <stdio.h>
+#include <stdlib.h>
+
+static CRITICAL_SECTION     g_summaryLock;
+
+// frames are dropped before the queue is completely full, so the begin and end markers always fit
+static const int            g_reservedItems = 2;
+
+static const char*          g_summaryHeader = "run,label,frames,duration_s,avg_fps,avg_ms,p50_ms,p99_ms,p999_ms,"
+                                              "low1_fps,low01_fps,stutters,present_blocked_pct,avg_fps_vs_run1_pct\r\n";
+
+BenchmarkController::BenchmarkController()
+{
+    InitializeCriticalSection(&g_summaryLock);
+    m_state = bs_idle;
+    memset(&m_request, 0, sizeof(m_request));
+    m_tickFrequency = 0;
+    m_startTick = 0;
+    m_firstFrameTick = 0;
+    m_frameCount = 0;
+    m_dropped = 0;
+    m_pJob = nullptr;
+    m_hStopEvent = NULL;
+    m_hThread = NULL;
+}
+
+bool BenchmarkController::arm(const BenchmarkRequest& req, const char* szLabel, const char* szCapturePath)
+{
+    assert(szLabel && szCapturePath);
+    if(m_state != bs_idle || FrameCapture::instance().isActive() || req.length <= 0 || req.delaySec < 0 ||
+        req.length > (req.byFrames ? BENCHMARK_FRAMES_MAX : BENCHMARK_SECONDS_MAX) || req.delaySec > BENCHMARK_DELAY_MAX)
+        return false;
+    m_request = req;
+    m_label = szLabel;
+    m_captureDir = szCapturePath;
+    size_t slash = m_captureDir.find_last_of("\\/");
+    m_captureDir.erase(slash == std::string::npos ? 0 : slash + 1);
+    // not in the constructor, DllMain may be the first to reach instance() and must not calibrate the clock
+    m_tickFrequency = FrameClock::instance().frequency();
+    m_startTick = FrameClock::instance().now() + (uint64_t)req.delaySec * m_tickFrequency;
+    if(!m_hThread) {
+        m_hStopEvent = CreateEventA(NULL, TRUE, FALSE, NULL);
+        m_hThread = CreateThread(NULL, 0, collectProc, this, 0, NULL);
+        if(!m_hThread)
+            return false;
+    }
+    m_state = bs_armed;
+    return true;
+}
+
+void BenchmarkController::cancel()
+{
+    if(m_state == bs_recording) {
+        FrameCapture::instance().stop();
+        push(ik_cancel, nullptr, 0);
+    }
+    m_state = bs_idle;
+}
+
+void BenchmarkController::shutdown()
+{
+    // called from DllMain, so signal only and never wait on the thread
+    if(m_hStopEvent)
+        SetEvent(m_hStopEvent);
+}
+
+// render thread; a marker always fits because frames stop g_reservedItems short of a full queue
+void BenchmarkController::push(ItemKind kind, ReportJob* pJob, uint64_t dropped)
+{
+    Item item;
+    memset(&item, 0, sizeof(item));
+    item.kind = kind;
+    item.pJob = pJob;
+    item.dropped = dropped;
+    bool pushed = m_queue.push(item);
+    assert(pushed);
+    (void)pushed;
+}
+
+bool BenchmarkController::onFrame(const FrameRecord& rec)
+{
+    if(m_state == bs_idle)
+        return false;
+    if(m_state == bs_armed) {
+        if((int64_t)(rec.presentStart - m_startTick) < 0)
+            return false;
+        if(!begin()) {
+            m_state = bs_idle;
+            return false;
+        }
+    }
+    if(!m_request.byFrames && m_frameCount > 0) {
+        uint64_t window = (uint64_t)m_request.length * m_tickFrequency;
+        if(rec.presentStart - m_firstFrameTick > window) {
+            finish();
+            return false;
+        }
+    }
+    FrameCapture::instance().record(rec);
+    if(m_frameCount == 0)
+        m_firstFrameTick = rec.presentStart;
+    m_frameCount ++;
+    if(m_queue.size() >= queue_size - g_reservedItems) {
+        m_dropped ++;
+    }
+    else {
+        Item item;
+        item.kind = ik_frame;
+        item.frame = rec;
+        item.pJob = nullptr;
+        item.dropped = 0;
+        m_queue.push(item);
+    }
+    // N frame times need N + 1 presents
+    if(m_request.byFrames && m_frameCount >= (uint64_t)m_request.length + 1)
+        finish();
+    return true;
+}
+
+bool BenchmarkController::begin()
+{
+    SYSTEMTIME st;
+    GetLocalTime(&st);
+    char name[MAX_PATH];
+    _snprintf(name, sizeof(name), "bench_%04d%02d%02d_%02d%02d%02d", st.wYear, st.wMonth, st.wDay, st.wHour, st.wMinute, st.wSecond);
+    name[sizeof(name) - 1] = 0;
+    m_capturePath = m_captureDir + name;
+    if(!m_label.empty()) {
+        m_capturePath += "_";
+        for(size_t i = 0; i < m_label.size(); i ++) {
+            char c = m_label[i];
+            bool safe = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '-';
+            m_capturePath += safe ? c : '_';
+        }
+    }
+    m_capturePath += ".ftc";
+    // the previous run's frames may still be queued, the begin marker goes in after them
+    if(m_queue.size() >= queue_size - g_reservedItems || !FrameCapture::instance().start(m_capturePath.c_str()))
+        return false;
+    ReportJob* pJob = new ReportJob;
+    pJob->tickFrequency = m_tickFrequency;
+    pJob->capturePath = m_capturePath;
+    pJob->label = m_label;
+    pJob->dropped = 0;
+    push(ik_begin, pJob, 0);
+    m_frameCount = 0;
+    m_dropped = 0;
+    m_state = bs_recording;
+    return true;
+}
+
+void BenchmarkController::finish()
+{
+    FrameCapture::instance().stop();
+    push(ik_end, nullptr, m_dropped);
+    m_state = bs_idle;
+}
+
+// collector thread; the frame vector only grows here, the report is written here too
+void BenchmarkController::drain()
+{
+    Item item;
+    while(m_queue.pop(item)) {
+        switch(item.kind)
+        {
+        case ik_begin:
+            delete m_pJob;
+            m_pJob = item.pJob;
+            break;
+        case ik_frame:
+            if(m_pJob)
+                m_pJob->frames.push_back(item.frame);
+            break;
+        case ik_end:
+            if(m_pJob) {
+                m_pJob->dropped = item.dropped;
+                writeReport(*m_pJob);
+            }
+            // fall through
+        case ik_cancel:
+            delete m_pJob;
+            m_pJob = nullptr;
+            break;
+        }
+    }
+}
+
+DWORD __stdcall BenchmarkController::collectProc(LPVOID lpParam)
+{
+    BenchmarkController* pThis = (BenchmarkController*)lpParam;
+    while(WaitForSingleObject(pThis->m_hStopEvent, 10) == WAIT_TIMEOUT)
+        pThis->drain();
+    return 0;
+}
+
+// returns the value of the given csv column in the first data row, 0 if there is none
+static double readFirstRunColumn(const std::string& table, int column)
+{
+    size_t pos = table.find('\n');
+    if(pos == std::string::npos)
+        return 0.0;
+    pos ++;
+    for(int i = 0; i < column && pos != std::string::npos; i ++) {
+        pos = table.find(',', pos);
+        if(pos != std::string::npos)
+            pos ++;
+    }
+    return pos == std::string::npos ? 0.0 : atof(table.c_str() + pos);
+}
+
+void BenchmarkController::writeReport(const ReportJob& job)
+{
+    FrameStatsSummary s;
+    if(!computeFrameStats(job.frames.empty() ? nullptr : &job.frames.front(), job.frames.size(), job.tickFrequency, s))
+        return;
+
+    std::string reportPath = job.capturePath;
+    size_t dot = reportPath.find_last_of('.');
+    if(dot != std::string::npos)
+        reportPath.erase(dot);
+    reportPath += ".report.txt";
+    FILE* f = fopen(reportPath.c_str(), "wb");
+    if(f) {
+        fprintf(f, "benchmark        %s\r\n", job.label.c_str());
+        fprintf(f, "capture          %s\r\n", job.capturePath.c_str());
+        fprintf(f, "frames           %llu\r\n", (unsigned long long)s.frames);
+        fprintf(f, "duration         %.3f s\r\n", s.durationSec);
+        fprintf(f, "avg fps          %.2f\r\n", s.avgFps);
+        fprintf(f, "avg frame time   %.3f ms\r\n", s.avgMs);
+        fprintf(f, "p50 / p90 / p95  %.3f / %.3f / %.3f ms\r\n", s.p50Ms, s.p90Ms, s.p95Ms);
+        fprintf(f, "p99 / p99.9      %.3f / %.3f ms\r\n", s.p99Ms, s.p999Ms);
+        fprintf(f, "max frame time   %.3f ms\r\n", s.maxMs);
+        fprintf(f, "1%% / 0.1%% low    %.2f / %.2f fps\r\n", s.low1Fps, s.low01Fps);
+        fprintf(f, "stutters         %llu (> %.1fx avg frame time)\r\n", (unsigned long long)s.stutterCount, g_stutterFactor);
+        fprintf(f, "present blocked  %.2f %%\r\n", s.presentBlockedShare * 100.0);
+        fprintf(f, "display dropped  %llu (%llu frames without statistics)\r\n", (unsigned long long)s.displayDropped,
+            (unsigned long long)s.displayUnknown);
+        if(job.dropped)
+            fprintf(f, "not collected    %llu frames, the report covers the others\r\n", (unsigned long long)job.dropped);
+        fclose(f);
+    }
+
+    std::string dir = job.capturePath;
+    size_t slash = dir.find_last_of("\\/");
+    dir.erase(slash == std::string::npos ? 0 : slash + 1);
+    std::string summaryPath = dir + "benchmark_summary.csv";
+
+    EnterCriticalSection(&g_summaryLock);
+    std::string table;
+    f = fopen(summaryPath.c_str(), "rb");
+    if(f) {
+        char buf[4096];
+        size_t n;
+        while((n = fread(buf, 1, sizeof(buf), f)) > 0)
+            table.append(buf, n);
+        fclose(f);
+    }
+    // header plus one line per earlier run, each terminated by a newline
+    int run = 1;
+    for(size_t i = 0; i < table.size(); i ++) {
+        if(table[i] == '\n')
+            run ++;
+    }
+    if(!table.empty())
+        run --;
+    double baseFps = table.empty() ? s.avgFps : readFirstRunColumn(table, 4);
+    double delta = baseFps > 0.0 ? (s.avgFps / baseFps - 1.0) * 100.0 : 0.0;
+    f = fopen(summaryPath.c_str(), "ab");
+    if(f) {
+        if(table.empty())
+            fputs(g_summaryHeader, f);
+        std::string label = job.label;
+        for(size_t i = 0; i < label.size(); i ++) {
+            if(label[i] == ',' || label[i] == '"')
+                label[i] = ' ';
+        }
+        fprintf(f, "%d,%s,%llu,%.3f,%.2f,%.3f,%.3f,%.3f,%.3f,%.2f,%.2f,%llu,%.2f,%+.2f\r\n",
+            run, label.c_str(), (unsigned long long)s.frames, s.durationSec, s.avgFps, s.avgMs, s.p50Ms, s.p99Ms, s.p999Ms,
+            s.low1Fps, s.low01Fps, (unsigned long long)s.stutterCount, s.presentBlockedShare * 100.0, delta);
+        fclose(f);
+    }
+    LeaveCriticalSection(&g_summaryLock);
+}
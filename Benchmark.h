@@ -0,0 +1,97 @@
+#pragma once
+
+#include <Windows.h>
+#include <string>
+#include <vector>
+#include "CaptureFormat.h"
+#include "ControlProtocol.h"
+#include "SpscQueue.h"
+
+/*
+ * Scripted benchmark runs. A run is armed by the control channel or by the
+ * benchmark_auto config key, opens its capture window after the requested
+ * delay and records exactly N seconds or N frames through the Present hook.
+ * The raw capture is written by FrameCapture. The render thread pushes the
+ * window's frames into a fixed-size queue, as FrameCapture does, and a
+ * collector thread keeps them; once the window closes it writes a summary
+ * report next to the capture and appends a row to benchmark_summary.csv in
+ * the same directory, so repeated runs form a comparison table.
+ */
+class BenchmarkController
+{
+public:
+    static BenchmarkController& instance()
+    {
+        static BenchmarkController inst;
+        return inst;
+    }
+    // render thread only
+    bool arm(const BenchmarkRequest& req, const char* szLabel, const char* szCapturePath);
+    void cancel();
+    bool isBusy() const { return m_state != bs_idle; }
+    // returns true when the frame belongs to a benchmark window and was captured
+    bool onFrame(const FrameRecord& rec);
+    void shutdown();
+
+private:
+    BenchmarkController();
+    BenchmarkController(const BenchmarkController&);
+
+    enum { queue_size = 8192 };
+
+    enum State
+    {
+        bs_idle,
+        bs_armed,
+        bs_recording,
+    };
+
+    struct ReportJob
+    {
+        std::vector<FrameRecord>    frames;
+        uint64_t                    tickFrequency;
+        std::string                 capturePath;
+        std::string                 label;
+        uint64_t                    dropped;        /* frames the collector fell behind on */
+    };
+
+    enum ItemKind
+    {
+        ik_begin,
+        ik_frame,
+        ik_end,
+        ik_cancel,
+    };
+
+    struct Item
+    {
+        ItemKind                    kind;
+        FrameRecord                 frame;
+        ReportJob*                  pJob;           /* ik_begin only, owned by the collector from then on */
+        uint64_t                    dropped;        /* ik_end only */
+    };
+
+    bool begin();
+    void finish();
+    void push(ItemKind kind, ReportJob* pJob, uint64_t dropped);
+    void drain();
+    static DWORD __stdcall collectProc(LPVOID lpParam);
+    static void writeReport(const ReportJob& job);
+
+private:
+    State                       m_state;
+    BenchmarkRequest            m_request;
+    std::string                 m_label;
+    std::string                 m_captureDir;
+    std::string                 m_capturePath;
+    uint64_t                    m_tickFrequency;
+    uint64_t                    m_startTick;
+    uint64_t                    m_firstFrameTick;
+    uint64_t                    m_frameCount;       /* of the window, collected or dropped */
+    uint64_t                    m_dropped;
+    SpscQueue<Item, queue_size> m_queue;
+    // collector thread state
+    ReportJob*                  m_pJob;
+    HANDLE                      m_hStopEvent;
+    HANDLE                      m_hThread;
+};
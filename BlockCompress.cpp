@@ -0,0 +1,191 @@
+#include "BlockCompress.h"
+#include <string.h>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#define BC4_SSE2
+#include <emmintrin.h>
+#endif
+
+static void paletteOf(byte r0, byte r1, byte palette[8])
+{
+    palette[0] = r0;
+    palette[1] = r1;
+    if(r0 > r1) {
+        for(int i = 2; i < 8; i ++)
+            palette[i] = (byte)(((8 - i) * r0 + (i - 1) * r1 + 3) / 7);
+    }
+    else {
+        for(int i = 2; i < 6; i ++)
+            palette[i] = (byte)(((6 - i) * r0 + (i - 1) * r1 + 2) / 5);
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+// nearest palette entry of every pixel, returns the summed squared error
+static uint32_t nearest(const byte values[16], const byte palette[8], byte indices[16])
+{
+#ifdef BC4_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v = _mm_loadu_si128((const __m128i*)values);
+    __m128i best = _mm_set1_epi8((char)0xff);
+    __m128i index = zero;
+    for(int i = 0; i < 8; i ++) {
+        __m128i p = _mm_set1_epi8((char)palette[i]);
+        __m128i d = _mm_or_si128(_mm_subs_epu8(v, p), _mm_subs_epu8(p, v));
+        // d < best, the first of equal entries wins
+        __m128i closer = _mm_xor_si128(_mm_cmpeq_epi8(_mm_subs_epu8(best, d), zero), _mm_set1_epi8((char)0xff));
+        index = _mm_or_si128(_mm_andnot_si128(closer, index), _mm_and_si128(closer, _mm_set1_epi8((char)i)));
+        best = _mm_min_epu8(best, d);
+    }
+    _mm_storeu_si128((__m128i*)indices, index);
+    __m128i lo = _mm_unpacklo_epi8(best, zero);
+    __m128i hi = _mm_unpackhi_epi8(best, zero);
+    __m128i sum = _mm_add_epi32(_mm_madd_epi16(lo, lo), _mm_madd_epi16(hi, hi));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+    return (uint32_t)_mm_cvtsi128_si32(sum);
+#else
+    uint32_t error = 0;
+    for(int p = 0; p < 16; p ++) {
+        int best = 256;
+        for(int i = 0; i < 8; i ++) {
+            int d = values[p] > palette[i] ? values[p] - palette[i] : palette[i] - values[p];
+            if(d < best) {
+                best = d;
+                indices[p] = (byte)i;
+            }
+        }
+        error += best * best;
+    }
+    return error;
+#endif
+}
+
+// least squares endpoints for the indices chosen, one step of refinement of the eight level mode
+static bool refine(const byte values[16], const byte indices[16], byte& r0, byte& r1)
+{
+    float aa = 0.f, ab = 0.f, bb = 0.f, av = 0.f, bv = 0.f;
+    for(int p = 0; p < 16; p ++) {
+        int i = indices[p];
+        float a = i == 0 ? 1.f : (i == 1 ? 0.f : (8 - i) / 7.f);
+        float b = 1.f - a;
+        aa += a * a;
+        ab += a * b;
+        bb += b * b;
+        av += a * values[p];
+        bv += b * values[p];
+    }
+    float det = aa * bb - ab * ab;
+    if(det < 1e-6f)
+        return false;
+    float e0 = (av * bb - bv * ab) / det;
+    float e1 = (bv * aa - av * ab) / det;
+    e0 = e0 < 0.f ? 0.f : (e0 > 255.f ? 255.f : e0);
+    e1 = e1 < 0.f ? 0.f : (e1 > 255.f ? 255.f : e1);
+    r0 = (byte)(e0 + 0.5f);
+    r1 = (byte)(e1 + 0.5f);
+    return r0 > r1;
+}
+
+static void encodeBlock(const byte values[16], byte out[bc4_block_bytes])
+{
+    byte lo = 255, hi = 0, innerLo = 255, innerHi = 0;
+    for(int p = 0; p < 16; p ++) {
+        byte v = values[p];
+        lo = v < lo ? v : lo;
+        hi = v > hi ? v : hi;
+        if(v != 0 && v != 255) {
+            innerLo = v < innerLo ? v : innerLo;
+            innerHi = v > innerHi ? v : innerHi;
+        }
+    }
+
+    byte palette[8], indices[16];
+    byte r0 = hi, r1 = lo;
+    paletteOf(r0, r1, palette);
+    uint32_t error = nearest(values, palette, indices);
+    byte f0, f1;
+    if(error > 0 && hi > lo && refine(values, indices, f0, f1)) {
+        byte refinedPalette[8], refinedIndices[16];
+        paletteOf(f0, f1, refinedPalette);
+        uint32_t refinedError = nearest(values, refinedPalette, refinedIndices);
+        if(refinedError < error) {
+            r0 = f0;
+            r1 = f1;
+            error = refinedError;
+            memcpy(indices, refinedIndices, sizeof(indices));
+        }
+    }
+    // the six level mode needs r0 <= r1, and pays off when the block holds 0 or 255 besides an edge
+    if(error > 0 && (lo == 0 || hi == 255)) {
+        if(innerLo > innerHi)
+            innerLo = innerHi = 0;
+        byte palette6[8], indices6[16];
+        paletteOf(innerLo, innerHi, palette6);
+        uint32_t error6 = nearest(values, palette6, indices6);
+        if(error6 < error) {
+            r0 = innerLo;
+            r1 = innerHi;
+            memcpy(indices, indices6, sizeof(indices));
+        }
+    }
+
+    out[0] = r0;
+    out[1] = r1;
+    uint64_t bits = 0;
+    for(int p = 0; p < 16; p ++)
+        bits |= (uint64_t)indices[p] << (3 * p);
+    for(int i = 0; i < 6; i ++)
+        out[2 + i] = (byte)(bits >> (8 * i));
+}
+
+bool encodeBC4(const image& img, int channel, std::vector<byte>& blocks)
+{
+    if(!img.is_valid())
+        return false;
+    int step = img.get_format() == image::fmt_rgba ? 4 : 1;
+    if(channel < 0 || channel >= step)
+        return false;
+    int width = img.get_width();
+    int height = img.get_height();
+    int blocksX = (width + 3) / 4;
+    int blocksY = (height + 3) / 4;
+    blocks.resize(blocksX * blocksY * bc4_block_bytes);
+    byte* out = &blocks.front();
+    byte values[16];
+    for(int by = 0; by < blocksY; by ++) {
+        for(int bx = 0; bx < blocksX; bx ++, out += bc4_block_bytes) {
+            for(int y = 0; y < 4; y ++) {
+                int sy = by * 4 + y < height ? by * 4 + y : height - 1;
+                const byte* row = img.get_data(0, sy) + channel;
+                for(int x = 0; x < 4; x ++) {
+                    int sx = bx * 4 + x < width ? bx * 4 + x : width - 1;
+                    values[y * 4 + x] = row[sx * step];
+                }
+            }
+            encodeBlock(values, out);
+        }
+    }
+    return true;
+}
+
+bool decodeBC4(const byte* blocks, int width, int height, image& img)
+{
+    int blocksX = (width + 3) / 4;
+    int blocksY = (height + 3) / 4;
+    if(!blocks || !img.create(image::fmt_gray, blocksX * 4, blocksY * 4))
+        return false;
+    for(int by = 0; by < blocksY; by ++) {
+        for(int bx = 0; bx < blocksX; bx ++, blocks += bc4_block_bytes) {
+            byte palette[8];
+            paletteOf(blocks[0], blocks[1], palette);
+            uint64_t bits = 0;
+            for(int i = 0; i < 6; i ++)
+                bits |= (uint64_t)blocks[2 + i] << (8 * i);
+            for(int p = 0; p < 16; p ++)
+                *img.get_data(bx * 4 + p % 4, by * 4 + p / 4) = palette[(bits >> (3 * p)) & 7];
+        }
+    }
+    return true;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "readimage.h"
+#include <vector>
+
+/*
+ * BC4_UNORM: one channel in 4x4 blocks of 8 bytes, two endpoints and a 3 bit
+ * index per pixel. Each block is tried in both modes the format has, eight
+ * levels between the block's extremes, and six levels plus exact 0 and 255
+ * for blocks mixing full coverage with an antialiased edge, and the one with
+ * the smaller squared error is kept. The nearest level of all 16 pixels is
+ * found at once with SSE2 where available. Sizes that are not a multiple of
+ * four repeat the last row and column; the texture is then created with the
+ * rounded up size.
+ */
+enum { bc4_block_bytes = 8 };
+
+// channel 0 for fmt_gray; 0..3 picks r, g, b or a of fmt_rgba
+bool encodeBC4(const image& img, int channel, std::vector<byte>& blocks);
+// gray image of the rounded up size, for checking an encoding off the GPU
+bool decodeBC4(const byte* blocks, int width, int height, image& img);
+inline int bc4Pitch(int width) { return (width + 3) / 4 * bc4_block_bytes; }
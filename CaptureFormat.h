@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * On-disk layout of a frametime capture: one CaptureFileHeader followed by
+ * frameCount FrameRecords. From version 3 a completed capture ends with the
+ * FrameHistogram of its frame times: HistogramEntry items followed by a
+ * HistogramFooter, found by the magic in the last bytes of the file.
+ * Version 4 adds the display time DXGI reported for each frame. Kept
+ * free of Windows types so offline tools can read captures on any platform.
+ */
+#define CAPTURE_MAGIC           "D3DFTCAP"
+#define CAPTURE_VERSION         4
+#define CAPTURE_HISTOGRAM_MAGIC "D3DFTHST"
+
+#pragma pack(push, 8)
+
+struct CaptureFileHeader
+{
+    char                magic[8];
+    uint32_t            version;
+    uint32_t            recordSize;
+    uint64_t            tickFrequency;      /* ticks per second */
+    uint64_t            frameCount;
+    uint64_t            droppedCount;       /* frames lost to a full queue */
+};
+
+struct FrameRecord
+{
+    uint64_t            presentStart;       /* ticks at hook entry */
+    uint64_t            presentEnd;         /* ticks after the real Present returned */
+    uint32_t            syncInterval;
+    uint32_t            presentFlags;
+    uint16_t            events;             /* FrameEvent bits, version 2 */
+    uint16_t            resourcesCreated;   /* buffers and textures the game created during the frame, saturated */
+    uint16_t            shadersCreated;
+    uint16_t            captureBacklog;     /* capture queue depth when the frame was recorded, saturated */
+    uint64_t            displayTime;        /* ticks of the vblank that first showed the frame, 0 when dropped or unknown, version 4 */
+    uint32_t            presentId;          /* DXGI present count of the frame, 0 when unavailable */
+    uint32_t            displayRefresh;     /* vblank count at which the frame was first shown */
+};
+
+// version 1 files hold only the fields up to presentFlags, versions 2 and 3 the fields up to captureBacklog
+#define CAPTURE_RECORD_SIZE_V1  24
+#define CAPTURE_RECORD_SIZE_V2  32
+
+enum FrameEvent
+{
+    fe_hitch            = 0x0001,           /* frame far above the local median */
+    fe_level_shift      = 0x0002,           /* sustained change of the frame time level */
+    fe_present_bound    = 0x0004,           /* most of the event frame was spent blocked in Present */
+    fe_dropped          = 0x0008,           /* presented but replaced before it reached the screen, version 4 */
+    fe_display_unknown  = 0x0010,           /* no frame statistics covered the frame, version 4 */
+};
+
+struct HistogramEntry
+{
+    uint64_t            count;
+    uint32_t            index;              /* FrameHistogram bucket */
+    uint32_t            reserved;
+};
+
+struct HistogramFooter
+{
+    uint64_t            entryCount;
+    uint32_t            subBucketBits;      /* layout check, see FrameHistogram */
+    uint32_t            bucketCount;
+    char                magic[8];
+};
+
+#pragma pack(pop)
@@ -0,0 +1,233 @@
+#include "Config.h"
+#include <cassert>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+OverlayConfig::OverlayConfig()
+{
+    logPath = "C:\\Users\\Administrator\\Desktop\\fpslog.txt";
+    overlayX = 15.f;
+    overlayY = 15.f;
+    overlayColor[0] = overlayColor[3] = 1.f;
+    overlayColor[1] = overlayColor[2] = 0.f;
+    overlayBias = 0.f;
+    overlayCompose = true;
+    overlayDeferred = false;
+    fpsLimit = 0;
+    latencyMode = false;
+    capturePath = "C:\\Users\\Administrator\\Desktop\\fpscapture.ftc";
+    captureCsv = false;
+    controlPipe = "\\\\.\\pipe\\d3d11hook";
+}
+
+static char* trim(char* str)
+{
+    while(*str == ' ' || *str == '\t')
+        str ++;
+    char* end = str + strlen(str);
+    while(end > str && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r'))
+        *(-- end) = 0;
+    return str;
+}
+
+static bool parseColor(const char* value, float color[4])
+{
+    float c[4] = { 0.f, 0.f, 0.f, 1.f };
+    int n = sscanf(value, "%f , %f , %f , %f", &c[0], &c[1], &c[2], &c[3]);
+    if(n < 3)
+        return false;
+    memcpy(color, c, sizeof(c));
+    return true;
+}
+
+/*
+ * Format: one "key = value" pair per line, '#' or ';' starts a comment line.
+ * Unknown keys and malformed values are ignored and leave the default in place.
+ */
+bool ConfigManager::parse(const char* text, OverlayConfig& config)
+{
+    assert(text);
+    std::string buf(text);
+    char* line = &buf[0];
+    while(line && *line) {
+        char* next = strchr(line, '\n');
+        if(next)
+            *next ++ = 0;
+        char* key = trim(line);
+        line = next;
+        if(*key == 0 || *key == '#' || *key == ';')
+            continue;
+        char* value = strchr(key, '=');
+        if(!value)
+            continue;
+        *value ++ = 0;
+        key = trim(key);
+        value = trim(value);
+        if(_stricmp(key, "log_path") == 0)
+            config.logPath = value;
+        else if(_stricmp(key, "overlay_x") == 0)
+            config.overlayX = (float)atof(value);
+        else if(_stricmp(key, "overlay_y") == 0)
+            config.overlayY = (float)atof(value);
+        else if(_stricmp(key, "overlay_color") == 0)
+            parseColor(value, config.overlayColor);
+        else if(_stricmp(key, "overlay_bias") == 0)
+            config.overlayBias = (float)atof(value);
+        else if(_stricmp(key, "overlay_compose") == 0)
+            config.overlayCompose = atoi(value) != 0;
+        else if(_stricmp(key, "overlay_deferred") == 0)
+            config.overlayDeferred = atoi(value) != 0;
+        else if(_stricmp(key, "fps_limit") == 0)
+            config.fpsLimit = atoi(value);
+        else if(_stricmp(key, "latency_mode") == 0)
+            config.latencyMode = atoi(value) != 0;
+        else if(_stricmp(key, "capture_path") == 0)
+            config.capturePath = value;
+        else if(_stricmp(key, "capture_csv") == 0)
+            config.captureCsv = atoi(value) != 0;
+        else if(_stricmp(key, "control_pipe") == 0)
+            config.controlPipe = value;
+        else if(_stricmp(key, "benchmark_auto") == 0)
+            config.benchmarkAuto = value;
+    }
+    return true;
+}
+
+static bool readTextFile(const char* szPath, std::string& text)
+{
+    FILE* f = fopen(szPath, "rb");
+    if(!f)
+        return false;
+    char buf[4096];
+    size_t n;
+    text.clear();
+    while((n = fread(buf, 1, sizeof(buf), f)) > 0)
+        text.append(buf, n);
+    fclose(f);
+    return true;
+}
+
+static bool getLastWriteTime(const char* szPath, FILETIME& ft)
+{
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if(!GetFileAttributesExA(szPath, GetFileExInfoStandard, &data))
+        return false;
+    ft = data.ftLastWriteTime;
+    return true;
+}
+
+ConfigManager::ConfigManager()
+{
+    m_current.store(new OverlayConfig, std::memory_order_release);
+    m_graceCount = 0;
+    m_epoch.store(0, std::memory_order_relaxed);
+    m_pins[0].store(0, std::memory_order_relaxed);
+    m_pins[1].store(0, std::memory_order_relaxed);
+    m_lastWriteTime.dwLowDateTime = m_lastWriteTime.dwHighDateTime = 0;
+    m_changedProc = nullptr;
+    m_hStopEvent = NULL;
+    m_hThread = NULL;
+}
+
+void ConfigManager::load(const char* szConfigPath)
+{
+    assert(szConfigPath);
+    m_path = szConfigPath;
+    reloadIfChanged();
+}
+
+bool ConfigManager::reloadIfChanged()
+{
+    FILETIME ft;
+    if(!getLastWriteTime(m_path.c_str(), ft))
+        return false;
+    if(CompareFileTime(&ft, &m_lastWriteTime) == 0)
+        return false;
+    std::string text;
+    if(!readTextFile(m_path.c_str(), text))
+        return false;
+    m_lastWriteTime = ft;
+    OverlayConfig* pConfig = new OverlayConfig;
+    parse(text.c_str(), *pConfig);
+    publish(pConfig);
+    return true;
+}
+
+void ConfigManager::publish(const OverlayConfig* pConfig)
+{
+    const OverlayConfig* pOld = m_current.exchange(pConfig);
+    if(m_changedProc)
+        m_changedProc(*pOld, *pConfig);
+    // readers may still hold the old snapshot, reclaim deletes it once their pins are gone
+    m_retired.push_back(pOld);
+}
+
+int ConfigManager::pin()
+{
+    // a pin counted after the epoch moved on is taken again in the new parity, so a slot
+    // the watcher found empty never gains a reader of a snapshot retired before the flip
+    for(;;) {
+        uint32_t epoch = m_epoch.load();
+        int slot = (int)(epoch & 1);
+        m_pins[slot].fetch_add(1);
+        if(m_epoch.load() == epoch)
+            return slot;
+        m_pins[slot].fetch_sub(1);
+    }
+}
+
+void ConfigManager::pinAgain(int slot)
+{
+    assert(m_pins[slot].load(std::memory_order_relaxed) > 0);
+    m_pins[slot].fetch_add(1);
+}
+
+void ConfigManager::unpin(int slot)
+{
+    m_pins[slot].fetch_sub(1, std::memory_order_release);
+}
+
+// watcher thread only; one grace period at a time, snapshots retired meanwhile wait for the next
+void ConfigManager::reclaim()
+{
+    if(m_graceCount > 0) {
+        int previous = (int)((m_epoch.load() + 1) & 1);
+        if(m_pins[previous].load() != 0)
+            return;
+        for(size_t i = 0; i < m_graceCount; i ++)
+            delete m_retired[i];
+        m_retired.erase(m_retired.begin(), m_retired.begin() + m_graceCount);
+        m_graceCount = 0;
+    }
+    if(!m_retired.empty()) {
+        m_epoch.fetch_add(1);
+        m_graceCount = m_retired.size();
+    }
+}
+
+DWORD __stdcall ConfigManager::watchProc(LPVOID lpParam)
+{
+    ConfigManager* pThis = (ConfigManager*)lpParam;
+    while(WaitForSingleObject(pThis->m_hStopEvent, 1000) == WAIT_TIMEOUT) {
+        pThis->reloadIfChanged();
+        pThis->reclaim();
+    }
+    return 0;
+}
+
+void ConfigManager::startWatching(ConfigChangedProc proc)
+{
+    if(m_hThread)
+        return;
+    m_changedProc = proc;
+    m_hStopEvent = CreateEventA(NULL, TRUE, FALSE, NULL);
+    m_hThread = CreateThread(NULL, 0, watchProc, this, 0, NULL);
+}
+
+void ConfigManager::stopWatching()
+{
+    // called from DllMain, so signal only and never wait on the thread
+    if(m_hStopEvent)
+        SetEvent(m_hStopEvent);
+}
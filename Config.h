@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Windows.h>
+#include <atomic>
+#include <string>
+#include <vector>
+
+/*
+ * Immutable settings snapshot. A new instance is built by the watcher thread on
+ * every change of the config file and published with a single pointer swap, so
+ * the Present hook never parses or locks anything.
+ */
+struct OverlayConfig
+{
+    std::string         logPath;
+    float               overlayX;
+    float               overlayY;
+    float               overlayColor[4];
+    float               overlayBias;
+    bool                overlayCompose;     /* draw the numbers once into a cached texture and blit it every frame */
+    bool                overlayDeferred;    /* record the overlay on a worker thread, Present only executes the command list */
+    int                 fpsLimit;           /* frame rate cap in the Present hook, 0 = off */
+    bool                latencyMode;        /* shallow frame queue and just-in-time frame start */
+    std::string         capturePath;
+    bool                captureCsv;         /* also write a PresentMon-style .csv next to each capture */
+    std::string         controlPipe;
+    std::string         benchmarkAuto;      /* "benchmark" arguments armed on the first frame, empty = off */
+
+    OverlayConfig();
+};
+
+typedef void (*ConfigChangedProc)(const OverlayConfig& oldConfig, const OverlayConfig& newConfig);
+
+/*
+ * Snapshots replaced by a reload are deleted after a grace period: the
+ * watcher flips the epoch and waits until the pins counted in the previous
+ * parity are gone. Present pins once per frame and passes its slot on with
+ * the frame it hands to OverlayRecorder, so a frame is always read under the
+ * pin it was built with. Pinning is two atomic increments, the watcher never
+ * blocks on a reader.
+ */
+
+class ConfigManager
+{
+public:
+    static ConfigManager& instance()
+    {
+        static ConfigManager inst;
+        return inst;
+    }
+    // the returned snapshot stays valid while a pin taken before the call is held; without one,
+    // copy the values out before the watcher thread can reload
+    const OverlayConfig& current() const { return *m_current.load(); }
+    // pins the snapshots current() returns until unpin with the slot returned here
+    int pin();
+    // another pin in the slot of one that is held, to hand a snapshot over to another thread
+    void pinAgain(int slot);
+    void unpin(int slot);
+    void load(const char* szConfigPath);
+    void startWatching(ConfigChangedProc proc);
+    void stopWatching();
+
+    static bool parse(const char* text, OverlayConfig& config);
+
+private:
+    ConfigManager();
+    ConfigManager(const ConfigManager&);
+    bool reloadIfChanged();
+    void publish(const OverlayConfig* pConfig);
+    void reclaim();
+    static DWORD __stdcall watchProc(LPVOID lpParam);
+
+private:
+    std::atomic<const OverlayConfig*>   m_current;
+    std::vector<const OverlayConfig*>   m_retired;
+    size_t                              m_graceCount;   /* retired before the last epoch flip, deleted once its pins are gone */
+    std::atomic<uint32_t>               m_epoch;
+    std::atomic<int>                    m_pins[2];      /* by epoch parity */
+    std::string                         m_path;
+    FILETIME                            m_lastWriteTime;
+    ConfigChangedProc                   m_changedProc;
+    HANDLE                              m_hStopEvent;
+    HANDLE                              m_hThread;
+};
@@ -0,0 +1,264 @@
+#include "ControlChannel.h"
+#include <cassert>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <vector>
+#else
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+#endif
+
+ControlServer::ControlServer()
+{
+    m_stop.store(false);
+    m_telemetryCount = 0;
+#ifdef _WIN32
+    m_hThread = NULL;
+    InitializeSRWLock(&m_telemetryLock);
+#else
+    m_listenFd = -1;
+    m_clientFd = -1;
+#endif
+}
+
+void ControlServer::publishTelemetry(const TelemetrySample* samples, uint32_t count)
+{
+    assert(count <= TELEMETRY_SAMPLES);
+#ifdef _WIN32
+    AcquireSRWLockExclusive(&m_telemetryLock);
+#else
+    m_telemetryLock.lock();
+#endif
+    memcpy(m_telemetry, samples, sizeof(TelemetrySample) * count);
+    m_telemetryCount = count;
+#ifdef _WIN32
+    ReleaseSRWLockExclusive(&m_telemetryLock);
+#else
+    m_telemetryLock.unlock();
+#endif
+}
+
+// "ok <count>" and the samples, copied out first so the render thread never waits on the formatting
+void ControlServer::formatTelemetry(std::string& reply)
+{
+    TelemetrySample samples[TELEMETRY_SAMPLES];
+    uint32_t count;
+#ifdef _WIN32
+    AcquireSRWLockShared(&m_telemetryLock);
+#else
+    m_telemetryLock.lock();
+#endif
+    count = m_telemetryCount;
+    memcpy(samples, m_telemetry, sizeof(TelemetrySample) * count);
+#ifdef _WIN32
+    ReleaseSRWLockShared(&m_telemetryLock);
+#else
+    m_telemetryLock.unlock();
+#endif
+    char text[64];
+    snprintf(text, sizeof(text), "ok %u", count);
+    reply = text;
+    for(uint32_t i = 0; i < count; i ++) {
+        snprintf(text, sizeof(text), " %d,%d,%u,%u,%u", samples[i].fps, samples[i].maxFrameMs,
+            samples[i].p50Us, samples[i].p95Us, samples[i].p99Us);
+        reply += text;
+    }
+}
+
+void ControlServer::handleLine(const char* line, std::string& reply)
+{
+    ControlCommand cmd;
+    const char* error = nullptr;
+    if(!ControlProtocol::parse(line, cmd, error))
+        reply = std::string("error ") + error;
+    else if(cmd.type == cc_ping)
+        reply = "ok pong";
+    else if(cmd.type == cc_telemetry)
+        formatTelemetry(reply);
+    else if(!m_commands.push(cmd))
+        reply = "error busy";
+    else
+        reply = "ok";
+    reply += "\n";
+}
+
+// splits incoming bytes into lines and appends one reply per complete line
+void ControlServer::consume(std::string& pending, const char* data, int size, std::string& replies)
+{
+    pending.append(data, size);
+    size_t pos;
+    while((pos = pending.find('\n')) != std::string::npos) {
+        std::string line = pending.substr(0, pos);
+        pending.erase(0, pos + 1);
+        if(line.find_first_not_of(" \t\r") == std::string::npos)
+            continue;
+        std::string reply;
+        handleLine(line.c_str(), reply);
+        replies += reply;
+    }
+    // a client that never sends a newline should not grow the buffer forever
+    if(pending.size() > 4096)
+        pending.clear();
+}
+
+#ifdef _WIN32
+
+bool ControlServer::start(const char* szName)
+{
+    assert(szName);
+    if(m_hThread)
+        return true;
+    m_name = szName;
+    m_hThread = CreateThread(NULL, 0, serverProc, this, 0, NULL);
+    return m_hThread != NULL;
+}
+
+void ControlServer::stop()
+{
+    // called from DllMain; the thread is left blocked in ConnectNamedPipe
+    m_stop.store(true);
+}
+
+// a security descriptor whose DACL grants access to the user the process runs as and nobody else;
+// sid and acl hold the buffers it points into
+static bool currentUserOnly(std::vector<BYTE>& sid, std::vector<BYTE>& acl, SECURITY_DESCRIPTOR& sd)
+{
+    HANDLE hToken = NULL;
+    if(!OpenProcessToken(GetCurrentProcess(), TOKEN_QUERY, &hToken))
+        return false;
+    DWORD size = 0;
+    GetTokenInformation(hToken, TokenUser, NULL, 0, &size);
+    sid.resize(size);
+    bool ok = size > 0 && GetTokenInformation(hToken, TokenUser, &sid[0], size, &size);
+    CloseHandle(hToken);
+    if(!ok)
+        return false;
+    PSID pSid = ((TOKEN_USER*)&sid[0])->User.Sid;
+    DWORD aclSize = sizeof(ACL) + sizeof(ACCESS_ALLOWED_ACE) - sizeof(DWORD) + GetLengthSid(pSid);
+    acl.resize(aclSize);
+    PACL pAcl = (PACL)&acl[0];
+    return InitializeAcl(pAcl, aclSize, ACL_REVISION) &&
+        AddAccessAllowedAce(pAcl, ACL_REVISION, GENERIC_ALL, pSid) &&
+        InitializeSecurityDescriptor(&sd, SECURITY_DESCRIPTOR_REVISION) &&
+        SetSecurityDescriptorDacl(&sd, TRUE, pAcl, FALSE);
+}
+
+void ControlServer::serve()
+{
+    // the pipe starts captures at a client given path, so other users and other machines are kept out
+    std::vector<BYTE> sid, acl;
+    SECURITY_DESCRIPTOR sd;
+    if(!currentUserOnly(sid, acl, sd))
+        return;
+    SECURITY_ATTRIBUTES sa = { sizeof(sa), &sd, FALSE };
+    while(!m_stop.load()) {
+        HANDLE hPipe = CreateNamedPipeA(m_name.c_str(), PIPE_ACCESS_DUPLEX | FILE_FLAG_FIRST_PIPE_INSTANCE,
+            PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS, 1, 4096, 4096, 0, &sa);
+        if(hPipe == INVALID_HANDLE_VALUE) {
+            Sleep(1000);
+            continue;
+        }
+        if(ConnectNamedPipe(hPipe, NULL) || GetLastError() == ERROR_PIPE_CONNECTED) {
+            std::string pending;
+            char buf[512];
+            DWORD n = 0;
+            while(!m_stop.load() && ReadFile(hPipe, buf, sizeof(buf), &n, NULL) && n > 0) {
+                std::string replies;
+                consume(pending, buf, (int)n, replies);
+                DWORD written = 0;
+                if(!replies.empty() && !WriteFile(hPipe, replies.data(), (DWORD)replies.size(), &written, NULL))
+                    break;
+            }
+        }
+        DisconnectNamedPipe(hPipe);
+        CloseHandle(hPipe);
+    }
+}
+
+DWORD __stdcall ControlServer::serverProc(LPVOID lpParam)
+{
+    ((ControlServer*)lpParam)->serve();
+    return 0;
+}
+
+#else
+
+bool ControlServer::start(const char* szName)
+{
+    assert(szName);
+    if(m_listenFd >= 0)
+        return true;
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if(strlen(szName) >= sizeof(addr.sun_path))
+        return false;
+    strcpy(addr.sun_path, szName);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd < 0)
+        return false;
+    unlink(szName);
+    if(bind(fd, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, 1) != 0) {
+        close(fd);
+        return false;
+    }
+    chmod(szName, 0600);
+    m_name = szName;
+    m_listenFd = fd;
+    m_stop.store(false);
+    m_thread = std::thread(&ControlServer::serve, this);
+    return true;
+}
+
+void ControlServer::stop()
+{
+    if(m_listenFd < 0)
+        return;
+    m_stop.store(true);
+    shutdown(m_listenFd, SHUT_RDWR);
+    // a connected client would keep the thread in read() until it hangs up
+    m_clientLock.lock();
+    if(m_clientFd >= 0)
+        shutdown(m_clientFd, SHUT_RDWR);
+    m_clientLock.unlock();
+    if(m_thread.joinable())
+        m_thread.join();
+    close(m_listenFd);
+    m_listenFd = -1;
+    unlink(m_name.c_str());
+}
+
+void ControlServer::serve()
+{
+    while(!m_stop.load()) {
+        int fd = accept(m_listenFd, nullptr, nullptr);
+        if(fd < 0)
+            break;
+        // published under the lock so stop() either sees it or this sees m_stop
+        m_clientLock.lock();
+        m_clientFd = m_stop.load() ? -1 : fd;
+        m_clientLock.unlock();
+        std::string pending;
+        char buf[512];
+        ssize_t n;
+        while(m_clientFd >= 0 && !m_stop.load() && (n = read(fd, buf, sizeof(buf))) > 0) {
+            std::string replies;
+            consume(pending, buf, (int)n, replies);
+            if(!replies.empty() && send(fd, replies.data(), replies.size(), MSG_NOSIGNAL) < 0)
+                break;
+        }
+        m_clientLock.lock();
+        m_clientFd = -1;
+        m_clientLock.unlock();
+        close(fd);
+    }
+}
+
+#endif
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include "ControlProtocol.h"
+#include "SpscQueue.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <mutex>
+#include <thread>
+#endif
+
+/*
+ * Local control endpoint served by its own thread: a named pipe on Windows,
+ * a Unix domain socket elsewhere. Requests are parsed on the server thread
+ * and queued for the render thread, which drains them once per Present, so
+ * the hot path never waits on I/O. Only one client is served at a time,
+ * which keeps the server thread the single producer of the queue. The
+ * render thread publishes the primary swapchain's telemetry ring once a
+ * second, and "telemetry" is answered from that copy.
+ */
+class ControlServer
+{
+public:
+    static ControlServer& instance()
+    {
+        static ControlServer inst;
+        return inst;
+    }
+    bool start(const char* szName);
+    void stop();
+    // render thread only
+    bool popCommand(ControlCommand& cmd) { return m_commands.pop(cmd); }
+    // render thread only, samples oldest first; count is at most TELEMETRY_SAMPLES
+    void publishTelemetry(const TelemetrySample* samples, uint32_t count);
+
+    void consume(std::string& pending, const char* data, int size, std::string& replies);
+
+private:
+    ControlServer();
+    ControlServer(const ControlServer&);
+    void handleLine(const char* line, std::string& reply);
+    void formatTelemetry(std::string& reply);
+    void serve();
+#ifdef _WIN32
+    static DWORD __stdcall serverProc(LPVOID lpParam);
+#endif
+
+private:
+    SpscQueue<ControlCommand, 16>   m_commands;
+    std::string                     m_name;
+    std::atomic<bool>               m_stop;
+    TelemetrySample                 m_telemetry[TELEMETRY_SAMPLES];
+    uint32_t                        m_telemetryCount;
+#ifdef _WIN32
+    HANDLE                          m_hThread;
+    SRWLOCK                         m_telemetryLock;
+#else
+    std::mutex                      m_telemetryLock;
+    int                             m_listenFd;
+    std::mutex                      m_clientLock;
+    int                             m_clientFd;     /* shut down by stop() to wake a blocked read */
+    std::thread                     m_thread;
+#endif
+};
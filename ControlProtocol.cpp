@@ -0,0 +1,148 @@
+#include "ControlProtocol.h"
+#include <cassert>
+#include <string.h>
+#include <stdio.h>
+
+static const char* skipSpaces(const char* p)
+{
+    while(*p == ' ' || *p == '\t')
+        p ++;
+    return p;
+}
+
+// copies the next whitespace separated token into buf, returns the position after it
+static const char* nextToken(const char* p, char* buf, int size)
+{
+    p = skipSpaces(p);
+    int n = 0;
+    while(*p && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n') {
+        if(n < size - 1)
+            buf[n ++] = *p;
+        p ++;
+    }
+    buf[n] = 0;
+    return p;
+}
+
+// copies the rest of the line, without surrounding blanks, into buf
+static void restOfLine(const char* p, char* buf, int size)
+{
+    p = skipSpaces(p);
+    int n = 0;
+    while(*p && *p != '\r' && *p != '\n' && n < size - 1)
+        buf[n ++] = *p ++;
+    while(n > 0 && (buf[n - 1] == ' ' || buf[n - 1] == '\t'))
+        n --;
+    buf[n] = 0;
+}
+
+bool ControlProtocol::parse(const char* line, ControlCommand& cmd, const char*& error)
+{
+    assert(line);
+    memset(&cmd, 0, sizeof(cmd));
+    error = nullptr;
+    char verb[32], sub[32];
+    const char* p = nextToken(line, verb, sizeof(verb));
+    if(strcmp(verb, "ping") == 0) {
+        cmd.type = cc_ping;
+        return true;
+    }
+    if(strcmp(verb, "capture") == 0) {
+        p = nextToken(p, sub, sizeof(sub));
+        if(strcmp(sub, "start") == 0) {
+            cmd.type = cc_capture_start;
+            restOfLine(p, cmd.arg, sizeof(cmd.arg));
+            return true;
+        }
+        if(strcmp(sub, "stop") == 0) {
+            cmd.type = cc_capture_stop;
+            return true;
+        }
+        error = "usage: capture start [path] | capture stop";
+        return false;
+    }
+    if(strcmp(verb, "overlay") == 0) {
+        nextToken(p, sub, sizeof(sub));
+        cmd.type = cc_overlay_mode;
+        if(strcmp(sub, "off") == 0)
+            cmd.value = om_off;
+        else if(strcmp(sub, "fps") == 0)
+            cmd.value = om_fps;
+        else if(strcmp(sub, "detailed") == 0)
+            cmd.value = om_detailed;
+        else if(strcmp(sub, "percentiles") == 0)
+            cmd.value = om_percentiles;
+        else if(strcmp(sub, "graph") == 0)
+            cmd.value = om_graph;
+        else {
+            error = "usage: overlay off|fps|detailed|percentiles|graph";
+            return false;
+        }
+        return true;
+    }
+    if(strcmp(verb, "benchmark") == 0) {
+        char peek[32];
+        nextToken(p, peek, sizeof(peek));
+        if(strcmp(peek, "cancel") == 0) {
+            cmd.type = cc_benchmark_cancel;
+            return true;
+        }
+        cmd.type = cc_benchmark_start;
+        return parseBenchmark(p, cmd.bench, cmd.arg, sizeof(cmd.arg), error);
+    }
+    if(strcmp(verb, "telemetry") == 0) {
+        cmd.type = cc_telemetry;
+        return true;
+    }
+    error = "unknown command";
+    return false;
+}
+
+bool ControlProtocol::parseBenchmark(const char* args, BenchmarkRequest& req, char* label, int size, const char*& error)
+{
+    assert(args && label && size > 0);
+    static const char* usage = "usage: benchmark <N>s|<N>f [delay <S>] [name <label>] | benchmark cancel";
+    static const char* range = "benchmark length is 1-3600 s or 1-1000000 f, delay 0-3600 s";
+    memset(&req, 0, sizeof(req));
+    label[0] = 0;
+    char token[32];
+    const char* p = nextToken(args, token, sizeof(token));
+    char unit = 0;
+    char extra = 0;
+    // the widths keep sscanf clear of int overflow, a longer number leaves a digit where the unit goes
+    if(sscanf(token, "%8d%c%c", &req.length, &unit, &extra) != 2 || req.length <= 0 || (unit != 's' && unit != 'f')) {
+        error = (unit >= '0' && unit <= '9') ? range : usage;
+        return false;
+    }
+    req.byFrames = (unit == 'f');
+    if(req.length > (req.byFrames ? BENCHMARK_FRAMES_MAX : BENCHMARK_SECONDS_MAX)) {
+        error = range;
+        return false;
+    }
+    for(;;) {
+        p = nextToken(p, token, sizeof(token));
+        if(token[0] == 0)
+            break;
+        if(strcmp(token, "delay") == 0) {
+            p = nextToken(p, token, sizeof(token));
+            extra = 0;
+            if(sscanf(token, "%8d%c", &req.delaySec, &extra) != 1 || req.delaySec < 0) {
+                error = (extra >= '0' && extra <= '9') ? range : usage;
+                return false;
+            }
+            if(req.delaySec > BENCHMARK_DELAY_MAX) {
+                error = range;
+                return false;
+            }
+        }
+        else if(strcmp(token, "name") == 0) {
+            restOfLine(p, label, size);
+            break;
+        }
+        else {
+            error = usage;
+            return false;
+        }
+    }
+    return true;
+}
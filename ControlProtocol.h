@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Text protocol of the control channel, one request per line:
+ *
+ *   ping
+ *   capture start [path]
+ *   capture stop
+ *   overlay off|fps|detailed|percentiles|graph
+ *   benchmark <N>s|<N>f [delay <S>] [name <label>]
+ *   benchmark cancel
+ *   telemetry
+ *
+ * Every request is answered with a single "ok ..." or "error ..." line.
+ * "telemetry" is answered on the spot with the primary swapchain's last
+ * minute, one sample per second, oldest first: "ok <count>" followed by
+ * " <fps>,<max ms>,<p50 us>,<p95 us>,<p99 us>" for each sample.
+ * Parsing is platform independent; transports live in ControlChannel.
+ */
+#define CONTROL_ARG_SIZE        260
+// longest benchmark window and delay accepted
+#define BENCHMARK_SECONDS_MAX   3600
+#define BENCHMARK_FRAMES_MAX    1000000
+#define BENCHMARK_DELAY_MAX     3600
+// samples a telemetry reply holds at most
+#define TELEMETRY_SAMPLES       60
+
+enum ControlCommandType
+{
+    cc_ping,
+    cc_capture_start,
+    cc_capture_stop,
+    cc_overlay_mode,
+    cc_benchmark_start,
+    cc_benchmark_cancel,
+    cc_telemetry,
+};
+
+enum OverlayMode
+{
+    om_off,
+    om_fps,
+    om_detailed,
+    om_percentiles,
+    om_graph,
+};
+
+struct BenchmarkRequest
+{
+    int                 length;             /* seconds, or frames when byFrames is set */
+    bool                byFrames;
+    int                 delaySec;           /* wait before the capture window opens */
+};
+
+// one second of a swapchain's frame rate, as published by AnimFrameCounter
+struct TelemetrySample
+{
+    int                 fps;
+    int                 maxFrameMs;
+    uint32_t            p50Us;
+    uint32_t            p95Us;
+    uint32_t            p99Us;
+};
+
+struct ControlCommand
+{
+    ControlCommandType  type;
+    int                 value;
+    BenchmarkRequest    bench;
+    char                arg[CONTROL_ARG_SIZE];     /* empty when not given */
+};
+
+class ControlProtocol
+{
+public:
+    static bool parse(const char* line, ControlCommand& cmd, const char*& error);
+    // parses the arguments of "benchmark", the label ends up in label
+    static bool parseBenchmark(const char* args, BenchmarkRequest& req, char* label, int size, const char*& error);
+};
@@ -0,0 +1,91 @@
+#include "DeviceActivity.h"
+#include "MinHook/include/MinHook.h"
+
+// detour for CreateBuffer / CreateTexture1D/2D/3D, one instantiation per vtable slot
+template<int Index, class Desc, class Resource>
+struct CreateResourceHook
+{
+    typedef HRESULT(__stdcall* Proc)(ID3D11Device*, const Desc*, const D3D11_SUBRESOURCE_DATA*, Resource**);
+    static Proc original;
+
+    static HRESULT __stdcall detour(ID3D11Device* pDevice, const Desc* pDesc, const D3D11_SUBRESOURCE_DATA* pData, Resource** ppResource)
+    {
+        HRESULT hr = original(pDevice, pDesc, pData, ppResource);
+        if(SUCCEEDED(hr) && ppResource)
+            DeviceActivity::instance().onCreate(false);
+        return hr;
+    }
+};
+
+template<int Index, class Desc, class Resource>
+typename CreateResourceHook<Index, Desc, Resource>::Proc CreateResourceHook<Index, Desc, Resource>::original = nullptr;
+
+// detour for the Create*Shader family, which all share one signature
+template<int Index, class Shader>
+struct CreateShaderHook
+{
+    typedef HRESULT(__stdcall* Proc)(ID3D11Device*, const void*, SIZE_T, ID3D11ClassLinkage*, Shader**);
+    static Proc original;
+
+    static HRESULT __stdcall detour(ID3D11Device* pDevice, const void* pBytecode, SIZE_T length, ID3D11ClassLinkage* pLinkage, Shader** ppShader)
+    {
+        HRESULT hr = original(pDevice, pBytecode, length, pLinkage, ppShader);
+        if(SUCCEEDED(hr) && ppShader)
+            DeviceActivity::instance().onCreate(true);
+        return hr;
+    }
+};
+
+template<int Index, class Shader>
+typename CreateShaderHook<Index, Shader>::Proc CreateShaderHook<Index, Shader>::original = nullptr;
+
+template<class Hook>
+static bool hookSlot(DWORD_PTR* pVtable, int index)
+{
+    LPVOID pTarget = (LPVOID)pVtable[index];
+    if(MH_CreateHook(pTarget, (LPVOID)Hook::detour, reinterpret_cast<void**>(&Hook::original)) != MH_OK)
+        return false;
+    return MH_EnableHook(pTarget) == MH_OK;
+}
+
+DeviceActivity::DeviceActivity()
+{
+    m_resources.store(0, std::memory_order_relaxed);
+    m_shaders.store(0, std::memory_order_relaxed);
+    m_overlayThread.store(0, std::memory_order_relaxed);
+    m_recorderThread.store(0, std::memory_order_relaxed);
+}
+
+bool DeviceActivity::install(ID3D11Device* pDevice)
+{
+    DWORD_PTR* pVtable = (DWORD_PTR*)((DWORD_PTR*)pDevice)[0];
+    bool ok = true;
+    ok &= hookSlot<CreateResourceHook<3, D3D11_BUFFER_DESC, ID3D11Buffer> >(pVtable, 3);
+    ok &= hookSlot<CreateResourceHook<4, D3D11_TEXTURE1D_DESC, ID3D11Texture1D> >(pVtable, 4);
+    ok &= hookSlot<CreateResourceHook<5, D3D11_TEXTURE2D_DESC, ID3D11Texture2D> >(pVtable, 5);
+    ok &= hookSlot<CreateResourceHook<6, D3D11_TEXTURE3D_DESC, ID3D11Texture3D> >(pVtable, 6);
+    ok &= hookSlot<CreateShaderHook<12, ID3D11VertexShader> >(pVtable, 12);
+    ok &= hookSlot<CreateShaderHook<13, ID3D11GeometryShader> >(pVtable, 13);
+    ok &= hookSlot<CreateShaderHook<15, ID3D11PixelShader> >(pVtable, 15);
+    ok &= hookSlot<CreateShaderHook<16, ID3D11HullShader> >(pVtable, 16);
+    ok &= hookSlot<CreateShaderHook<17, ID3D11DomainShader> >(pVtable, 17);
+    ok &= hookSlot<CreateShaderHook<18, ID3D11ComputeShader> >(pVtable, 18);
+    return ok;
+}
+
+void DeviceActivity::onCreate(bool shader)
+{
+    DWORD threadId = GetCurrentThreadId();
+    if(m_overlayThread.load(std::memory_order_relaxed) == threadId || m_recorderThread.load(std::memory_order_relaxed) == threadId)
+        return;
+    if(shader)
+        m_shaders.fetch_add(1, std::memory_order_relaxed);
+    else
+        m_resources.fetch_add(1, std::memory_order_relaxed);
+}
+
+void DeviceActivity::takeCounts(uint32_t& resources, uint32_t& shaders)
+{
+    resources = m_resources.exchange(0, std::memory_order_relaxed);
+    shaders = m_shaders.exchange(0, std::memory_order_relaxed);
+}
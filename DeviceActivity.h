@@ -0,0 +1,43 @@
+#pragma once
+
+#include <Windows.h>
+#include <d3d11.h>
+#include <atomic>
+
+/*
+ * Counts buffer/texture and shader creation on the game's device, so a hitch
+ * can be attributed to streaming or shader compilation. The Create* entries
+ * of the device vtable are detoured with MinHook; the detours only bump an
+ * atomic counter. Creation done by the overlay itself, on the render thread
+ * or on the thread recording it, is not counted.
+ */
+class DeviceActivity
+{
+public:
+    static DeviceActivity& instance()
+    {
+        static DeviceActivity inst;
+        return inst;
+    }
+    // MinHook must already be initialized
+    bool install(ID3D11Device* pDevice);
+    // brackets the overlay drawing on the render thread
+    void beginOverlay() { m_overlayThread.store(GetCurrentThreadId(), std::memory_order_relaxed); }
+    void endOverlay() { m_overlayThread.store(0, std::memory_order_relaxed); }
+    // the overlay's own recording thread, everything it creates is the overlay's
+    void setRecorderThread(DWORD threadId) { m_recorderThread.store(threadId, std::memory_order_relaxed); }
+    // counts since the previous call, once per Present
+    void takeCounts(uint32_t& resources, uint32_t& shaders);
+
+    void onCreate(bool shader);
+
+private:
+    DeviceActivity();
+    DeviceActivity(const DeviceActivity&);
+
+private:
+    std::atomic<uint32_t>       m_resources;
+    std::atomic<uint32_t>       m_shaders;
+    std::atomic<DWORD>          m_overlayThread;
+    std::atomic<DWORD>          m_recorderThread;
+};
@@ -0,0 +1,155 @@
+#include "DisplayTimeline.h"
+#include <string.h>
+
+// weight of a new vblank interval measurement
+static const double     g_refreshWeight = 1.0 / 8.0;
+
+// wrap-safe order of DXGI counters
+static int32_t countDelta(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b);
+}
+
+DisplayTimeline::DisplayTimeline()
+{
+    reset();
+}
+
+void DisplayTimeline::reset()
+{
+    memset(m_pending, 0, sizeof(m_pending));
+    memset(m_settled, 0, sizeof(m_settled));
+    m_head = 0;
+    m_count = 0;
+    m_havePrev = false;
+    memset(&m_prev, 0, sizeof(m_prev));
+    m_refreshTicks = 0.0;
+    m_droppedCount = 0;
+}
+
+void DisplayTimeline::onPresent(const FrameRecord& rec, uint32_t presentId, const DisplayStatsSample* sample)
+{
+    FrameRecord frame = rec;
+    frame.presentId = presentId;
+    frame.displayTime = 0;
+    frame.displayRefresh = 0;
+    frame.events &= ~(fe_dropped | fe_display_unknown);
+    push(frame);
+    if(sample)
+        settle(*sample);
+    else
+        m_havePrev = false;     /* the counters may jump across a disjoint interval, start over from the next sample */
+    if(m_count == pending_size && !m_settled[m_head]) {
+        // statistics stopped advancing, the oldest frame will not be resolved any more
+        m_pending[m_head].events |= fe_display_unknown;
+        m_settled[m_head] = true;
+    }
+}
+
+void DisplayTimeline::push(const FrameRecord& rec)
+{
+    if(m_count == pending_size) {
+        // pop() was not called after the previous frame; lose the oldest rather than block the render thread
+        m_head = (m_head + 1) % pending_size;
+        m_count --;
+    }
+    int slot = (m_head + m_count) % pending_size;
+    m_pending[slot] = rec;
+    m_settled[slot] = rec.presentId == 0;
+    if(m_settled[slot])
+        m_pending[slot].events |= fe_display_unknown;
+    m_count ++;
+}
+
+void DisplayTimeline::markUnknownBefore(uint32_t presentId)
+{
+    for(int i = 0; i < m_count; i ++) {
+        int slot = (m_head + i) % pending_size;
+        if(!m_settled[slot] && countDelta(m_pending[slot].presentId, presentId) < 0) {
+            m_pending[slot].events |= fe_display_unknown;
+            m_settled[slot] = true;
+        }
+    }
+}
+
+void DisplayTimeline::settle(const DisplayStatsSample& sample)
+{
+    if(m_havePrev) {
+        int32_t vblanks = countDelta(sample.syncRefreshCount, m_prev.syncRefreshCount);
+        if(vblanks > 0 && sample.syncTime > m_prev.syncTime) {
+            double interval = (double)(sample.syncTime - m_prev.syncTime) / (double)vblanks;
+            m_refreshTicks = m_refreshTicks == 0.0 ? interval : m_refreshTicks + (interval - m_refreshTicks) * g_refreshWeight;
+        }
+    }
+    if(!m_havePrev) {
+        // without a baseline only the frame on screen can be placed
+        markUnknownBefore(sample.presentCount);
+        m_prev = sample;
+        m_prev.presentCount = sample.presentCount - 1;
+        m_prev.presentRefreshCount = sample.presentRefreshCount - 1;
+        m_havePrev = true;
+    }
+    int32_t presents = countDelta(sample.presentCount, m_prev.presentCount);
+    if(presents <= 0) {
+        // nothing new on screen; keep the newer vblank for the interval estimate
+        m_prev.syncRefreshCount = sample.syncRefreshCount;
+        m_prev.syncTime = sample.syncTime;
+        return;
+    }
+    int32_t refreshes = countDelta(sample.presentRefreshCount, m_prev.presentRefreshCount);
+    int32_t dropped = presents > refreshes ? presents - (refreshes > 0 ? refreshes : 0) : 0;
+    int32_t shown = presents - dropped;
+    // vblanks between consecutive shown frames, 2 at sync interval 2 and so on
+    int32_t spacing = shown > 0 && refreshes > shown ? refreshes / shown : 1;
+    for(int i = 0; i < m_count; i ++) {
+        int slot = (m_head + i) % pending_size;
+        if(m_settled[slot])
+            continue;
+        FrameRecord& frame = m_pending[slot];
+        int32_t age = countDelta(sample.presentCount, frame.presentId);
+        if(age < 0)
+            continue;
+        m_settled[slot] = true;
+        if(age >= presents) {
+            frame.events |= fe_display_unknown;
+            continue;
+        }
+        if(presents - age <= dropped) {
+            frame.events |= fe_dropped;
+            m_droppedCount ++;
+            continue;
+        }
+        uint32_t refresh = sample.presentRefreshCount - (uint32_t)(age * spacing);
+        int32_t sinceShown = countDelta(sample.syncRefreshCount, refresh);
+        if(sinceShown < 0 || (sinceShown > 0 && m_refreshTicks == 0.0) ||
+            (double)sinceShown * m_refreshTicks > (double)sample.syncTime) {
+            frame.events |= fe_display_unknown;
+            continue;
+        }
+        frame.displayRefresh = refresh;
+        frame.displayTime = sample.syncTime - (uint64_t)((double)sinceShown * m_refreshTicks + 0.5);
+    }
+    m_prev = sample;
+}
+
+bool DisplayTimeline::pop(FrameRecord& rec)
+{
+    if(m_count == 0 || !m_settled[m_head])
+        return false;
+    rec = m_pending[m_head];
+    m_head = (m_head + 1) % pending_size;
+    m_count --;
+    return true;
+}
+
+void DisplayTimeline::flush()
+{
+    for(int i = 0; i < m_count; i ++) {
+        int slot = (m_head + i) % pending_size;
+        if(!m_settled[slot]) {
+            m_pending[slot].events |= fe_display_unknown;
+            m_settled[slot] = true;
+        }
+    }
+    m_havePrev = false;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+#include "CaptureFormat.h"
+
+// one GetFrameStatistics result, with SyncQPCTime already converted to FrameClock ticks
+struct DisplayStatsSample
+{
+    uint32_t            presentCount;       /* present id of the frame most recently shown */
+    uint32_t            presentRefreshCount;/* vblank at which that frame was first shown */
+    uint32_t            syncRefreshCount;   /* vblank at which syncTime was taken */
+    uint64_t            syncTime;
+};
+
+/*
+ * Turns the statistics DXGI reports after each Present into the display time
+ * of every frame. A frame is only known to be on screen a few Presents after
+ * it was submitted, so records wait in a small queue until the statistics
+ * cover their present id, and pop() hands them out in submission order with
+ * displayTime filled in or fe_dropped / fe_display_unknown set.
+ *
+ * Between two samples the present count advanced by P and the refresh count
+ * by R. Every shown frame needs a vblank of its own, so at least P - R of the
+ * frames in between were replaced before reaching the screen; they are taken
+ * to be the oldest ones. The others are placed on the vblanks just before the
+ * newest frame, which is exact in the usual case of one Present per sample.
+ * A disjoint or missing sample breaks the chain, and frames that cannot be
+ * settled from the next sample are marked unknown.
+ */
+class DisplayTimeline
+{
+public:
+    enum { pending_size = 16 };
+
+    DisplayTimeline();
+    void reset();
+    // rec was just presented as present id presentId; sample is nullptr when the statistics were unavailable or disjoint.
+    // Call pop() until it fails after every frame, the queue then never overflows
+    void onPresent(const FrameRecord& rec, uint32_t presentId, const DisplayStatsSample* sample);
+    // oldest settled frame
+    bool pop(FrameRecord& rec);
+    // gives up on everything still waiting, for a change of swapchain or the end of a run
+    void flush();
+
+    double refreshMs(uint64_t tickFrequency) const { return m_refreshTicks * 1000.0 / (double)tickFrequency; }
+    uint64_t droppedCount() const { return m_droppedCount; }
+
+private:
+    void settle(const DisplayStatsSample& sample);
+    void markUnknownBefore(uint32_t presentId);
+    void push(const FrameRecord& rec);
+
+private:
+    // frames waiting for statistics, oldest at m_head
+    FrameRecord         m_pending[pending_size];
+    bool                m_settled[pending_size];
+    int                 m_head;
+    int                 m_count;
+    bool                m_havePrev;
+    DisplayStatsSample  m_prev;
+    double              m_refreshTicks;     /* smoothed vblank interval, 0 until measured */
+    uint64_t            m_droppedCount;
+};
@@ -0,0 +1,105 @@
+#include "DistanceField.h"
+#include <math.h>
+#include <vector>
+
+static const float      g_distanceInfinity = 1e20f;
+
+// squared distance transform of one row or column in place (Felzenszwalb and Huttenlocher, 2012)
+static void transform1d(float* f, int n, int stride, std::vector<float>& d, std::vector<int>& v, std::vector<float>& z)
+{
+    int k = 0;
+    v[0] = 0;
+    z[0] = -g_distanceInfinity;
+    z[1] = g_distanceInfinity;
+    for(int q = 1; q < n; q ++) {
+        // lower envelope of the parabolas rooted at each sample
+        float fq = f[q * stride] + (float)q * q;
+        float s = (fq - (f[v[k] * stride] + (float)v[k] * v[k])) / (2.f * (q - v[k]));
+        while(s <= z[k]) {
+            k --;
+            s = (fq - (f[v[k] * stride] + (float)v[k] * v[k])) / (2.f * (q - v[k]));
+        }
+        k ++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = g_distanceInfinity;
+    }
+    k = 0;
+    for(int q = 0; q < n; q ++) {
+        while(z[k + 1] < (float)q)
+            k ++;
+        int r = v[k];
+        d[q] = (float)(q - r) * (q - r) + f[r * stride];
+    }
+    for(int q = 0; q < n; q ++)
+        f[q * stride] = d[q];
+}
+
+static void transform2d(std::vector<float>& grid, int width, int height)
+{
+    int n = width > height ? width : height;
+    std::vector<float> d(n), z(n + 1);
+    std::vector<int> v(n);
+    for(int x = 0; x < width; x ++)
+        transform1d(&grid[x], height, width, d, v, z);
+    for(int y = 0; y < height; y ++)
+        transform1d(&grid[y * width], width, 1, d, v, z);
+}
+
+bool buildDistanceField(const image& coverage, int spread, int downscale, image& field)
+{
+    if(!coverage.is_valid() || coverage.get_format() != image::fmt_gray || spread <= 0 || downscale <= 0)
+        return false;
+    int width = coverage.get_width();
+    int height = coverage.get_height();
+    if(width % downscale || height % downscale)
+        return false;
+
+    // squared distance of every pixel to the nearest inside and the nearest outside pixel
+    std::vector<float> toInside(width * height), toOutside(width * height);
+    for(int y = 0; y < height; y ++) {
+        const byte* src = coverage.get_data(0, y);
+        for(int x = 0; x < width; x ++) {
+            bool inside = src[x] >= 128;
+            toInside[y * width + x] = inside ? 0.f : g_distanceInfinity;
+            toOutside[y * width + x] = inside ? g_distanceInfinity : 0.f;
+        }
+    }
+    transform2d(toInside, width, height);
+    transform2d(toOutside, width, height);
+
+    // signed distance in source pixels, the edge half way between pixel centers unless coverage places it
+    std::vector<float> distance(width * height);
+    for(int y = 0; y < height; y ++) {
+        const byte* src = coverage.get_data(0, y);
+        for(int x = 0; x < width; x ++) {
+            int i = y * width + x;
+            if(src[x] > 0 && src[x] < 255)
+                distance[i] = src[x] / 255.f - 0.5f;
+            else if(src[x] >= 128)
+                distance[i] = sqrtf(toOutside[i]) - 0.5f;
+            else
+                distance[i] = 0.5f - sqrtf(toInside[i]);
+        }
+    }
+
+    int fieldWidth = width / downscale;
+    int fieldHeight = height / downscale;
+    if(!field.create(image::fmt_gray, fieldWidth, fieldHeight))
+        return false;
+    float scale = 1.f / (2.f * spread * downscale * downscale);
+    for(int y = 0; y < fieldHeight; y ++) {
+        byte* dst = field.get_data(0, y);
+        for(int x = 0; x < fieldWidth; x ++) {
+            float sum = 0.f;
+            for(int sy = 0; sy < downscale; sy ++) {
+                for(int sx = 0; sx < downscale; sx ++)
+                    sum += distance[(y * downscale + sy) * width + x * downscale + sx];
+            }
+            float value = 0.5f + sum * scale;
+            value = value < 0.f ? 0.f : (value > 1.f ? 1.f : value);
+            dst[x] = (byte)(value * 255.f + 0.5f);
+        }
+    }
+    return true;
+}
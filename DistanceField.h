@@ -0,0 +1,16 @@
+#pragma once
+
+#include "readimage.h"
+
+/*
+ * Signed distance field of an 8-bit coverage image, for text that stays sharp
+ * at any scale from one small texture. Inside and outside are split at half
+ * coverage and measured with an exact Euclidean distance transform
+ * (Felzenszwalb and Huttenlocher, two separable passes); pixels on an
+ * antialiased edge take their distance from the coverage instead, which keeps
+ * the sub-pixel edge position of the source. The result is averaged down by
+ * downscale and stored as 0.5 + distance / (2 * spread), distance in source
+ * pixels and positive inside, so 128 is the edge and the field saturates
+ * spread pixels from it. Plain C++ over image, it runs at startup or offline.
+ */
+bool buildDistanceField(const image& coverage, int spread, int downscale, image& field);
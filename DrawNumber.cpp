@@ -1,12 +1,58 @@
 #include "DrawNumber.h"
 #include "DrawNumberPS.h"
 #include "DrawNumberVS.h"
+#include "DrawTextPS.h"
+#include "DrawWidgetPS.h"
+#include "DrawWidgetVS.h"
+#include "FrameGraphPS.h"
+#include "FrameGraphVS.h"
+#include "ComposePS.h"
+#include "ComposeVS.h"
+#include "BlockCompress.h"
+#include "FrameArena.h"
+#include "Config.h"
+#include "OverlayState.h"
+#include "OverlayWidgets.h"
+#include "TextLayout.h"
 #include <cassert>
 
 #include "readimage.h"
 #include <unordered_map>
+#include <vector>
 
-image                   g_numTextImage;
+// both atlases of OverlayGeometry as BC4 blocks of the channel the shaders read, uploaded where the device samples BC4
+std::vector<byte>       g_numTextBlocks;
+std::vector<byte>       g_textFieldBlocks;
+
+// HUD targets grow in steps of this many pixels, so a number gaining a digit rarely reallocates
+static const UINT       g_hudGranularity = 64;
+
+// the initial contents of a widget vertex buffer: quads no widget owns are collapsed from the start
+static const DrawNumberVertex g_collapsedWidgets[WidgetTree::quads_max * 4] = {};
+
+struct ComposeConstants
+{
+    float                       rect[4];
+    float                       tex[4];
+};
+
+struct WidgetConstants
+{
+    float                       scale[4];
+    float                       atlas[4];
+    uint32_t                    firstText;
+    uint32_t                    padding[3];
+};
+
+struct GraphConstants
+{
+    float                       origin[4];
+    float                       color[4];
+    uint32_t                    start;
+    uint32_t                    capacity;
+    float                       top;
+    float                       padding;
+};
 
 #ifndef SAFE_RELEASE
 #define SAFE_RELEASE(ptr) do { \
@@ -26,6 +72,27 @@ struct DrawNumberCache
     ID3D11VertexShader*         pVertexShader;
     ID3D11PixelShader*          pPixelShader;
     ID3D11InputLayout*          pInputLayout;
+    ID3D11VertexShader*         pGraphVertexShader;
+    ID3D11PixelShader*          pGraphPixelShader;
+    ID3D11Buffer*               pGraphConstants;
+    bool                        graphNoOverwrite;   /* dynamic buffer SRVs may be mapped NO_OVERWRITE (D3D11.1) */
+    ID3D11BlendState*           pBlendState;
+    ID3D11DepthStencilState*    pDepthStencilState;
+    ID3D11RasterizerState*      pRasterizerState;
+    ID3D11VertexShader*         pComposeVertexShader;
+    ID3D11PixelShader*          pComposePixelShader;
+    ID3D11BlendState*           pComposeBlendState;
+    ID3D11Texture2D*            pTextTexture;
+    ID3D11ShaderResourceView*   pTextView;
+    ID3D11PixelShader*          pTextPixelShader;
+    ID3D11Buffer*               pNumberConstants;   /* DrawNumberVS scale for the number atlas */
+    ID3D11Buffer*               pTextConstants;     /* and for the text atlas */
+    ID3D11VertexShader*         pWidgetVertexShader;
+    ID3D11PixelShader*          pWidgetPixelShader;
+    ID3D11Buffer*               pWidgetConstants;   /* DrawWidgetVS scale for both atlases */
+    mutable float               numberViewport[2];  /* viewport size last written to each */
+    mutable float               textViewport[2];
+    mutable float               widgetViewport[2];
 
     DrawNumberCache(ID3D11Device* p)
     {
@@ -36,6 +103,27 @@ struct DrawNumberCache
         pVertexShader = nullptr;
         pPixelShader = nullptr;
         pInputLayout = nullptr;
+        pGraphVertexShader = nullptr;
+        pGraphPixelShader = nullptr;
+        pGraphConstants = nullptr;
+        graphNoOverwrite = false;
+        pBlendState = nullptr;
+        pDepthStencilState = nullptr;
+        pRasterizerState = nullptr;
+        pComposeVertexShader = nullptr;
+        pComposePixelShader = nullptr;
+        pComposeBlendState = nullptr;
+        pTextTexture = nullptr;
+        pTextView = nullptr;
+        pTextPixelShader = nullptr;
+        pNumberConstants = nullptr;
+        pTextConstants = nullptr;
+        pWidgetVertexShader = nullptr;
+        pWidgetPixelShader = nullptr;
+        pWidgetConstants = nullptr;
+        memset(numberViewport, 0, sizeof(numberViewport));
+        memset(textViewport, 0, sizeof(textViewport));
+        memset(widgetViewport, 0, sizeof(widgetViewport));
         setup(p);
     }
     DrawNumberCache(const DrawNumberCache& that)
@@ -47,6 +135,27 @@ struct DrawNumberCache
         pVertexShader = that.pVertexShader;
         pPixelShader = that.pPixelShader;
         pInputLayout = that.pInputLayout;
+        pGraphVertexShader = that.pGraphVertexShader;
+        pGraphPixelShader = that.pGraphPixelShader;
+        pGraphConstants = that.pGraphConstants;
+        graphNoOverwrite = that.graphNoOverwrite;
+        pBlendState = that.pBlendState;
+        pDepthStencilState = that.pDepthStencilState;
+        pRasterizerState = that.pRasterizerState;
+        pComposeVertexShader = that.pComposeVertexShader;
+        pComposePixelShader = that.pComposePixelShader;
+        pComposeBlendState = that.pComposeBlendState;
+        pTextTexture = that.pTextTexture;
+        pTextView = that.pTextView;
+        pTextPixelShader = that.pTextPixelShader;
+        pNumberConstants = that.pNumberConstants;
+        pTextConstants = that.pTextConstants;
+        pWidgetVertexShader = that.pWidgetVertexShader;
+        pWidgetPixelShader = that.pWidgetPixelShader;
+        pWidgetConstants = that.pWidgetConstants;
+        memcpy(numberViewport, that.numberViewport, sizeof(numberViewport));
+        memcpy(textViewport, that.textViewport, sizeof(textViewport));
+        memcpy(widgetViewport, that.widgetViewport, sizeof(widgetViewport));
         const_cast<DrawNumberCache&>(that).pDevice = nullptr;
         const_cast<DrawNumberCache&>(that).pTexture = nullptr;
         const_cast<DrawNumberCache&>(that).pShaderResourceView = nullptr;
@@ -54,6 +163,23 @@ struct DrawNumberCache
         const_cast<DrawNumberCache&>(that).pVertexShader = nullptr;
         const_cast<DrawNumberCache&>(that).pPixelShader = nullptr;
         const_cast<DrawNumberCache&>(that).pInputLayout = nullptr;
+        const_cast<DrawNumberCache&>(that).pGraphVertexShader = nullptr;
+        const_cast<DrawNumberCache&>(that).pGraphPixelShader = nullptr;
+        const_cast<DrawNumberCache&>(that).pGraphConstants = nullptr;
+        const_cast<DrawNumberCache&>(that).pBlendState = nullptr;
+        const_cast<DrawNumberCache&>(that).pDepthStencilState = nullptr;
+        const_cast<DrawNumberCache&>(that).pRasterizerState = nullptr;
+        const_cast<DrawNumberCache&>(that).pComposeVertexShader = nullptr;
+        const_cast<DrawNumberCache&>(that).pComposePixelShader = nullptr;
+        const_cast<DrawNumberCache&>(that).pComposeBlendState = nullptr;
+        const_cast<DrawNumberCache&>(that).pTextTexture = nullptr;
+        const_cast<DrawNumberCache&>(that).pTextView = nullptr;
+        const_cast<DrawNumberCache&>(that).pTextPixelShader = nullptr;
+        const_cast<DrawNumberCache&>(that).pNumberConstants = nullptr;
+        const_cast<DrawNumberCache&>(that).pTextConstants = nullptr;
+        const_cast<DrawNumberCache&>(that).pWidgetVertexShader = nullptr;
+        const_cast<DrawNumberCache&>(that).pWidgetPixelShader = nullptr;
+        const_cast<DrawNumberCache&>(that).pWidgetConstants = nullptr;
     }
     ~DrawNumberCache()
     {
@@ -63,42 +189,184 @@ struct DrawNumberCache
         SAFE_RELEASE(pInputLayout);
         SAFE_RELEASE(pVertexShader);
         SAFE_RELEASE(pPixelShader);
+        SAFE_RELEASE(pGraphVertexShader);
+        SAFE_RELEASE(pGraphPixelShader);
+        SAFE_RELEASE(pGraphConstants);
+        SAFE_RELEASE(pBlendState);
+        SAFE_RELEASE(pDepthStencilState);
+        SAFE_RELEASE(pRasterizerState);
+        SAFE_RELEASE(pComposeVertexShader);
+        SAFE_RELEASE(pComposePixelShader);
+        SAFE_RELEASE(pComposeBlendState);
+        SAFE_RELEASE(pTextTexture);
+        SAFE_RELEASE(pTextView);
+        SAFE_RELEASE(pTextPixelShader);
+        SAFE_RELEASE(pNumberConstants);
+        SAFE_RELEASE(pTextConstants);
+        SAFE_RELEASE(pWidgetVertexShader);
+        SAFE_RELEASE(pWidgetPixelShader);
+        SAFE_RELEASE(pWidgetConstants);
         SAFE_RELEASE(pDevice);
     }
-    void beginDraw(ID3D11DeviceContext* pContext) const
+    // output merger and rasterizer state shared by the numbers and the graph, whatever the game left bound
+    void bindCommon(OverlayStateGuard& guard) const
+    {
+        guard.setBlendState(pBlendState);
+        guard.setDepthStencilState(pDepthStencilState);
+        guard.setRasterizerState(pRasterizerState);
+    }
+    // the vertices are in pixels and texels; returns the constants to bind, nullptr when they could not be written
+    ID3D11Buffer* placeNumbers(ID3D11DeviceContext* pContext, DeferredConstants* pDeferred, float width, float height) const
+    {
+        const image& atlas = OverlayGeometry::instance().numberAtlas();
+        if(pDeferred)
+            return placeQuads(pContext, pDeferred->pNumberConstants, nullptr, width, height, atlas);
+        return placeQuads(pContext, pNumberConstants, numberViewport, width, height, atlas);
+    }
+    ID3D11Buffer* placeText(ID3D11DeviceContext* pContext, DeferredConstants* pDeferred, float width, float height) const
+    {
+        const image& atlas = OverlayGeometry::instance().textAtlas();
+        if(pDeferred)
+            return placeQuads(pContext, pDeferred->pTextConstants, nullptr, width, height, atlas);
+        return placeQuads(pContext, pTextConstants, textViewport, width, height, atlas);
+    }
+    void bindNumbers(OverlayStateGuard& guard, ID3D11Buffer* pConstants, ID3D11Buffer* pVertexBuffer, ID3D11Buffer* pIndexBuffer) const
+    {
+        bindQuads(guard, pPixelShader, pShaderResourceView, pConstants, pVertexBuffer, pIndexBuffer);
+    }
+    // same vertices as the numbers, the glyph atlas is a distance field with its own pixel shader
+    void bindText(OverlayStateGuard& guard, ID3D11Buffer* pConstants, ID3D11Buffer* pVertexBuffer, ID3D11Buffer* pIndexBuffer) const
+    {
+        bindQuads(guard, pTextPixelShader, pTextView, pConstants, pVertexBuffer, pIndexBuffer);
+    }
+    void bindQuads(OverlayStateGuard& guard, ID3D11PixelShader* pShader, ID3D11ShaderResourceView* pView, ID3D11Buffer* pConstants,
+        ID3D11Buffer* pVertexBuffer, ID3D11Buffer* pIndexBuffer) const
+    {
+        bindCommon(guard);
+        guard.setVertexShader(pVertexShader);
+        guard.setPixelShader(pShader);
+        guard.setVSConstants(pConstants);
+        guard.setPSResource(pView);
+        guard.setPSSampler(pSamplerState);
+        guard.setInputLayout(pInputLayout);
+        guard.setVertexBuffer(pVertexBuffer, sizeof(DrawNumberVertex));
+        guard.setIndexBuffer(pIndexBuffer, DXGI_FORMAT_R32_UINT);
+        guard.setTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    }
+    // immediate context only, as the widgets are
+    void placeWidgets(ID3D11DeviceContext* pContext, float width, float height) const
+    {
+        if(widgetViewport[0] == width && widgetViewport[1] == height)
+            return;
+        D3D11_MAPPED_SUBRESOURCE mapped;
+        if(FAILED(pContext->Map(pWidgetConstants, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+            return;
+        const OverlayGeometry& geometry = OverlayGeometry::instance();
+        WidgetConstants constants;
+        memset(&constants, 0, sizeof(constants));
+        constants.scale[0] = 2.f / width;
+        constants.scale[1] = 2.f / height;
+        constants.atlas[0] = 1.f / (float)geometry.numberAtlas().get_width();
+        constants.atlas[1] = 1.f / (float)geometry.numberAtlas().get_height();
+        constants.atlas[2] = 1.f / (float)geometry.textAtlas().get_width();
+        constants.atlas[3] = 1.f / (float)geometry.textAtlas().get_height();
+        constants.firstText = WidgetTree::text_first * 4;
+        memcpy(mapped.pData, &constants, sizeof(constants));
+        pContext->Unmap(pWidgetConstants, 0);
+        widgetViewport[0] = width;
+        widgetViewport[1] = height;
+    }
+    // the vertices of the numbers and of the text, with both atlases bound
+    void bindWidgets(OverlayStateGuard& guard, ID3D11Buffer* pVertexBuffer, ID3D11Buffer* pIndexBuffer) const
+    {
+        bindCommon(guard);
+        guard.setVertexShader(pWidgetVertexShader);
+        guard.setPixelShader(pWidgetPixelShader);
+        guard.setVSConstants(pWidgetConstants);
+        guard.setPSResource(pShaderResourceView, 0);
+        guard.setPSResource(pTextView, 1);
+        guard.setPSSampler(pSamplerState);
+        guard.setInputLayout(pInputLayout);
+        guard.setVertexBuffer(pVertexBuffer, sizeof(DrawNumberVertex));
+        guard.setIndexBuffer(pIndexBuffer, DXGI_FORMAT_R32_UINT);
+        guard.setTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    }
+    void bindGraph(OverlayStateGuard& guard, ID3D11Buffer* pConstants, ID3D11ShaderResourceView* pSamples) const
     {
-        assert(pContext);
-        pContext->VSSetShader(pVertexShader, 0, 0);
-        pContext->PSSetShader(pPixelShader, 0, 0);
-        pContext->PSSetShaderResources(0, 1, &pShaderResourceView);
-        pContext->PSSetSamplers(0, 1, &pSamplerState);
-        pContext->IASetInputLayout(pInputLayout);
-    }
-    void endDraw(ID3D11DeviceContext* pContext) const
+        bindCommon(guard);
+        guard.setVertexShader(pGraphVertexShader);
+        guard.setPixelShader(pGraphPixelShader);
+        guard.setVSConstants(pConstants);
+        guard.setVSResource(pSamples);
+        guard.setInputLayout(nullptr);
+        guard.setTopology(D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP);
+    }
+    void bindCompose(OverlayStateGuard& guard, const HudComposite& hud) const
     {
-        assert(pContext);
-        pContext->VSSetShader(0, 0, 0);
-        pContext->PSSetShader(0, 0, 0);
-        ID3D11ShaderResourceView* pSrv = nullptr;
-        pContext->PSSetShaderResources(0, 1, &pSrv);
-        ID3D11SamplerState* pSs = nullptr;
-        pContext->PSSetSamplers(0, 1, &pSs);
-        pContext->IASetInputLayout(0);
+        guard.setBlendState(pComposeBlendState);
+        guard.setDepthStencilState(pDepthStencilState);
+        guard.setRasterizerState(pRasterizerState);
+        guard.setVertexShader(pComposeVertexShader);
+        guard.setPixelShader(pComposePixelShader);
+        guard.setVSConstants(hud.pConstants);
+        guard.setPSResource(hud.pView);
+        guard.setPSSampler(pSamplerState);
+        guard.setInputLayout(nullptr);
+        guard.setTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+    }
+    // a deferred context's copies of the constant buffers, created for its device on the first list
+    bool prepareDeferred(DeferredConstants& deferred) const
+    {
+        if(deferred.pDevice == pDevice)
+            return true;
+        deferred.release();
+        D3D11_BUFFER_DESC cbDesc;
+        ZeroMemory(&cbDesc, sizeof(cbDesc));
+        cbDesc.Usage = D3D11_USAGE_DYNAMIC;
+        cbDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+        cbDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        cbDesc.ByteWidth = 4 * sizeof(float);
+        pDevice->CreateBuffer(&cbDesc, nullptr, &deferred.pNumberConstants);
+        pDevice->CreateBuffer(&cbDesc, nullptr, &deferred.pTextConstants);
+        cbDesc.ByteWidth = sizeof(GraphConstants);
+        pDevice->CreateBuffer(&cbDesc, nullptr, &deferred.pGraphConstants);
+        if(!deferred.pNumberConstants || !deferred.pTextConstants || !deferred.pGraphConstants) {
+            deferred.release();
+            return false;
+        }
+        deferred.pDevice = pDevice;
+        deferred.pDevice->AddRef();
+        return true;
     }
 
 private:
-    void setup(ID3D11Device* p)
+    // the device's buffers are only rewritten for a viewport of another size, a deferred context's have no
+    // viewport shadow and are written into every list, which does not inherit dynamic buffer contents
+    ID3D11Buffer* placeQuads(ID3D11DeviceContext* pContext, ID3D11Buffer* pConstants, float* viewport, float width, float height, const image& atlas) const
     {
-        assert(p);
-        pDevice = p;
-        pDevice->AddRef();
+        if(viewport && viewport[0] == width && viewport[1] == height)
+            return pConstants;
+        D3D11_MAPPED_SUBRESOURCE mapped;
+        if(FAILED(pContext->Map(pConstants, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+            return nullptr;
+        float scale[4] = { 2.f / width, 2.f / height, 1.f / (float)atlas.get_width(), 1.f / (float)atlas.get_height() };
+        memcpy(mapped.pData, scale, sizeof(scale));
+        pContext->Unmap(pConstants, 0);
+        if(viewport) {
+            viewport[0] = width;
+            viewport[1] = height;
+        }
+        return pConstants;
+    }
 
+    ID3D11Texture2D* createAtlas(const image& img, const std::vector<byte>& blocks, DXGI_FORMAT format, bool compressed) const
+    {
         D3D11_TEXTURE2D_DESC desc;
-        desc.Width = g_numTextImage.get_width();
-        desc.Height = g_numTextImage.get_height();
+        desc.Width = img.get_width();
+        desc.Height = img.get_height();
         desc.MipLevels = 1;
         desc.ArraySize = 1;
-        desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+        desc.Format = compressed ? DXGI_FORMAT_BC4_UNORM : format;
         desc.SampleDesc.Count = 1;
         desc.SampleDesc.Quality = 0;
         desc.Usage = D3D11_USAGE_IMMUTABLE;
@@ -107,16 +375,39 @@ private:
         desc.MiscFlags = 0;
 
         D3D11_SUBRESOURCE_DATA subdata;
-        subdata.pSysMem = g_numTextImage.get_data(0, 0);
-        subdata.SysMemPitch = g_numTextImage.get_bytes_per_line();
+        subdata.pSysMem = compressed ? (const void*)&blocks.front() : (const void*)img.get_data(0, 0);
+        subdata.SysMemPitch = compressed ? bc4Pitch(img.get_width()) : img.get_bytes_per_line();
         subdata.SysMemSlicePitch = 0;
 
-        pDevice->CreateTexture2D(&desc, &subdata, &pTexture);
+        ID3D11Texture2D* p = nullptr;
+        pDevice->CreateTexture2D(&desc, &subdata, &p);
+        return p;
+    }
+
+    void setup(ID3D11Device* p)
+    {
+        assert(p);
+        pDevice = p;
+        pDevice->AddRef();
+
+        // every D3D11 feature level from 10_0 samples BC4; 9_x devices get the images as they are
+        UINT support = 0;
+        bool compressed = SUCCEEDED(pDevice->CheckFormatSupport(DXGI_FORMAT_BC4_UNORM, &support)) && (support & D3D11_FORMAT_SUPPORT_TEXTURE2D) &&
+            !g_numTextBlocks.empty() && !g_textFieldBlocks.empty();
+
+        const OverlayGeometry& geometry = OverlayGeometry::instance();
+        pTexture = createAtlas(geometry.numberAtlas(), g_numTextBlocks, DXGI_FORMAT_R8G8B8A8_UNORM, compressed);
         assert(pTexture);
 
         pDevice->CreateShaderResourceView(pTexture, nullptr, &pShaderResourceView);
         assert(pShaderResourceView);
 
+        pTextTexture = createAtlas(geometry.textAtlas(), g_textFieldBlocks, DXGI_FORMAT_R8_UNORM, compressed);
+        assert(pTextTexture);
+
+        pDevice->CreateShaderResourceView(pTextTexture, nullptr, &pTextView);
+        assert(pTextView);
+
         D3D11_SAMPLER_DESC sampDesc;
         sampDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
         sampDesc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
@@ -140,266 +431,121 @@ private:
         pDevice->CreatePixelShader(g_DrawNumberPS, sizeof(g_DrawNumberPS), nullptr, &pPixelShader);
         assert(pPixelShader);
 
+        pDevice->CreatePixelShader(g_DrawTextPS, sizeof(g_DrawTextPS), nullptr, &pTextPixelShader);
+        assert(pTextPixelShader);
+
+        // same input signature as DrawNumberVS, so the input layout serves both
+        pDevice->CreateVertexShader(g_DrawWidgetVS, sizeof(g_DrawWidgetVS), nullptr, &pWidgetVertexShader);
+        assert(pWidgetVertexShader);
+
+        pDevice->CreatePixelShader(g_DrawWidgetPS, sizeof(g_DrawWidgetPS), nullptr, &pWidgetPixelShader);
+        assert(pWidgetPixelShader);
+
+        // VertexInput of DrawNumber.hlsl; CreateInputLayout fails when the compiled signature does not match
         D3D11_INPUT_ELEMENT_DESC layoutDesc[] =
         {
-            { "POSITION", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+            { "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
             { "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
             { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 }
         };
         pDevice->CreateInputLayout(layoutDesc, sizeof(layoutDesc) / sizeof(layoutDesc[0]), g_DrawNumberVS, sizeof(g_DrawNumberVS), &pInputLayout);
         assert(pInputLayout);
+
+        pDevice->CreateVertexShader(g_FrameGraphVS, sizeof(g_FrameGraphVS), nullptr, &pGraphVertexShader);
+        assert(pGraphVertexShader);
+
+        pDevice->CreatePixelShader(g_FrameGraphPS, sizeof(g_FrameGraphPS), nullptr, &pGraphPixelShader);
+        assert(pGraphPixelShader);
+
+        D3D11_BUFFER_DESC cbDesc;
+        ZeroMemory(&cbDesc, sizeof(cbDesc));
+        cbDesc.Usage = D3D11_USAGE_DYNAMIC;
+        cbDesc.ByteWidth = sizeof(GraphConstants);
+        cbDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+        cbDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        pDevice->CreateBuffer(&cbDesc, nullptr, &pGraphConstants);
+        assert(pGraphConstants);
+
+        cbDesc.ByteWidth = 4 * sizeof(float);
+        pDevice->CreateBuffer(&cbDesc, nullptr, &pNumberConstants);
+        assert(pNumberConstants);
+        pDevice->CreateBuffer(&cbDesc, nullptr, &pTextConstants);
+        assert(pTextConstants);
+
+        cbDesc.ByteWidth = sizeof(WidgetConstants);
+        pDevice->CreateBuffer(&cbDesc, nullptr, &pWidgetConstants);
+        assert(pWidgetConstants);
+
+        // without it every frame rewrites the whole ring with DISCARD, still only a few hundred bytes
+        D3D11_FEATURE_DATA_D3D11_OPTIONS options;
+        ZeroMemory(&options, sizeof(options));
+        if(SUCCEEDED(pDevice->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options))))
+            graphNoOverwrite = options.MapNoOverwriteOnDynamicBufferSRV != FALSE;
+
+        // the number texture carries coverage in alpha; no depth test or culling, and no scissor from the game
+        D3D11_BLEND_DESC blendDesc;
+        ZeroMemory(&blendDesc, sizeof(blendDesc));
+        blendDesc.RenderTarget[0].BlendEnable = TRUE;
+        blendDesc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
+        blendDesc.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
+        blendDesc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
+        blendDesc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
+        blendDesc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_INV_SRC_ALPHA;
+        blendDesc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
+        blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+        pDevice->CreateBlendState(&blendDesc, &pBlendState);
+        assert(pBlendState);
+
+        D3D11_DEPTH_STENCIL_DESC depthDesc;
+        ZeroMemory(&depthDesc, sizeof(depthDesc));
+        depthDesc.DepthEnable = FALSE;
+        depthDesc.DepthWriteMask = D3D11_DEPTH_WRITE_MASK_ZERO;
+        depthDesc.DepthFunc = D3D11_COMPARISON_ALWAYS;
+        depthDesc.StencilEnable = FALSE;
+        pDevice->CreateDepthStencilState(&depthDesc, &pDepthStencilState);
+        assert(pDepthStencilState);
+
+        D3D11_RASTERIZER_DESC rasterDesc;
+        ZeroMemory(&rasterDesc, sizeof(rasterDesc));
+        rasterDesc.FillMode = D3D11_FILL_SOLID;
+        rasterDesc.CullMode = D3D11_CULL_NONE;
+        rasterDesc.DepthClipEnable = TRUE;
+        pDevice->CreateRasterizerState(&rasterDesc, &pRasterizerState);
+        assert(pRasterizerState);
+
+        pDevice->CreateVertexShader(g_ComposeVS, sizeof(g_ComposeVS), nullptr, &pComposeVertexShader);
+        assert(pComposeVertexShader);
+
+        pDevice->CreatePixelShader(g_ComposePS, sizeof(g_ComposePS), nullptr, &pComposePixelShader);
+        assert(pComposePixelShader);
+
+        // the HUD target was blended over transparent black, so its color is already multiplied by alpha
+        blendDesc.RenderTarget[0].SrcBlend = D3D11_BLEND_ONE;
+        pDevice->CreateBlendState(&blendDesc, &pComposeBlendState);
+        assert(pComposeBlendState);
     }
 };
 
 typedef std::unordered_map<ID3D11Device*, DrawNumberCache> DrawNumberCacheMap;
 
 DrawNumberCacheMap      g_drawNumberCacheMap;
-
-static const byte       g_numImageSource[] =
-{
-    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52, 
-    0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x12, 0x08, 0x02, 0x00, 0x00, 0x00, 0x35, 0xd9, 0x7c, 
-    0x16, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0e, 0xc3, 0x00, 0x00, 0x0e, 
-    0xc3, 0x01, 0xc7, 0x6f, 0xa8, 0x64, 0x00, 0x00, 0x0a, 0x4f, 0x69, 0x43, 0x43, 0x50, 0x50, 0x68, 
-    0x6f, 0x74, 0x6f, 0x73, 0x68, 0x6f, 0x70, 0x20, 0x49, 0x43, 0x43, 0x20, 0x70, 0x72, 0x6f, 0x66, 
-    0x69, 0x6c, 0x65, 0x00, 0x00, 0x78, 0xda, 0x9d, 0x53, 0x67, 0x54, 0x53, 0xe9, 0x16, 0x3d, 0xf7, 
-    0xde, 0xf4, 0x42, 0x4b, 0x88, 0x80, 0x94, 0x4b, 0x6f, 0x52, 0x15, 0x08, 0x20, 0x52, 0x42, 0x8b, 
-    0x80, 0x14, 0x91, 0x26, 0x2a, 0x21, 0x09, 0x10, 0x4a, 0x88, 0x21, 0xa1, 0xd9, 0x15, 0x51, 0xc1, 
-    0x11, 0x45, 0x45, 0x04, 0x1b, 0xc8, 0xa0, 0x88, 0x03, 0x8e, 0x8e, 0x80, 0x8c, 0x15, 0x51, 0x2c, 
-    0x0c, 0x8a, 0x0a, 0xd8, 0x07, 0xe4, 0x21, 0xa2, 0x8e, 0x83, 0xa3, 0x88, 0x8a, 0xca, 0xfb, 0xe1, 
-    0x7b, 0xa3, 0x6b, 0xd6, 0xbc, 0xf7, 0xe6, 0xcd, 0xfe, 0xb5, 0xd7, 0x3e, 0xe7, 0xac, 0xf3, 0x9d, 
-    0xb3, 0xcf, 0x07, 0xc0, 0x08, 0x0c, 0x96, 0x48, 0x33, 0x51, 0x35, 0x80, 0x0c, 0xa9, 0x42, 0x1e, 
-    0x11, 0xe0, 0x83, 0xc7, 0xc4, 0xc6, 0xe1, 0xe4, 0x2e, 0x40, 0x81, 0x0a, 0x24, 0x70, 0x00, 0x10, 
-    0x08, 0xb3, 0x64, 0x21, 0x73, 0xfd, 0x23, 0x01, 0x00, 0xf8, 0x7e, 0x3c, 0x3c, 0x2b, 0x22, 0xc0, 
-    0x07, 0xbe, 0x00, 0x01, 0x78, 0xd3, 0x0b, 0x08, 0x00, 0xc0, 0x4d, 0x9b, 0xc0, 0x30, 0x1c, 0x87, 
-    0xff, 0x0f, 0xea, 0x42, 0x99, 0x5c, 0x01, 0x80, 0x84, 0x01, 0xc0, 0x74, 0x91, 0x38, 0x4b, 0x08, 
-    0x80, 0x14, 0x00, 0x40, 0x7a, 0x8e, 0x42, 0xa6, 0x00, 0x40, 0x46, 0x01, 0x80, 0x9d, 0x98, 0x26, 
-    0x53, 0x00, 0xa0, 0x04, 0x00, 0x60, 0xcb, 0x63, 0x62, 0xe3, 0x00, 0x50, 0x2d, 0x00, 0x60, 0x27, 
-    0x7f, 0xe6, 0xd3, 0x00, 0x80, 0x9d, 0xf8, 0x99, 0x7b, 0x01, 0x00, 0x5b, 0x94, 0x21, 0x15, 0x01, 
-    0xa0, 0x91, 0x00, 0x20, 0x13, 0x65, 0x88, 0x44, 0x00, 0x68, 0x3b, 0x00, 0xac, 0xcf, 0x56, 0x8a, 
-    0x45, 0x00, 0x58, 0x30, 0x00, 0x14, 0x66, 0x4b, 0xc4, 0x39, 0x00, 0xd8, 0x2d, 0x00, 0x30, 0x49, 
-    0x57, 0x66, 0x48, 0x00, 0xb0, 0xb7, 0x00, 0xc0, 0xce, 0x10, 0x0b, 0xb2, 0x00, 0x08, 0x0c, 0x00, 
-    0x30, 0x51, 0x88, 0x85, 0x29, 0x00, 0x04, 0x7b, 0x00, 0x60, 0xc8, 0x23, 0x23, 0x78, 0x00, 0x84, 
-    0x99, 0x00, 0x14, 0x46, 0xf2, 0x57, 0x3c, 0xf1, 0x2b, 0xae, 0x10, 0xe7, 0x2a, 0x00, 0x00, 0x78, 
-    0x99, 0xb2, 0x3c, 0xb9, 0x24, 0x39, 0x45, 0x81, 0x5b, 0x08, 0x2d, 0x71, 0x07, 0x57, 0x57, 0x2e, 
-    0x1e, 0x28, 0xce, 0x49, 0x17, 0x2b, 0x14, 0x36, 0x61, 0x02, 0x61, 0x9a, 0x40, 0x2e, 0xc2, 0x79, 
-    0x99, 0x19, 0x32, 0x81, 0x34, 0x0f, 0xe0, 0xf3, 0xcc, 0x00, 0x00, 0xa0, 0x91, 0x15, 0x11, 0xe0, 
-    0x83, 0xf3, 0xfd, 0x78, 0xce, 0x0e, 0xae, 0xce, 0xce, 0x36, 0x8e, 0xb6, 0x0e, 0x5f, 0x2d, 0xea, 
-    0xbf, 0x06, 0xff, 0x22, 0x62, 0x62, 0xe3, 0xfe, 0xe5, 0xcf, 0xab, 0x70, 0x40, 0x00, 0x00, 0xe1, 
-    0x74, 0x7e, 0xd1, 0xfe, 0x2c, 0x2f, 0xb3, 0x1a, 0x80, 0x3b, 0x06, 0x80, 0x6d, 0xfe, 0xa2, 0x25, 
-    0xee, 0x04, 0x68, 0x5e, 0x0b, 0xa0, 0x75, 0xf7, 0x8b, 0x66, 0xb2, 0x0f, 0x40, 0xb5, 0x00, 0xa0, 
-    0xe9, 0xda, 0x57, 0xf3, 0x70, 0xf8, 0x7e, 0x3c, 0x3c, 0x45, 0xa1, 0x90, 0xb9, 0xd9, 0xd9, 0xe5, 
-    0xe4, 0xe4, 0xd8, 0x4a, 0xc4, 0x42, 0x5b, 0x61, 0xca, 0x57, 0x7d, 0xfe, 0x67, 0xc2, 0x5f, 0xc0, 
-    0x57, 0xfd, 0x6c, 0xf9, 0x7e, 0x3c, 0xfc, 0xf7, 0xf5, 0xe0, 0xbe, 0xe2, 0x24, 0x81, 0x32, 0x5d, 
-    0x81, 0x47, 0x04, 0xf8, 0xe0, 0xc2, 0xcc, 0xf4, 0x4c, 0xa5, 0x1c, 0xcf, 0x92, 0x09, 0x84, 0x62, 
-    0xdc, 0xe6, 0x8f, 0x47, 0xfc, 0xb7, 0x0b, 0xff, 0xfc, 0x1d, 0xd3, 0x22, 0xc4, 0x49, 0x62, 0xb9, 
-    0x58, 0x2a, 0x14, 0xe3, 0x51, 0x12, 0x71, 0x8e, 0x44, 0x9a, 0x8c, 0xf3, 0x32, 0xa5, 0x22, 0x89, 
-    0x42, 0x92, 0x29, 0xc5, 0x25, 0xd2, 0xff, 0x64, 0xe2, 0xdf, 0x2c, 0xfb, 0x03, 0x3e, 0xdf, 0x35, 
-    0x00, 0xb0, 0x6a, 0x3e, 0x01, 0x7b, 0x91, 0x2d, 0xa8, 0x5d, 0x63, 0x03, 0xf6, 0x4b, 0x27, 0x10, 
-    0x58, 0x74, 0xc0, 0xe2, 0xf7, 0x00, 0x00, 0xf2, 0xbb, 0x6f, 0xc1, 0xd4, 0x28, 0x08, 0x03, 0x80, 
-    0x68, 0x83, 0xe1, 0xcf, 0x77, 0xff, 0xef, 0x3f, 0xfd, 0x47, 0xa0, 0x25, 0x00, 0x80, 0x66, 0x49, 
-    0x92, 0x71, 0x00, 0x00, 0x5e, 0x44, 0x24, 0x2e, 0x54, 0xca, 0xb3, 0x3f, 0xc7, 0x08, 0x00, 0x00, 
-    0x44, 0xa0, 0x81, 0x2a, 0xb0, 0x41, 0x1b, 0xf4, 0xc1, 0x18, 0x2c, 0xc0, 0x06, 0x1c, 0xc1, 0x05, 
-    0xdc, 0xc1, 0x0b, 0xfc, 0x60, 0x36, 0x84, 0x42, 0x24, 0xc4, 0xc2, 0x42, 0x10, 0x42, 0x0a, 0x64, 
-    0x80, 0x1c, 0x72, 0x60, 0x29, 0xac, 0x82, 0x42, 0x28, 0x86, 0xcd, 0xb0, 0x1d, 0x2a, 0x60, 0x2f, 
-    0xd4, 0x40, 0x1d, 0x34, 0xc0, 0x51, 0x68, 0x86, 0x93, 0x70, 0x0e, 0x2e, 0xc2, 0x55, 0xb8, 0x0e, 
-    0x3d, 0x70, 0x0f, 0xfa, 0x61, 0x08, 0x9e, 0xc1, 0x28, 0xbc, 0x81, 0x09, 0x04, 0x41, 0xc8, 0x08, 
-    0x13, 0x61, 0x21, 0xda, 0x88, 0x01, 0x62, 0x8a, 0x58, 0x23, 0x8e, 0x08, 0x17, 0x99, 0x85, 0xf8, 
-    0x21, 0xc1, 0x48, 0x04, 0x12, 0x8b, 0x24, 0x20, 0xc9, 0x88, 0x14, 0x51, 0x22, 0x4b, 0x91, 0x35, 
-    0x48, 0x31, 0x52, 0x8a, 0x54, 0x20, 0x55, 0x48, 0x1d, 0xf2, 0x3d, 0x72, 0x02, 0x39, 0x87, 0x5c, 
-    0x46, 0xba, 0x91, 0x3b, 0xc8, 0x00, 0x32, 0x82, 0xfc, 0x86, 0xbc, 0x47, 0x31, 0x94, 0x81, 0xb2, 
-    0x51, 0x3d, 0xd4, 0x0c, 0xb5, 0x43, 0xb9, 0xa8, 0x37, 0x1a, 0x84, 0x46, 0xa2, 0x0b, 0xd0, 0x64, 
-    0x74, 0x31, 0x9a, 0x8f, 0x16, 0xa0, 0x9b, 0xd0, 0x72, 0xb4, 0x1a, 0x3d, 0x8c, 0x36, 0xa1, 0xe7, 
-    0xd0, 0xab, 0x68, 0x0f, 0xda, 0x8f, 0x3e, 0x43, 0xc7, 0x30, 0xc0, 0xe8, 0x18, 0x07, 0x33, 0xc4, 
-    0x6c, 0x30, 0x2e, 0xc6, 0xc3, 0x42, 0xb1, 0x38, 0x2c, 0x09, 0x93, 0x63, 0xcb, 0xb1, 0x22, 0xac, 
-    0x0c, 0xab, 0xc6, 0x1a, 0xb0, 0x56, 0xac, 0x03, 0xbb, 0x89, 0xf5, 0x63, 0xcf, 0xb1, 0x77, 0x04, 
-    0x12, 0x81, 0x45, 0xc0, 0x09, 0x36, 0x04, 0x77, 0x42, 0x20, 0x61, 0x1e, 0x41, 0x48, 0x58, 0x4c, 
-    0x58, 0x4e, 0xd8, 0x48, 0xa8, 0x20, 0x1c, 0x24, 0x34, 0x11, 0xda, 0x09, 0x37, 0x09, 0x03, 0x84, 
-    0x51, 0xc2, 0x27, 0x22, 0x93, 0xa8, 0x4b, 0xb4, 0x26, 0xba, 0x11, 0xf9, 0xc4, 0x18, 0x62, 0x32, 
-    0x31, 0x87, 0x58, 0x48, 0x2c, 0x23, 0xd6, 0x12, 0x8f, 0x13, 0x2f, 0x10, 0x7b, 0x88, 0x43, 0xc4, 
-    0x37, 0x24, 0x12, 0x89, 0x43, 0x32, 0x27, 0xb9, 0x90, 0x02, 0x49, 0xb1, 0xa4, 0x54, 0xd2, 0x12, 
-    0xd2, 0x46, 0xd2, 0x6e, 0x52, 0x23, 0xe9, 0x2c, 0xa9, 0x9b, 0x34, 0x48, 0x1a, 0x23, 0x93, 0xc9, 
-    0xda, 0x64, 0x6b, 0xb2, 0x07, 0x39, 0x94, 0x2c, 0x20, 0x2b, 0xc8, 0x85, 0xe4, 0x9d, 0xe4, 0xc3, 
-    0xe4, 0x33, 0xe4, 0x1b, 0xe4, 0x21, 0xf2, 0x5b, 0x0a, 0x9d, 0x62, 0x40, 0x71, 0xa4, 0xf8, 0x53, 
-    0xe2, 0x28, 0x52, 0xca, 0x6a, 0x4a, 0x19, 0xe5, 0x10, 0xe5, 0x34, 0xe5, 0x06, 0x65, 0x98, 0x32, 
-    0x41, 0x55, 0xa3, 0x9a, 0x52, 0xdd, 0xa8, 0xa1, 0x54, 0x11, 0x35, 0x8f, 0x5a, 0x42, 0xad, 0xa1, 
-    0xb6, 0x52, 0xaf, 0x51, 0x87, 0xa8, 0x13, 0x34, 0x75, 0x9a, 0x39, 0xcd, 0x83, 0x16, 0x49, 0x4b, 
-    0xa5, 0xad, 0xa2, 0x95, 0xd3, 0x1a, 0x68, 0x17, 0x68, 0xf7, 0x69, 0xaf, 0xe8, 0x74, 0xba, 0x11, 
-    0xdd, 0x95, 0x1e, 0x4e, 0x97, 0xd0, 0x57, 0xd2, 0xcb, 0xe9, 0x47, 0xe8, 0x97, 0xe8, 0x03, 0xf4, 
-    0x77, 0x0c, 0x0d, 0x86, 0x15, 0x83, 0xc7, 0x88, 0x67, 0x28, 0x19, 0x9b, 0x18, 0x07, 0x18, 0x67, 
-    0x19, 0x77, 0x18, 0xaf, 0x98, 0x4c, 0xa6, 0x19, 0xd3, 0x8b, 0x19, 0xc7, 0x54, 0x30, 0x37, 0x31, 
-    0xeb, 0x98, 0xe7, 0x99, 0x0f, 0x99, 0x6f, 0x55, 0x58, 0x2a, 0xb6, 0x2a, 0x7c, 0x15, 0x91, 0xca, 
-    0x0a, 0x95, 0x4a, 0x95, 0x26, 0x95, 0x1b, 0x2a, 0x2f, 0x54, 0xa9, 0xaa, 0xa6, 0xaa, 0xde, 0xaa, 
-    0x0b, 0x55, 0xf3, 0x55, 0xcb, 0x54, 0x8f, 0xa9, 0x5e, 0x53, 0x7d, 0xae, 0x46, 0x55, 0x33, 0x53, 
-    0xe3, 0xa9, 0x09, 0xd4, 0x96, 0xab, 0x55, 0xaa, 0x9d, 0x50, 0xeb, 0x53, 0x1b, 0x53, 0x67, 0xa9, 
-    0x3b, 0xa8, 0x87, 0xaa, 0x67, 0xa8, 0x6f, 0x54, 0x3f, 0xa4, 0x7e, 0x59, 0xfd, 0x89, 0x06, 0x59, 
-    0xc3, 0x4c, 0xc3, 0x4f, 0x43, 0xa4, 0x51, 0xa0, 0xb1, 0x5f, 0xe3, 0xbc, 0xc6, 0x20, 0x0b, 0x63, 
-    0x19, 0xb3, 0x78, 0x2c, 0x21, 0x6b, 0x0d, 0xab, 0x86, 0x75, 0x81, 0x35, 0xc4, 0x26, 0xb1, 0xcd, 
-    0xd9, 0x7c, 0x76, 0x2a, 0xbb, 0x98, 0xfd, 0x1d, 0xbb, 0x8b, 0x3d, 0xaa, 0xa9, 0xa1, 0x39, 0x43, 
-    0x33, 0x4a, 0x33, 0x57, 0xb3, 0x52, 0xf3, 0x94, 0x66, 0x3f, 0x07, 0xe3, 0x98, 0x71, 0xf8, 0x9c, 
-    0x74, 0x4e, 0x09, 0xe7, 0x28, 0xa7, 0x97, 0xf3, 0x7e, 0x8a, 0xde, 0x14, 0xef, 0x29, 0xe2, 0x29, 
-    0x1b, 0xa6, 0x34, 0x4c, 0xb9, 0x31, 0x65, 0x5c, 0x6b, 0xaa, 0x96, 0x97, 0x96, 0x58, 0xab, 0x48, 
-    0xab, 0x51, 0xab, 0x47, 0xeb, 0xbd, 0x36, 0xae, 0xed, 0xa7, 0x9d, 0xa6, 0xbd, 0x45, 0xbb, 0x59, 
-    0xfb, 0x81, 0x0e, 0x41, 0xc7, 0x4a, 0x27, 0x5c, 0x27, 0x47, 0x67, 0x8f, 0xce, 0x05, 0x9d, 0xe7, 
-    0x53, 0xd9, 0x53, 0xdd, 0xa7, 0x0a, 0xa7, 0x16, 0x4d, 0x3d, 0x3a, 0xf5, 0xae, 0x2e, 0xaa, 0x6b, 
-    0xa5, 0x1b, 0xa1, 0xbb, 0x44, 0x77, 0xbf, 0x6e, 0xa7, 0xee, 0x98, 0x9e, 0xbe, 0x5e, 0x80, 0x9e, 
-    0x4c, 0x6f, 0xa7, 0xde, 0x79, 0xbd, 0xe7, 0xfa, 0x1c, 0x7d, 0x2f, 0xfd, 0x54, 0xfd, 0x6d, 0xfa, 
-    0xa7, 0xf5, 0x47, 0x0c, 0x58, 0x06, 0xb3, 0x0c, 0x24, 0x06, 0xdb, 0x0c, 0xce, 0x18, 0x3c, 0xc5, 
-    0x35, 0x71, 0x6f, 0x3c, 0x1d, 0x2f, 0xc7, 0xdb, 0xf1, 0x51, 0x43, 0x5d, 0xc3, 0x40, 0x43, 0xa5, 
-    0x61, 0x95, 0x61, 0x97, 0xe1, 0x84, 0x91, 0xb9, 0xd1, 0x3c, 0xa3, 0xd5, 0x46, 0x8d, 0x46, 0x0f, 
-    0x8c, 0x69, 0xc6, 0x5c, 0xe3, 0x24, 0xe3, 0x6d, 0xc6, 0x6d, 0xc6, 0xa3, 0x26, 0x06, 0x26, 0x21, 
-    0x26, 0x4b, 0x4d, 0xea, 0x4d, 0xee, 0x9a, 0x52, 0x4d, 0xb9, 0xa6, 0x29, 0xa6, 0x3b, 0x4c, 0x3b, 
-    0x4c, 0xc7, 0xcd, 0xcc, 0xcd, 0xa2, 0xcd, 0xd6, 0x99, 0x35, 0x9b, 0x3d, 0x31, 0xd7, 0x32, 0xe7, 
-    0x9b, 0xe7, 0x9b, 0xd7, 0x9b, 0xdf, 0xb7, 0x60, 0x5a, 0x78, 0x5a, 0x2c, 0xb6, 0xa8, 0xb6, 0xb8, 
-    0x65, 0x49, 0xb2, 0xe4, 0x5a, 0xa6, 0x59, 0xee, 0xb6, 0xbc, 0x6e, 0x85, 0x5a, 0x39, 0x59, 0xa5, 
-    0x58, 0x55, 0x5a, 0x5d, 0xb3, 0x46, 0xad, 0x9d, 0xad, 0x25, 0xd6, 0xbb, 0xad, 0xbb, 0xa7, 0x11, 
-    0xa7, 0xb9, 0x4e, 0x93, 0x4e, 0xab, 0x9e, 0xd6, 0x67, 0xc3, 0xb0, 0xf1, 0xb6, 0xc9, 0xb6, 0xa9, 
-    0xb7, 0x19, 0xb0, 0xe5, 0xd8, 0x06, 0xdb, 0xae, 0xb6, 0x6d, 0xb6, 0x7d, 0x61, 0x67, 0x62, 0x17, 
-    0x67, 0xb7, 0xc5, 0xae, 0xc3, 0xee, 0x93, 0xbd, 0x93, 0x7d, 0xba, 0x7d, 0x8d, 0xfd, 0x3d, 0x07, 
-    0x0d, 0x87, 0xd9, 0x0e, 0xab, 0x1d, 0x5a, 0x1d, 0x7e, 0x73, 0xb4, 0x72, 0x14, 0x3a, 0x56, 0x3a, 
-    0xde, 0x9a, 0xce, 0x9c, 0xee, 0x3f, 0x7d, 0xc5, 0xf4, 0x96, 0xe9, 0x2f, 0x67, 0x58, 0xcf, 0x10, 
-    0xcf, 0xd8, 0x33, 0xe3, 0xb6, 0x13, 0xcb, 0x29, 0xc4, 0x69, 0x9d, 0x53, 0x9b, 0xd3, 0x47, 0x67, 
-    0x17, 0x67, 0xb9, 0x73, 0x83, 0xf3, 0x88, 0x8b, 0x89, 0x4b, 0x82, 0xcb, 0x2e, 0x97, 0x3e, 0x2e, 
-    0x9b, 0x1b, 0xc6, 0xdd, 0xc8, 0xbd, 0xe4, 0x4a, 0x74, 0xf5, 0x71, 0x5d, 0xe1, 0x7a, 0xd2, 0xf5, 
-    0x9d, 0x9b, 0xb3, 0x9b, 0xc2, 0xed, 0xa8, 0xdb, 0xaf, 0xee, 0x36, 0xee, 0x69, 0xee, 0x87, 0xdc, 
-    0x9f, 0xcc, 0x34, 0x9f, 0x29, 0x9e, 0x59, 0x33, 0x73, 0xd0, 0xc3, 0xc8, 0x43, 0xe0, 0x51, 0xe5, 
-    0xd1, 0x3f, 0x0b, 0x9f, 0x95, 0x30, 0x6b, 0xdf, 0xac, 0x7e, 0x4f, 0x43, 0x4f, 0x81, 0x67, 0xb5, 
-    0xe7, 0x23, 0x2f, 0x63, 0x2f, 0x91, 0x57, 0xad, 0xd7, 0xb0, 0xb7, 0xa5, 0x77, 0xaa, 0xf7, 0x61, 
-    0xef, 0x17, 0x3e, 0xf6, 0x3e, 0x72, 0x9f, 0xe3, 0x3e, 0xe3, 0x3c, 0x37, 0xde, 0x32, 0xde, 0x59, 
-    0x5f, 0xcc, 0x37, 0xc0, 0xb7, 0xc8, 0xb7, 0xcb, 0x4f, 0xc3, 0x6f, 0x9e, 0x5f, 0x85, 0xdf, 0x43, 
-    0x7f, 0x23, 0xff, 0x64, 0xff, 0x7a, 0xff, 0xd1, 0x00, 0xa7, 0x80, 0x25, 0x01, 0x67, 0x03, 0x89, 
-    0x81, 0x41, 0x81, 0x5b, 0x02, 0xfb, 0xf8, 0x7a, 0x7c, 0x21, 0xbf, 0x8e, 0x3f, 0x3a, 0xdb, 0x65, 
-    0xf6, 0xb2, 0xd9, 0xed, 0x41, 0x8c, 0xa0, 0xb9, 0x41, 0x15, 0x41, 0x8f, 0x82, 0xad, 0x82, 0xe5, 
-    0xc1, 0xad, 0x21, 0x68, 0xc8, 0xec, 0x90, 0xad, 0x21, 0xf7, 0xe7, 0x98, 0xce, 0x91, 0xce, 0x69, 
-    0x0e, 0x85, 0x50, 0x7e, 0xe8, 0xd6, 0xd0, 0x07, 0x61, 0xe6, 0x61, 0x8b, 0xc3, 0x7e, 0x0c, 0x27, 
-    0x85, 0x87, 0x85, 0x57, 0x86, 0x3f, 0x8e, 0x70, 0x88, 0x58, 0x1a, 0xd1, 0x31, 0x97, 0x35, 0x77, 
-    0xd1, 0xdc, 0x43, 0x73, 0xdf, 0x44, 0xfa, 0x44, 0x96, 0x44, 0xde, 0x9b, 0x67, 0x31, 0x4f, 0x39, 
-    0xaf, 0x2d, 0x4a, 0x35, 0x2a, 0x3e, 0xaa, 0x2e, 0x6a, 0x3c, 0xda, 0x37, 0xba, 0x34, 0xba, 0x3f, 
-    0xc6, 0x2e, 0x66, 0x59, 0xcc, 0xd5, 0x58, 0x9d, 0x58, 0x49, 0x6c, 0x4b, 0x1c, 0x39, 0x2e, 0x2a, 
-    0xae, 0x36, 0x6e, 0x6c, 0xbe, 0xdf, 0xfc, 0xed, 0xf3, 0x87, 0xe2, 0x9d, 0xe2, 0x0b, 0xe3, 0x7b, 
-    0x17, 0x98, 0x2f, 0xc8, 0x5d, 0x70, 0x79, 0xa1, 0xce, 0xc2, 0xf4, 0x85, 0xa7, 0x16, 0xa9, 0x2e, 
-    0x12, 0x2c, 0x3a, 0x96, 0x40, 0x4c, 0x88, 0x4e, 0x38, 0x94, 0xf0, 0x41, 0x10, 0x2a, 0xa8, 0x16, 
-    0x8c, 0x25, 0xf2, 0x13, 0x77, 0x25, 0x8e, 0x0a, 0x79, 0xc2, 0x1d, 0xc2, 0x67, 0x22, 0x2f, 0xd1, 
-    0x36, 0xd1, 0x88, 0xd8, 0x43, 0x5c, 0x2a, 0x1e, 0x4e, 0xf2, 0x48, 0x2a, 0x4d, 0x7a, 0x92, 0xec, 
-    0x91, 0xbc, 0x35, 0x79, 0x24, 0xc5, 0x33, 0xa5, 0x2c, 0xe5, 0xb9, 0x84, 0x27, 0xa9, 0x90, 0xbc, 
-    0x4c, 0x0d, 0x4c, 0xdd, 0x9b, 0x3a, 0x9e, 0x16, 0x9a, 0x76, 0x20, 0x6d, 0x32, 0x3d, 0x3a, 0xbd, 
-    0x31, 0x83, 0x92, 0x91, 0x90, 0x71, 0x42, 0xaa, 0x21, 0x4d, 0x93, 0xb6, 0x67, 0xea, 0x67, 0xe6, 
-    0x66, 0x76, 0xcb, 0xac, 0x65, 0x85, 0xb2, 0xfe, 0xc5, 0x6e, 0x8b, 0xb7, 0x2f, 0x1e, 0x95, 0x07, 
-    0xc9, 0x6b, 0xb3, 0x90, 0xac, 0x05, 0x59, 0x2d, 0x0a, 0xb6, 0x42, 0xa6, 0xe8, 0x54, 0x5a, 0x28, 
-    0xd7, 0x2a, 0x07, 0xb2, 0x67, 0x65, 0x57, 0x66, 0xbf, 0xcd, 0x89, 0xca, 0x39, 0x96, 0xab, 0x9e, 
-    0x2b, 0xcd, 0xed, 0xcc, 0xb3, 0xca, 0xdb, 0x90, 0x37, 0x9c, 0xef, 0x9f, 0xff, 0xed, 0x12, 0xc2, 
-    0x12, 0xe1, 0x92, 0xb6, 0xa5, 0x86, 0x4b, 0x57, 0x2d, 0x1d, 0x58, 0xe6, 0xbd, 0xac, 0x6a, 0x39, 
-    0xb2, 0x3c, 0x71, 0x79, 0xdb, 0x0a, 0xe3, 0x15, 0x05, 0x2b, 0x86, 0x56, 0x06, 0xac, 0x3c, 0xb8, 
-    0x8a, 0xb6, 0x2a, 0x6d, 0xd5, 0x4f, 0xab, 0xed, 0x57, 0x97, 0xae, 0x7e, 0xbd, 0x26, 0x7a, 0x4d, 
-    0x6b, 0x81, 0x5e, 0xc1, 0xca, 0x82, 0xc1, 0xb5, 0x01, 0x6b, 0xeb, 0x0b, 0x55, 0x0a, 0xe5, 0x85, 
-    0x7d, 0xeb, 0xdc, 0xd7, 0xed, 0x5d, 0x4f, 0x58, 0x2f, 0x59, 0xdf, 0xb5, 0x61, 0xfa, 0x86, 0x9d, 
-    0x1b, 0x3e, 0x15, 0x89, 0x8a, 0xae, 0x14, 0xdb, 0x17, 0x97, 0x15, 0x7f, 0xd8, 0x28, 0xdc, 0x78, 
-    0xe5, 0x1b, 0x87, 0x6f, 0xca, 0xbf, 0x99, 0xdc, 0x94, 0xb4, 0xa9, 0xab, 0xc4, 0xb9, 0x64, 0xcf, 
-    0x66, 0xd2, 0x66, 0xe9, 0xe6, 0xde, 0x2d, 0x9e, 0x5b, 0x0e, 0x96, 0xaa, 0x97, 0xe6, 0x97, 0x0e, 
-    0x6e, 0x0d, 0xd9, 0xda, 0xb4, 0x0d, 0xdf, 0x56, 0xb4, 0xed, 0xf5, 0xf6, 0x45, 0xdb, 0x2f, 0x97, 
-    0xcd, 0x28, 0xdb, 0xbb, 0x83, 0xb6, 0x43, 0xb9, 0xa3, 0xbf, 0x3c, 0xb8, 0xbc, 0x65, 0xa7, 0xc9, 
-    0xce, 0xcd, 0x3b, 0x3f, 0x54, 0xa4, 0x54, 0xf4, 0x54, 0xfa, 0x54, 0x36, 0xee, 0xd2, 0xdd, 0xb5, 
-    0x61, 0xd7, 0xf8, 0x6e, 0xd1, 0xee, 0x1b, 0x7b, 0xbc, 0xf6, 0x34, 0xec, 0xd5, 0xdb, 0x5b, 0xbc, 
-    0xf7, 0xfd, 0x3e, 0xc9, 0xbe, 0xdb, 0x55, 0x01, 0x55, 0x4d, 0xd5, 0x66, 0xd5, 0x65, 0xfb, 0x49, 
-    0xfb, 0xb3, 0xf7, 0x3f, 0xae, 0x89, 0xaa, 0xe9, 0xf8, 0x96, 0xfb, 0x6d, 0x5d, 0xad, 0x4e, 0x6d, 
-    0x71, 0xed, 0xc7, 0x03, 0xd2, 0x03, 0xfd, 0x07, 0x23, 0x0e, 0xb6, 0xd7, 0xb9, 0xd4, 0xd5, 0x1d, 
-    0xd2, 0x3d, 0x54, 0x52, 0x8f, 0xd6, 0x2b, 0xeb, 0x47, 0x0e, 0xc7, 0x1f, 0xbe, 0xfe, 0x9d, 0xef, 
-    0x77, 0x2d, 0x0d, 0x36, 0x0d, 0x55, 0x8d, 0x9c, 0xc6, 0xe2, 0x23, 0x70, 0x44, 0x79, 0xe4, 0xe9, 
-    0xf7, 0x09, 0xdf, 0xf7, 0x1e, 0x0d, 0x3a, 0xda, 0x76, 0x8c, 0x7b, 0xac, 0xe1, 0x07, 0xd3, 0x1f, 
-    0x76, 0x1d, 0x67, 0x1d, 0x2f, 0x6a, 0x42, 0x9a, 0xf2, 0x9a, 0x46, 0x9b, 0x53, 0x9a, 0xfb, 0x5b, 
-    0x62, 0x5b, 0xba, 0x4f, 0xcc, 0x3e, 0xd1, 0xd6, 0xea, 0xde, 0x7a, 0xfc, 0x47, 0xdb, 0x1f, 0x0f, 
-    0x9c, 0x34, 0x3c, 0x59, 0x79, 0x4a, 0xf3, 0x54, 0xc9, 0x69, 0xda, 0xe9, 0x82, 0xd3, 0x93, 0x67, 
-    0xf2, 0xcf, 0x8c, 0x9d, 0x95, 0x9d, 0x7d, 0x7e, 0x2e, 0xf9, 0xdc, 0x60, 0xdb, 0xa2, 0xb6, 0x7b, 
-    0xe7, 0x63, 0xce, 0xdf, 0x6a, 0x0f, 0x6f, 0xef, 0xba, 0x10, 0x74, 0xe1, 0xd2, 0x45, 0xff, 0x8b, 
-    0xe7, 0x3b, 0xbc, 0x3b, 0xce, 0x5c, 0xf2, 0xb8, 0x74, 0xf2, 0xb2, 0xdb, 0xe5, 0x13, 0x57, 0xb8, 
-    0x57, 0x9a, 0xaf, 0x3a, 0x5f, 0x6d, 0xea, 0x74, 0xea, 0x3c, 0xfe, 0x93, 0xd3, 0x4f, 0xc7, 0xbb, 
-    0x9c, 0xbb, 0x9a, 0xae, 0xb9, 0x5c, 0x6b, 0xb9, 0xee, 0x7a, 0xbd, 0xb5, 0x7b, 0x66, 0xf7, 0xe9, 
-    0x1b, 0x9e, 0x37, 0xce, 0xdd, 0xf4, 0xbd, 0x79, 0xf1, 0x16, 0xff, 0xd6, 0xd5, 0x9e, 0x39, 0x3d, 
-    0xdd, 0xbd, 0xf3, 0x7a, 0x6f, 0xf7, 0xc5, 0xf7, 0xf5, 0xdf, 0x16, 0xdd, 0x7e, 0x72, 0x27, 0xfd, 
-    0xce, 0xcb, 0xbb, 0xd9, 0x77, 0x27, 0xee, 0xad, 0xbc, 0x4f, 0xbc, 0x5f, 0xf4, 0x40, 0xed, 0x41, 
-    0xd9, 0x43, 0xdd, 0x87, 0xd5, 0x3f, 0x5b, 0xfe, 0xdc, 0xd8, 0xef, 0xdc, 0x7f, 0x6a, 0xc0, 0x77, 
-    0xa0, 0xf3, 0xd1, 0xdc, 0x47, 0xf7, 0x06, 0x85, 0x83, 0xcf, 0xfe, 0x91, 0xf5, 0x8f, 0x0f, 0x43, 
-    0x05, 0x8f, 0x99, 0x8f, 0xcb, 0x86, 0x0d, 0x86, 0xeb, 0x9e, 0x38, 0x3e, 0x39, 0x39, 0xe2, 0x3f, 
-    0x72, 0xfd, 0xe9, 0xfc, 0xa7, 0x43, 0xcf, 0x64, 0xcf, 0x26, 0x9e, 0x17, 0xfe, 0xa2, 0xfe, 0xcb, 
-    0xae, 0x17, 0x16, 0x2f, 0x7e, 0xf8, 0xd5, 0xeb, 0xd7, 0xce, 0xd1, 0x98, 0xd1, 0xa1, 0x97, 0xf2, 
-    0x97, 0x93, 0xbf, 0x6d, 0x7c, 0xa5, 0xfd, 0xea, 0xc0, 0xeb, 0x19, 0xaf, 0xdb, 0xc6, 0xc2, 0xc6, 
-    0x1e, 0xbe, 0xc9, 0x78, 0x33, 0x31, 0x5e, 0xf4, 0x56, 0xfb, 0xed, 0xc1, 0x77, 0xdc, 0x77, 0x1d, 
-    0xef, 0xa3, 0xdf, 0x0f, 0x4f, 0xe4, 0x7c, 0x20, 0x7f, 0x28, 0xff, 0x68, 0xf9, 0xb1, 0xf5, 0x53, 
-    0xd0, 0xa7, 0xfb, 0x93, 0x19, 0x93, 0x93, 0xff, 0x04, 0x03, 0x98, 0xf3, 0xfc, 0x63, 0x33, 0x2d, 
-    0xdb, 0x00, 0x00, 0x00, 0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x80, 
-    0x83, 0x00, 0x00, 0xf9, 0xff, 0x00, 0x00, 0x80, 0xe9, 0x00, 0x00, 0x75, 0x30, 0x00, 0x00, 0xea, 
-    0x60, 0x00, 0x00, 0x3a, 0x98, 0x00, 0x00, 0x17, 0x6f, 0x92, 0x5f, 0xc5, 0x46, 0x00, 0x00, 0x02, 
-    0x39, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xec, 0x98, 0xcb, 0x81, 0xc4, 0x20, 0x08, 0x40, 0xa7, 
-    0x2e, 0x0a, 0xa2, 0x1e, 0xab, 0xa1, 0x19, 0x8a, 0x71, 0x0f, 0x89, 0x86, 0x9f, 0xa0, 0xf3, 0xb9, 
-    0xad, 0xc7, 0x04, 0x11, 0x9e, 0x08, 0xe8, 0xeb, 0xf5, 0x3f, 0xbe, 0x3d, 0x00, 0x89, 0xb9, 0x5f, 
-    0x83, 0x99, 0x10, 0x16, 0x62, 0x8d, 0x7b, 0xef, 0x84, 0xf6, 0x33, 0x60, 0x7b, 0xe6, 0xf7, 0xce, 
-    0xd4, 0xb4, 0x06, 0x27, 0xc0, 0xd4, 0x20, 0xb1, 0xa6, 0x71, 0xef, 0xbd, 0xb3, 0x90, 0x41, 0xea, 
-    0xf1, 0xb0, 0xc6, 0xe8, 0x95, 0xa6, 0x8a, 0xe5, 0x7c, 0xad, 0x03, 0x1a, 0x25, 0x6e, 0xdc, 0xa0, 
-    0x92, 0xff, 0xb7, 0xe5, 0x6a, 0xb0, 0x77, 0x15, 0xa0, 0x51, 0x6c, 0x7d, 0x30, 0x5f, 0x49, 0xc5, 
-    0x02, 0x7e, 0x4b, 0x8c, 0xd7, 0xc7, 0x28, 0xa5, 0x9f, 0x6f, 0xa0, 0x0c, 0x65, 0x2a, 0x23, 0x94, 
-    0x13, 0x38, 0x00, 0xc1, 0xb0, 0xa7, 0x40, 0xe1, 0x51, 0x12, 0x13, 0x02, 0x58, 0x87, 0xa6, 0x9c, 
-    0x11, 0x98, 0x4b, 0x44, 0xfb, 0x25, 0x96, 0xf2, 0x5e, 0x70, 0x16, 0xcb, 0x43, 0x69, 0x10, 0x4b, 
-    0x45, 0xfc, 0x13, 0x8a, 0xe9, 0x6d, 0x72, 0x68, 0xda, 0x0d, 0xc3, 0x69, 0x9a, 0xfa, 0xe0, 0xb8, 
-    0x24, 0x02, 0xb8, 0x32, 0xec, 0x79, 0x23, 0x9a, 0x9c, 0x85, 0x99, 0xe3, 0xc1, 0xaa, 0x62, 0x9a, 
-    0x9f, 0x5f, 0xa2, 0xbc, 0x6d, 0xac, 0x6d, 0x73, 0x56, 0x5c, 0x4a, 0xa3, 0x05, 0xa4, 0xce, 0xd0, 
-    0x25, 0x3d, 0x29, 0xf4, 0x29, 0xfc, 0x98, 0x7c, 0x3f, 0x46, 0x19, 0x09, 0x08, 0xe5, 0xe7, 0x28, 
-    0x17, 0x59, 0x7c, 0x37, 0x24, 0x33, 0x0e, 0x12, 0xb5, 0x5d, 0x40, 0x7d, 0x15, 0xd2, 0x35, 0x8a, 
-    0xef, 0xa0, 0x1c, 0x19, 0x40, 0xa5, 0x39, 0x35, 0xe3, 0x18, 0xe5, 0x3b, 0x24, 0x8d, 0xe7, 0xf6, 
-    0xfc, 0x1a, 0x89, 0xd8, 0x75, 0x69, 0x68, 0xec, 0xf4, 0x87, 0x28, 0xf3, 0xe9, 0x77, 0x46, 0x93, 
-    0x09, 0x2d, 0xce, 0x28, 0x59, 0xc6, 0x37, 0x3d, 0xc0, 0xed, 0x34, 0xa2, 0xac, 0xde, 0x69, 0xd2, 
-    0x0c, 0xe0, 0xcf, 0xa2, 0xc5, 0x84, 0x00, 0xd7, 0x86, 0xb3, 0xce, 0x94, 0x19, 0xa8, 0x5f, 0xa0, 
-    0x5c, 0x4a, 0x3d, 0x3c, 0xa4, 0x9b, 0xc1, 0x62, 0x35, 0x4a, 0x9d, 0xb5, 0x17, 0x2d, 0x82, 0x09, 
-    0xb2, 0x24, 0x24, 0x9f, 0xfa, 0xa8, 0xf6, 0x4b, 0xfa, 0x30, 0xab, 0xda, 0x63, 0xf8, 0x38, 0x5e, 
-    0x3f, 0x42, 0x19, 0xf4, 0x84, 0xd1, 0x09, 0x17, 0x32, 0x6b, 0x0e, 0x4b, 0x45, 0xb3, 0x2f, 0xbb, 
-    0x6d, 0x19, 0x8b, 0xaa, 0x3e, 0xc2, 0x15, 0xd8, 0x22, 0x1f, 0x8c, 0x8f, 0x70, 0xf5, 0xa6, 0x7e, 
-    0xfd, 0x65, 0x43, 0xf5, 0x13, 0x94, 0x48, 0x9b, 0x35, 0xde, 0xd5, 0x98, 0x23, 0x94, 0x27, 0x67, 
-    0x2b, 0xb8, 0x51, 0x44, 0xd2, 0x9e, 0xee, 0xd8, 0x0c, 0x21, 0x28, 0x19, 0x77, 0xa6, 0x86, 0xe8, 
-    0x2a, 0xd7, 0x77, 0x50, 0xee, 0x04, 0x64, 0x71, 0xc2, 0xb6, 0x9b, 0xa9, 0xaa, 0xe2, 0x27, 0xe6, 
-    0x26, 0x7d, 0x58, 0x56, 0x55, 0x6a, 0x2f, 0xbe, 0xd5, 0x0c, 0x1d, 0x71, 0xac, 0xda, 0xc0, 0x53, 
-    0x94, 0x07, 0xd0, 0x8e, 0xa8, 0x57, 0xc7, 0xd0, 0xfc, 0xde, 0x68, 0xd1, 0xcb, 0x1f, 0xb0, 0x71, 
-    0x19, 0x39, 0x01, 0xbf, 0x83, 0x52, 0xdb, 0xb2, 0x4b, 0x6d, 0xe9, 0x41, 0xb8, 0xb5, 0xb9, 0x1d, 
-    0xde, 0xe9, 0xfa, 0xe2, 0x58, 0x9c, 0x8d, 0x8a, 0x23, 0x12, 0xdb, 0x7b, 0x23, 0xe7, 0x29, 0xd5, 
-    0xba, 0x00, 0x8d, 0x99, 0x5a, 0x5a, 0x53, 0xfc, 0xbd, 0x8f, 0xfc, 0x6e, 0x25, 0x68, 0x46, 0xc6, 
-    0x9e, 0x0a, 0xb2, 0xeb, 0xed, 0x53, 0xbc, 0xc3, 0xdd, 0x4b, 0xb2, 0x7d, 0xfe, 0x1c, 0x91, 0x94, 
-    0x0d, 0x79, 0x51, 0xd8, 0x7d, 0xcd, 0x58, 0xa0, 0xac, 0x35, 0x44, 0xcb, 0xec, 0x85, 0x64, 0xb6, 
-    0x48, 0xda, 0x91, 0x85, 0x94, 0xd3, 0x47, 0xb6, 0x0f, 0x51, 0x46, 0x6f, 0x6c, 0xf9, 0x8b, 0x83, 
-    0x8b, 0x9e, 0x4d, 0x0d, 0xd0, 0x92, 0x27, 0xb0, 0x8d, 0xac, 0xa1, 0x2b, 0xb4, 0x7b, 0x09, 0x94, 
-    0x57, 0x8c, 0xca, 0x85, 0xff, 0xf1, 0xf6, 0xf8, 0x1b, 0x00, 0x53, 0x87, 0x98, 0x2d, 0x10, 0xf4, 
-    0xe9, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
+SRWLOCK                 g_drawNumberCacheLock = SRWLOCK_INIT;
 
 DrawNumberTool::DrawNumberTool()
 {
-    if(!g_numTextImage.is_valid()) {
-        if(!imageio::read_png_image(g_numTextImage, g_numImageSource, sizeof(g_numImageSource))) {
-            MessageBoxA(NULL, "Load \"number.png\" failed.", "Error", MB_OK);
-            return;
-        }
+    const OverlayGeometry& geometry = OverlayGeometry::instance();
+    if(geometry.loadError()) {
+        MessageBoxA(NULL, geometry.loadError(), "Error", MB_OK);
+        return;
     }
-    assert(g_numTextImage.is_valid());
-    m_bias = 0.f;
-    int w = g_numTextImage.get_width();
-    int h = g_numTextImage.get_height();
-    m_numHeight = (float)h;
-    m_numWidth = ((float)w - m_bias) / 10.f;
-    m_color[0] = m_color[3] = 1.f;
-    m_color[1] = m_color[2] = 0.f;
+    // the number shader reads coverage from red, the text shader the distance from the only channel
+    encodeBC4(geometry.numberAtlas(), 0, g_numTextBlocks);
+    encodeBC4(geometry.textAtlas(), 0, g_textFieldBlocks);
 }
 
-void DrawNumberTool::drawNumber(IDXGISwapChain* pSwapChain, int number) const
+// the viewport the game left bound decides the overlay scale, when there is one
+static void viewportSize(ID3D11DeviceContext* pContext, float& width, float& height)
 {
-    assert(pSwapChain);
-    ID3D11Device* pDevice = nullptr;
-    ID3D11DeviceContext* pContext = nullptr;
-    pSwapChain->GetDevice(__uuidof(ID3D11Device), (void**)&pDevice);
-    pDevice->GetImmediateContext(&pContext);
-
-    // try to retrieve swap chain dimensions
-    DXGI_SWAP_CHAIN_DESC swapChainDesc;
-    pSwapChain->GetDesc(&swapChainDesc);
-    float width = (float)swapChainDesc.BufferDesc.Width;
-    float height = (float)swapChainDesc.BufferDesc.Height;
-
     D3D11_VIEWPORT viewports[D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE];
     UINT nViewports = D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
     pContext->RSGetViewports(&nViewports, viewports);
@@ -407,155 +553,629 @@ void DrawNumberTool::drawNumber(IDXGISwapChain* pSwapChain, int number) const
         width = viewports[0].Width;
         height = viewports[0].Height;
     }
+}
 
+static const DrawNumberCache& cacheOf(ID3D11Device* pDevice)
+{
+    // swapchains of one process may present from different threads; elements of the map stay put on insert
+    const DrawNumberCache* pCache = nullptr;
+    AcquireSRWLockShared(&g_drawNumberCacheLock);
     auto f = g_drawNumberCacheMap.find(pDevice);
-    if(f == g_drawNumberCacheMap.end()) {
-        f = g_drawNumberCacheMap.insert(std::make_pair(pDevice, DrawNumberCache(pDevice))).first;
+    if(f != g_drawNumberCacheMap.end())
+        pCache = &f->second;
+    ReleaseSRWLockShared(&g_drawNumberCacheLock);
+    if(!pCache) {
+        AcquireSRWLockExclusive(&g_drawNumberCacheLock);
+        f = g_drawNumberCacheMap.find(pDevice);
+        if(f == g_drawNumberCacheMap.end())
+            f = g_drawNumberCacheMap.insert(std::make_pair(pDevice, DrawNumberCache(pDevice))).first;
+        pCache = &f->second;
+        ReleaseSRWLockExclusive(&g_drawNumberCacheLock);
     }
-    const DrawNumberCache& cache = f->second;
+    return *pCache;
+}
+
+FrameGraphRing::FrameGraphRing()
+{
+    pDevice = nullptr;
+    pBuffer = nullptr;
+    pView = nullptr;
+    capacity = 0;
+    uploaded = 0;
+    memset(drawnAt, 0, sizeof(drawnAt));
+    drawSlot = 0;
+}
+
+FrameGraphRing::~FrameGraphRing()
+{
+    release();
+}
 
-    DrawNumberVertices vertices;
-    createVertices(number, width, height, vertices);
-    ID3D11Buffer* pVertexBuffer = createVertexBuffer(pDevice, vertices);
-    ID3D11Buffer* pIndexBuffer = createIndexBuffer(pDevice, vertices);
-    assert(pVertexBuffer && pIndexBuffer);
+void FrameGraphRing::release()
+{
+    SAFE_RELEASE(pView);
+    SAFE_RELEASE(pBuffer);
+    SAFE_RELEASE(pDevice);
+    capacity = 0;
+    uploaded = 0;
+    memset(drawnAt, 0, sizeof(drawnAt));
+    drawSlot = 0;
+}
 
-    cache.beginDraw(pContext);
-    UINT stride = sizeof(DrawNumberVertex);
-    UINT offset = 0;
-    pContext->IASetVertexBuffers(0, 1, &pVertexBuffer, &stride, &offset);
-    pContext->IASetIndexBuffer(pIndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-    int numVertices = (int)vertices.size();
-    pContext->DrawIndexed(numVertices / 4 * 6, 0, 0);
-    cache.endDraw(pContext);
+HudComposite::HudComposite()
+{
+    pDevice = nullptr;
+    pTexture = nullptr;
+    pTarget = nullptr;
+    pView = nullptr;
+    pConstants = nullptr;
+    width = 0;
+    height = 0;
+    contentWidth = 0.f;
+    contentHeight = 0.f;
+    contentHash = 0;
+    memset(rect, 0, sizeof(rect));
+}
 
-    ID3D11Buffer* pEmptyBuffer = nullptr;
-    UINT emptyStride = 0;
-    pContext->IASetVertexBuffers(0, 1, &pEmptyBuffer, &emptyStride, &offset);
-    pContext->IASetIndexBuffer(pEmptyBuffer, DXGI_FORMAT_UNKNOWN, 0);
+HudComposite::~HudComposite()
+{
+    release();
+}
 
-    pVertexBuffer->Release();
-    pIndexBuffer->Release();
+QuadBuffers::QuadBuffers()
+{
+    pDevice = nullptr;
+    pVertexBuffer = nullptr;
+    pIndexBuffer = nullptr;
+    capacity = 0;
 }
 
-void DrawNumberTool::createVertices(int number, float width, float height, DrawNumberVertices& vertices) const
+QuadBuffers::~QuadBuffers()
 {
-    if(number < 0)
-        number = 0;
-    char strNumber[32];
-    _snprintf(strNumber, sizeof(strNumber), "%d", number);
-    float x = 15.f, y = 15.f;
-    for(int i = 0; i < 32; i ++) {
-        char digit = strNumber[i];
-        if(digit == 0)
-            break;
-        createVerticesFor(digit, x, y, width, height, vertices);
-        x += m_numWidth;
+    release();
+}
+
+void QuadBuffers::release()
+{
+    SAFE_RELEASE(pVertexBuffer);
+    SAFE_RELEASE(pIndexBuffer);
+    SAFE_RELEASE(pDevice);
+    capacity = 0;
+}
+
+WidgetBuffers::WidgetBuffers()
+{
+    pDevice = nullptr;
+    pVertexBuffer = nullptr;
+    pIndexBuffer = nullptr;
+}
+
+WidgetBuffers::~WidgetBuffers()
+{
+    release();
+}
+
+void WidgetBuffers::release()
+{
+    SAFE_RELEASE(pVertexBuffer);
+    SAFE_RELEASE(pIndexBuffer);
+    SAFE_RELEASE(pDevice);
+}
+
+DeferredConstants::DeferredConstants()
+{
+    pDevice = nullptr;
+    pNumberConstants = nullptr;
+    pTextConstants = nullptr;
+    pGraphConstants = nullptr;
+}
+
+DeferredConstants::~DeferredConstants()
+{
+    release();
+}
+
+void DeferredConstants::release()
+{
+    SAFE_RELEASE(pNumberConstants);
+    SAFE_RELEASE(pTextConstants);
+    SAFE_RELEASE(pGraphConstants);
+    SAFE_RELEASE(pDevice);
+}
+
+void HudComposite::release()
+{
+    quads.release();
+    SAFE_RELEASE(pConstants);
+    SAFE_RELEASE(pView);
+    SAFE_RELEASE(pTarget);
+    SAFE_RELEASE(pTexture);
+    SAFE_RELEASE(pDevice);
+    width = 0;
+    height = 0;
+    contentHash = 0;
+}
+
+// FNV-1a over everything that changes the pixels of the HUD
+static uint64_t hudHash(const int* numbers, int count, const OverlayConfig& cfg)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    const byte* parts[] = { (const byte*)numbers, (const byte*)cfg.overlayColor, (const byte*)&cfg.overlayBias, (const byte*)&count };
+    size_t sizes[] = { sizeof(int) * count, sizeof(cfg.overlayColor), sizeof(cfg.overlayBias), sizeof(count) };
+    for(int p = 0; p < 4; p ++) {
+        for(size_t i = 0; i < sizes[p]; i ++) {
+            hash ^= parts[p][i];
+            hash *= 0x100000001b3ull;
+        }
     }
+    return hash ? hash : 1;
 }
 
-static void convertToNDC(float width, float height, float coords[2])
+float DrawNumberTool::numberHeight() const
 {
-    coords[0] = 2.f * coords[0] / width - 1.f;
-    coords[1] = 1.f - 2.f * coords[1] / height;
+    return OverlayGeometry::instance().numberHeight();
 }
 
-static void convertToTex(float width, float height, float coords[2])
+float DrawNumberTool::numberWidth(const OverlayConfig& cfg) const
 {
-    coords[0] /= width;
-    coords[1] /= height;
+    return OverlayGeometry::instance().numberWidth(cfg.overlayBias);
 }
 
-void DrawNumberTool::createVerticesFor(char digit, float x, float y, float width, float height, DrawNumberVertices& vertices) const
+void DrawNumberTool::drawNumber(IDXGISwapChain* pSwapChain, QuadBuffers& buffers, int number, float x, float y, float width, float height,
+    const OverlayConfig& cfg) const
 {
-    bool isDigit = (digit >= 48 && digit <= 57);
-    if(!isDigit)
+    drawNumbers(pSwapChain, buffers, &number, 1, x, y, width, height, cfg);
+}
+
+void DrawNumberTool::drawNumbers(IDXGISwapChain* pSwapChain, QuadBuffers& buffers, const int* numbers, int count, float x, float y,
+    float width, float height, const OverlayConfig& cfg) const
+{
+    assert(pSwapChain && numbers);
+    if(count <= 0)
         return;
-    digit -= 48;
-    float tx = m_numWidth * digit + m_bias;
-    float ty = 0.f;
-    float texWidth = (float)g_numTextImage.get_width();
-    float texHeight = (float)g_numTextImage.get_height();
-    DrawNumberVertex vertex;
-    memcpy(vertex.color, m_color, sizeof(m_color));
-    vertex.position[2] = 0.f;
-    vertex.position[3] = 1.f;
-    // top left
-    vertex.position[0] = x;
-    vertex.position[1] = y;
-    convertToNDC(width, height, vertex.position);
-    vertex.tex[0] = tx;
-    vertex.tex[1] = ty;
-    convertToTex(texWidth, texHeight, vertex.tex);
-    vertices.push_back(vertex);
-    // top right
-    vertex.position[0] = x + m_numWidth;
-    vertex.position[1] = y;
-    convertToNDC(width, height, vertex.position);
-    vertex.tex[0] = tx + m_numWidth;
-    vertex.tex[1] = ty;
-    convertToTex(texWidth, texHeight, vertex.tex);
-    vertices.push_back(vertex);
-    // bottom left
-    vertex.position[0] = x;
-    vertex.position[1] = y + m_numHeight;
-    convertToNDC(width, height, vertex.position);
-    vertex.tex[0] = tx;
-    vertex.tex[1] = ty + m_numHeight;
-    convertToTex(texWidth, texHeight, vertex.tex);
-    vertices.push_back(vertex);
-    // bottom right
-    vertex.position[0] = x + m_numWidth;
-    vertex.position[1] = y + m_numHeight;
-    convertToNDC(width, height, vertex.position);
-    vertex.tex[0] = tx + m_numWidth;
-    vertex.tex[1] = ty + m_numHeight;
-    convertToTex(texWidth, texHeight, vertex.tex);
-    vertices.push_back(vertex);
-}
-
-ID3D11Buffer* DrawNumberTool::createVertexBuffer(ID3D11Device* pDevice, const DrawNumberVertices& vertices) const
+    ID3D11Device* pDevice = nullptr;
+    ID3D11DeviceContext* pContext = nullptr;
+    if(FAILED(pSwapChain->GetDevice(__uuidof(ID3D11Device), (void**)&pDevice)))
+        return;
+    pDevice->GetImmediateContext(&pContext);
+    viewportSize(pContext, width, height);
+    renderNumbers(pDevice, pContext, nullptr, buffers, numbers, count, x, y, width, height, cfg);
+    pContext->Release();
+    pDevice->Release();
+}
+
+void DrawNumberTool::renderNumbers(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, DeferredConstants* pDeferred, QuadBuffers& buffers,
+    const int* numbers, int count, float x, float y, float width, float height, const OverlayConfig& cfg) const
+{
+    if(count <= 0)
+        return;
+    const DrawNumberCache& cache = cacheOf(pDevice);
+    if(pDeferred && !cache.prepareDeferred(*pDeferred))
+        return;
+
+    uint32_t vertexCount = 0;
+    DrawNumberVertex* vertices = OverlayGeometry::instance().createRows(numbers, count, x, y, cfg.overlayBias, cfg.overlayColor, vertexCount);
+    if(!vertices || !reserveQuads(pDevice, buffers, vertexCount / 4) || !uploadQuads(pContext, buffers, vertices, vertexCount / 4))
+        return;
+
+    ID3D11Buffer* pConstants = cache.placeNumbers(pContext, pDeferred, width, height);
+    if(pConstants) {
+        OverlayStateGuard guard(pContext);
+        cache.bindNumbers(guard, pConstants, buffers.pVertexBuffer, buffers.pIndexBuffer);
+        pContext->DrawIndexed(vertexCount / 4 * 6, 0, 0);
+    }
+}
+
+void DrawNumberTool::composeNumbers(IDXGISwapChain* pSwapChain, HudComposite& hud, const int* numbers, int count, float x, float y, float width, float height, const OverlayConfig& cfg) const
+{
+    assert(pSwapChain && numbers);
+    if(count <= 0)
+        return;
+    ID3D11Device* pDevice = nullptr;
+    ID3D11DeviceContext* pContext = nullptr;
+    if(FAILED(pSwapChain->GetDevice(__uuidof(ID3D11Device), (void**)&pDevice)))
+        return;
+    pDevice->GetImmediateContext(&pContext);
+    viewportSize(pContext, width, height);
+
+    if(renderHud(pDevice, pContext, hud, numbers, count, cfg)) {
+        float rect[4] =
+        {
+            2.f * x / width - 1.f,
+            1.f - 2.f * y / height,
+            2.f * (x + hud.contentWidth) / width - 1.f,
+            1.f - 2.f * (y + hud.contentHeight) / height,
+        };
+        bool placed = memcmp(rect, hud.rect, sizeof(rect)) == 0;
+        D3D11_MAPPED_SUBRESOURCE mapped;
+        if(!placed && SUCCEEDED(pContext->Map(hud.pConstants, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped))) {
+            ComposeConstants constants;
+            memcpy(constants.rect, rect, sizeof(rect));
+            constants.tex[0] = hud.contentWidth / (float)hud.width;
+            constants.tex[1] = hud.contentHeight / (float)hud.height;
+            constants.tex[2] = 0.f;
+            constants.tex[3] = 0.f;
+            memcpy(mapped.pData, &constants, sizeof(constants));
+            pContext->Unmap(hud.pConstants, 0);
+            memcpy(hud.rect, rect, sizeof(rect));
+            placed = true;
+        }
+        if(placed) {
+            OverlayStateGuard guard(pContext);
+            cacheOf(pDevice).bindCompose(guard, hud);
+            pContext->Draw(4, 0);
+        }
+    }
+    pContext->Release();
+    pDevice->Release();
+}
+
+bool DrawNumberTool::renderHud(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, HudComposite& hud, const int* numbers, int count, const OverlayConfig& cfg) const
 {
+    uint64_t hash = hudHash(numbers, count, cfg);
+    if(hud.pDevice == pDevice && hud.contentHash == hash)
+        return true;
+
+    const OverlayGeometry& geometry = OverlayGeometry::instance();
+    float numWidth = geometry.numberWidth(cfg.overlayBias);
+    int digits = 1;
+    for(int i = 0; i < count; i ++) {
+        char strNumber[32];
+        int len = _snprintf(strNumber, sizeof(strNumber), "%d", numbers[i] < 0 ? 0 : numbers[i]);
+        if(len > digits)
+            digits = len;
+    }
+    float contentWidth = numWidth * digits;
+    float contentHeight = geometry.numberHeight() * count;
+    UINT needWidth = ((UINT)contentWidth + g_hudGranularity) / g_hudGranularity * g_hudGranularity;
+    UINT needHeight = ((UINT)contentHeight + g_hudGranularity) / g_hudGranularity * g_hudGranularity;
+    if(hud.pDevice != pDevice || hud.width < needWidth || hud.height < needHeight) {
+        hud.release();
+        D3D11_TEXTURE2D_DESC desc;
+        ZeroMemory(&desc, sizeof(desc));
+        desc.Width = needWidth;
+        desc.Height = needHeight;
+        desc.MipLevels = 1;
+        desc.ArraySize = 1;
+        desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+        desc.SampleDesc.Count = 1;
+        desc.Usage = D3D11_USAGE_DEFAULT;
+        desc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+        pDevice->CreateTexture2D(&desc, nullptr, &hud.pTexture);
+        if(hud.pTexture) {
+            pDevice->CreateRenderTargetView(hud.pTexture, nullptr, &hud.pTarget);
+            pDevice->CreateShaderResourceView(hud.pTexture, nullptr, &hud.pView);
+        }
+        D3D11_BUFFER_DESC cbDesc;
+        ZeroMemory(&cbDesc, sizeof(cbDesc));
+        cbDesc.Usage = D3D11_USAGE_DYNAMIC;
+        cbDesc.ByteWidth = sizeof(ComposeConstants);
+        cbDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+        cbDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        pDevice->CreateBuffer(&cbDesc, nullptr, &hud.pConstants);
+        if(!hud.pTarget || !hud.pView || !hud.pConstants) {
+            hud.release();
+            return false;
+        }
+        hud.pDevice = pDevice;
+        hud.pDevice->AddRef();
+        hud.width = needWidth;
+        hud.height = needHeight;
+    }
+
+    uint32_t vertexCount = 0;
+    DrawNumberVertex* vertices = geometry.createRows(numbers, count, 0.f, 0.f, cfg.overlayBias, cfg.overlayColor, vertexCount);
+    if(!vertices || !reserveQuads(pDevice, hud.quads, vertexCount / 4) || !uploadQuads(pContext, hud.quads, vertices, vertexCount / 4))
+        return false;
+    {
+        OverlayStateGuard guard(pContext);
+        guard.setRenderTarget(hud.pTarget);
+        D3D11_VIEWPORT viewport = { 0.f, 0.f, (float)hud.width, (float)hud.height, 0.f, 1.f };
+        guard.setViewport(viewport);
+        float clear[4] = { 0.f, 0.f, 0.f, 0.f };
+        pContext->ClearRenderTargetView(hud.pTarget, clear);
+        const DrawNumberCache& cache = cacheOf(pDevice);
+        ID3D11Buffer* pConstants = cache.placeNumbers(pContext, nullptr, (float)hud.width, (float)hud.height);
+        if(pConstants) {
+            cache.bindNumbers(guard, pConstants, hud.quads.pVertexBuffer, hud.quads.pIndexBuffer);
+            pContext->DrawIndexed(vertexCount / 4 * 6, 0, 0);
+        }
+    }
+
+    hud.contentWidth = contentWidth;
+    hud.contentHeight = contentHeight;
+    hud.contentHash = hash;
+    // the texture coordinates of the quad follow the content size
+    memset(hud.rect, 0, sizeof(hud.rect));
+    return true;
+}
+
+void DrawNumberTool::drawGraph(IDXGISwapChain* pSwapChain, FrameGraphRing& ring, const uint32_t* samplesUs, uint32_t capacity, uint64_t sampleCount,
+    float x, float y, float width, float height, const OverlayConfig& cfg) const
+{
+    assert(pSwapChain && samplesUs && capacity > OverlayGeometry::graph_slack + 1);
+    if(sampleCount < 2)
+        return;
+    ID3D11Device* pDevice = nullptr;
+    ID3D11DeviceContext* pContext = nullptr;
+    if(FAILED(pSwapChain->GetDevice(__uuidof(ID3D11Device), (void**)&pDevice)))
+        return;
+    pDevice->GetImmediateContext(&pContext);
+    viewportSize(pContext, width, height);
+    renderGraph(pDevice, pContext, nullptr, ring, samplesUs, capacity, sampleCount, x, y, width, height, cfg);
+    pContext->Release();
+    pDevice->Release();
+}
+
+void DrawNumberTool::renderGraph(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, DeferredConstants* pDeferred, FrameGraphRing& ring,
+    const uint32_t* samplesUs, uint32_t capacity, uint64_t sampleCount, float x, float y, float width, float height, const OverlayConfig& cfg) const
+{
+    const DrawNumberCache& cache = cacheOf(pDevice);
+    if(pDeferred && !cache.prepareDeferred(*pDeferred))
+        return;
+    if(ring.pDevice != pDevice || ring.capacity != capacity) {
+        ring.release();
+        D3D11_BUFFER_DESC desc;
+        ZeroMemory(&desc, sizeof(desc));
+        desc.Usage = D3D11_USAGE_DYNAMIC;
+        desc.ByteWidth = capacity * sizeof(float);
+        desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        pDevice->CreateBuffer(&desc, nullptr, &ring.pBuffer);
+        if(!ring.pBuffer)
+            return;
+        D3D11_SHADER_RESOURCE_VIEW_DESC viewDesc;
+        ZeroMemory(&viewDesc, sizeof(viewDesc));
+        viewDesc.Format = DXGI_FORMAT_R32_FLOAT;
+        viewDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+        viewDesc.Buffer.FirstElement = 0;
+        viewDesc.Buffer.NumElements = capacity;
+        pDevice->CreateShaderResourceView(ring.pBuffer, &viewDesc, &ring.pView);
+        if(!ring.pView) {
+            ring.release();
+            return;
+        }
+        ring.pDevice = pDevice;
+        ring.pDevice->AddRef();
+        ring.capacity = capacity;
+    }
+
+    // append what was presented since the last frame, normally a single sample; a draw still in flight
+    // reads back to its own sample count minus the window, so the writes must stay clear of that
+    uint64_t pending = sampleCount - ring.uploaded;
+    if(pending > 0) {
+        // a deferred context has to DISCARD before it may append, and its list starts from empty contents anyway
+        bool whole = !cache.graphNoOverwrite || ring.uploaded == 0 || sampleCount - ring.drawnAt[ring.drawSlot] > OverlayGeometry::graph_slack ||
+            pDeferred != nullptr;
+        D3D11_MAPPED_SUBRESOURCE mapped;
+        if(SUCCEEDED(pContext->Map(ring.pBuffer, 0, whole ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE, 0, &mapped))) {
+            float* dst = (float*)mapped.pData;
+            uint64_t first = whole ? (sampleCount > capacity ? sampleCount - capacity : 0) : ring.uploaded;
+            for(uint64_t s = first; s < sampleCount; s ++) {
+                uint32_t slot = (uint32_t)(s % capacity);
+                dst[slot] = (float)samplesUs[slot] / 1000.f;
+            }
+            pContext->Unmap(ring.pBuffer, 0);
+            ring.uploaded = sampleCount;
+            // the draws before a DISCARD keep the old memory
+            if(whole) {
+                for(int i = 0; i < FrameGraphRing::frames_in_flight; i ++)
+                    ring.drawnAt[i] = sampleCount;
+            }
+        }
+    }
+
+    GraphPlacement placement;
+    OverlayGeometry::instance().placeGraph(capacity, sampleCount, x, y, placement);
+    GraphConstants constants;
+    constants.origin[0] = 2.f * placement.left / width - 1.f;
+    constants.origin[1] = 1.f - 2.f * placement.baseline / height;
+    constants.origin[2] = 2.f * placement.step / width;
+    constants.origin[3] = 2.f * placement.pixelsPerMs / height;
+    memcpy(constants.color, cfg.overlayColor, sizeof(constants.color));
+    constants.start = (uint32_t)(placement.first % capacity);
+    constants.capacity = capacity;
+    constants.top = 1.f - 2.f * placement.top / height;
+    constants.padding = 0.f;
+    ID3D11Buffer* pConstants = pDeferred ? pDeferred->pGraphConstants : cache.pGraphConstants;
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    if(FAILED(pContext->Map(pConstants, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+        return;
+    memcpy(mapped.pData, &constants, sizeof(constants));
+    pContext->Unmap(pConstants, 0);
+
+    {
+        OverlayStateGuard guard(pContext);
+        cache.bindGraph(guard, pConstants, ring.pView);
+        pContext->Draw(placement.count, 0);
+    }
+    ring.drawnAt[ring.drawSlot] = sampleCount;
+    ring.drawSlot = (ring.drawSlot + 1) % FrameGraphRing::frames_in_flight;
+}
+
+bool DrawNumberTool::reserveQuads(ID3D11Device* pDevice, QuadBuffers& buffers, uint32_t quadCount) const
+{
+    if(buffers.pDevice == pDevice && buffers.capacity >= quadCount)
+        return true;
+    uint32_t capacity = buffers.pDevice == pDevice && buffers.capacity ? buffers.capacity : 64;
+    while(capacity < quadCount)
+        capacity *= 2;
+    buffers.release();
     D3D11_BUFFER_DESC desc;
     ZeroMemory(&desc, sizeof(desc));
-    desc.Usage = D3D11_USAGE_DEFAULT;
-    desc.ByteWidth = (UINT)sizeof(DrawNumberVertex) * (UINT)vertices.size();
+    desc.Usage = D3D11_USAGE_DYNAMIC;
+    desc.ByteWidth = capacity * 4 * sizeof(DrawNumberVertex);
     desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-    desc.CPUAccessFlags = 0;
-    D3D11_SUBRESOURCE_DATA data;
-    ZeroMemory(&data, sizeof(data));
-    data.pSysMem = &vertices.front();
-    ID3D11Buffer* p = nullptr;
-    pDevice->CreateBuffer(&desc, &data, &p);
-    return p;
+    desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    pDevice->CreateBuffer(&desc, nullptr, &buffers.pVertexBuffer);
+    buffers.pIndexBuffer = createIndexBuffer(pDevice, capacity, D3D11_USAGE_IMMUTABLE);
+    if(!buffers.pVertexBuffer || !buffers.pIndexBuffer) {
+        buffers.release();
+        return false;
+    }
+    buffers.pDevice = pDevice;
+    buffers.pDevice->AddRef();
+    buffers.capacity = capacity;
+    return true;
 }
 
-ID3D11Buffer* DrawNumberTool::createIndexBuffer(ID3D11Device* pDevice, const DrawNumberVertices& vertices) const
+bool DrawNumberTool::uploadQuads(ID3D11DeviceContext* pContext, QuadBuffers& buffers, const void* vertices, uint32_t quadCount) const
 {
-    int nums = (int)vertices.size() / 4;
-    if(nums <= 0)
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    if(FAILED(pContext->Map(buffers.pVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped)))
+        return false;
+    memcpy(mapped.pData, vertices, quadCount * 4 * sizeof(DrawNumberVertex));
+    pContext->Unmap(buffers.pVertexBuffer, 0);
+    return true;
+}
+
+// two triangles per quad of the top left, top right, bottom left, bottom right vertices
+ID3D11Buffer* DrawNumberTool::createIndexBuffer(ID3D11Device* pDevice, uint32_t quadCount, D3D11_USAGE usage) const
+{
+    if(quadCount == 0)
         return nullptr;
-    std::vector<int32_t> indices;
-    indices.reserve(nums * 6);
-    int32_t bias = 0;
-    for(int i = 0; i < nums; i ++, bias += 4) {
-        indices.push_back(bias);
-        indices.push_back(bias + 1);
-        indices.push_back(bias + 3);
-        indices.push_back(bias);
-        indices.push_back(bias + 3);
-        indices.push_back(bias + 2);
+    int32_t* indices = FrameArena::current().allocate<int32_t>(quadCount * 6);
+    if(!indices)
+        return nullptr;
+    int32_t* index = indices;
+    for(int32_t bias = 0; bias < (int32_t)quadCount * 4; bias += 4, index += 6) {
+        index[0] = bias;
+        index[1] = bias + 1;
+        index[2] = bias + 3;
+        index[3] = bias;
+        index[4] = bias + 3;
+        index[5] = bias + 2;
     }
     D3D11_BUFFER_DESC desc;
     ZeroMemory(&desc, sizeof(desc));
-    desc.Usage = D3D11_USAGE_DEFAULT;
-    desc.ByteWidth = 4 * (UINT)indices.size();
+    desc.Usage = usage;
+    desc.ByteWidth = 4 * quadCount * 6;
     desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
     desc.CPUAccessFlags = 0;
     D3D11_SUBRESOURCE_DATA data;
     ZeroMemory(&data, sizeof(data));
-    data.pSysMem = &indices.front();
+    data.pSysMem = indices;
     ID3D11Buffer* p = nullptr;
     pDevice->CreateBuffer(&desc, &data, &p);
     return p;
 }
+
+void DrawNumberTool::drawText(IDXGISwapChain* pSwapChain, const TextBatch& batch, QuadBuffers& buffers, float width, float height) const
+{
+    assert(pSwapChain);
+    uint32_t quadCount = batch.quadCount();
+    if(quadCount == 0)
+        return;
+    ID3D11Device* pDevice = nullptr;
+    ID3D11DeviceContext* pContext = nullptr;
+    if(FAILED(pSwapChain->GetDevice(__uuidof(ID3D11Device), (void**)&pDevice)))
+        return;
+    pDevice->GetImmediateContext(&pContext);
+    viewportSize(pContext, width, height);
+    renderText(pDevice, pContext, nullptr, batch, buffers, width, height);
+    pContext->Release();
+    pDevice->Release();
+}
+
+void DrawNumberTool::renderText(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, DeferredConstants* pDeferred, const TextBatch& batch,
+    QuadBuffers& buffers, float width, float height) const
+{
+    uint32_t quadCount = batch.quadCount();
+    if(quadCount == 0)
+        return;
+    const DrawNumberCache& cache = cacheOf(pDevice);
+    if(pDeferred && !cache.prepareDeferred(*pDeferred))
+        return;
+    // pixels and texels like the numbers, the vertex shader scales them
+    static_assert(sizeof(TextVertex) == sizeof(DrawNumberVertex), "text vertices are drawn as number vertices");
+    if(!reserveQuads(pDevice, buffers, quadCount) || !uploadQuads(pContext, buffers, batch.vertices(), quadCount))
+        return;
+
+    ID3D11Buffer* pConstants = cache.placeText(pContext, pDeferred, width, height);
+    if(pConstants) {
+        OverlayStateGuard guard(pContext);
+        cache.bindText(guard, pConstants, buffers.pVertexBuffer, buffers.pIndexBuffer);
+        pContext->DrawIndexed(quadCount * 6, 0, 0);
+    }
+}
+
+void DrawNumberTool::layoutLabels(TextBatch& batch, const char* const* labels, int count, float x, float y, const OverlayConfig& cfg) const
+{
+    OverlayGeometry::instance().layoutLabels(batch, labels, count, x, y, cfg.overlayBias, cfg.overlayColor);
+}
+
+void DrawNumberTool::layoutWidgets(WidgetTree& tree, const int* numbers, const char* const* labels, int count, float x, float y, const OverlayConfig& cfg) const
+{
+    OverlayGeometry::instance().layoutWidgets(tree, numbers, labels, count, x, y, cfg.overlayBias, cfg.overlayColor);
+}
+
+void DrawNumberTool::drawWidgets(IDXGISwapChain* pSwapChain, WidgetTree& tree, WidgetBuffers& buffers, float width, float height) const
+{
+    assert(pSwapChain);
+    if(tree.drawQuads() == 0)
+        return;
+    ID3D11Device* pDevice = nullptr;
+    ID3D11DeviceContext* pContext = nullptr;
+    if(FAILED(pSwapChain->GetDevice(__uuidof(ID3D11Device), (void**)&pDevice)))
+        return;
+    pDevice->GetImmediateContext(&pContext);
+    viewportSize(pContext, width, height);
+    renderWidgets(pDevice, pContext, tree, buffers, width, height);
+    pContext->Release();
+    pDevice->Release();
+}
+
+void DrawNumberTool::renderWidgets(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, WidgetTree& tree, WidgetBuffers& buffers,
+    float width, float height) const
+{
+    uint32_t quadCount = tree.drawQuads();
+    if(quadCount == 0)
+        return;
+    if(buffers.pDevice != pDevice) {
+        buffers.release();
+        D3D11_BUFFER_DESC desc;
+        ZeroMemory(&desc, sizeof(desc));
+        desc.Usage = D3D11_USAGE_DEFAULT;
+        desc.ByteWidth = WidgetTree::quads_max * 4 * sizeof(DrawNumberVertex);
+        desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+        D3D11_SUBRESOURCE_DATA data;
+        ZeroMemory(&data, sizeof(data));
+        data.pSysMem = g_collapsedWidgets;
+        pDevice->CreateBuffer(&desc, &data, &buffers.pVertexBuffer);
+        buffers.pIndexBuffer = createIndexBuffer(pDevice, WidgetTree::quads_max, D3D11_USAGE_IMMUTABLE);
+        if(!buffers.pVertexBuffer || !buffers.pIndexBuffer) {
+            buffers.release();
+            return;
+        }
+        buffers.pDevice = pDevice;
+        buffers.pDevice->AddRef();
+        tree.invalidate();
+    }
+
+    if(tree.layout() > 0) {
+        for(int i = 0; i < tree.count(); i ++) {
+            const OverlayWidget& widget = tree.widget(i);
+            if(!widget.dirty)
+                continue;
+            DrawNumberVertex* vertices = FrameArena::current().allocate<DrawNumberVertex>(widget.quadCount * 4);
+            if(!vertices)
+                break;
+            uint32_t filled = OverlayGeometry::instance().tessellate(tree, widget, vertices);
+            // quads the old geometry had and the new one does not collapse to a point; past both the span is collapsed already
+            uint32_t upload = filled > widget.filled ? filled : widget.filled;
+            if(upload > 0) {
+                memset(vertices + filled * 4, 0, (upload - filled) * 4 * sizeof(DrawNumberVertex));
+                UINT first = widget.firstQuad * 4 * sizeof(DrawNumberVertex);
+                D3D11_BOX box = { first, 0, 0, first + upload * 4 * (UINT)sizeof(DrawNumberVertex), 1, 1 };
+                pContext->UpdateSubresource(buffers.pVertexBuffer, 0, &box, vertices, 0, 0);
+            }
+            tree.clean(i, filled);
+        }
+    }
+
+    const DrawNumberCache& cache = cacheOf(pDevice);
+    cache.placeWidgets(pContext, width, height);
+    OverlayStateGuard guard(pContext);
+    cache.bindWidgets(guard, buffers.pVertexBuffer, buffers.pIndexBuffer);
+    pContext->DrawIndexed(quadCount * 6, 0, 0);
+}
@@ -1,39 +1,185 @@
 #pragma once
 
 #include <d3d11.h>
-#include <vector>
+#include <stdint.h>
+#include "OverlayGeometry.h"
 
-struct DrawNumberVertex
+struct OverlayConfig;
+class TextBatch;
+class WidgetTree;
+
+/*
+ * GPU copy of a swapchain's frame time ring for the frame graph. Each frame
+ * appends the new samples with MAP_WRITE_NO_OVERWRITE and the vertex shader
+ * walks the ring from the oldest drawn slot, so the strip is never rebuilt.
+ * Fewer samples are drawn than the ring holds; a frame may only append
+ * without DISCARD while the slots it writes lie outside what the last
+ * frames_in_flight draws read.
+ */
+struct FrameGraphRing
+{
+    enum { frames_in_flight = 4 };
+
+    ID3D11Device*               pDevice;
+    ID3D11Buffer*               pBuffer;
+    ID3D11ShaderResourceView*   pView;
+    uint32_t                    capacity;
+    uint64_t                    uploaded;           /* samples written to the buffer so far */
+    uint64_t                    drawnAt[frames_in_flight];  /* sample count at each recent draw */
+    uint32_t                    drawSlot;           /* oldest entry of drawnAt */
+
+    FrameGraphRing();
+    ~FrameGraphRing();
+    void release();
+
+private:
+    FrameGraphRing(const FrameGraphRing&);
+};
+
+/*
+ * Vertex and index buffers of a batch of quads, the numbers or the text. The
+ * vertex buffer is dynamic and rewritten with DISCARD each frame; the index
+ * buffer holds the fixed quad pattern and only changes when either grows, in
+ * powers of two.
+ */
+struct QuadBuffers
+{
+    ID3D11Device*               pDevice;
+    ID3D11Buffer*               pVertexBuffer;
+    ID3D11Buffer*               pIndexBuffer;
+    uint32_t                    capacity;           /* quads */
+
+    QuadBuffers();
+    ~QuadBuffers();
+    void release();
+
+private:
+    QuadBuffers(const QuadBuffers&);
+};
+
+/*
+ * A swapchain's HUD rendered once into a small offscreen target. The numbers
+ * are only laid out and drawn again when their content hash changes, about
+ * once a second; every other frame blits the target into the back buffer
+ * with a single quad, whatever the HUD contains.
+ */
+struct HudComposite
+{
+    ID3D11Device*               pDevice;
+    ID3D11Texture2D*            pTexture;
+    ID3D11RenderTargetView*     pTarget;
+    ID3D11ShaderResourceView*   pView;
+    ID3D11Buffer*               pConstants;         /* placement of the quad, rewritten when it moves */
+    QuadBuffers                 quads;              /* the numbers drawn into the texture */
+    UINT                        width;              /* texture size, at least the content size */
+    UINT                        height;
+    float                       contentWidth;
+    float                       contentHeight;
+    uint64_t                    contentHash;        /* 0 while the texture holds nothing */
+    float                       rect[4];            /* NDC rectangle in pConstants */
+
+    HudComposite();
+    ~HudComposite();
+    void release();
+
+private:
+    HudComposite(const HudComposite&);
+};
+
+/*
+ * The persistent vertex buffer of a swapchain's WidgetTree, DEFAULT usage so
+ * the spans of changed widgets can be replaced with UpdateSubresource while
+ * the rest stays as uploaded. The index buffer holds the quad pattern for the
+ * whole of it.
+ */
+struct WidgetBuffers
 {
-    float               position[4];
-    float               color[4];
-    float               tex[2];
+    ID3D11Device*               pDevice;
+    ID3D11Buffer*               pVertexBuffer;
+    ID3D11Buffer*               pIndexBuffer;
+
+    WidgetBuffers();
+    ~WidgetBuffers();
+    void release();
+
+private:
+    WidgetBuffers(const WidgetBuffers&);
 };
 
-typedef std::vector<DrawNumberVertex> DrawNumberVertices;
+/*
+ * The constant buffers of a deferred context. The device's own belong to the
+ * immediate context, which only rewrites them when the viewport changes; a
+ * list starts from nothing, so a deferred context writes its copies into
+ * every list and never touches the device's or what they last held.
+ */
+struct DeferredConstants
+{
+    ID3D11Device*               pDevice;
+    ID3D11Buffer*               pNumberConstants;
+    ID3D11Buffer*               pTextConstants;
+    ID3D11Buffer*               pGraphConstants;
+
+    DeferredConstants();
+    ~DeferredConstants();
+    void release();
+
+private:
+    DeferredConstants(const DeferredConstants&);
+};
 
+/*
+ * The D3D11 backend of the overlay: device objects, buffers and draws for the
+ * geometry OverlayGeometry builds.
+ */
 class DrawNumberTool
 {
 public:
+    enum { number_digits_max = OverlayGeometry::number_digits_max };
+
     static DrawNumberTool& instance()
     {
         static DrawNumberTool inst;
         return inst;
     }
-    void drawNumber(IDXGISwapChain* pSwapChain, int number) const;
+    // width and height are the cached back buffer size, used when no viewport is bound
+    void drawNumber(IDXGISwapChain* pSwapChain, QuadBuffers& buffers, int number, float x, float y, float width, float height, const OverlayConfig& cfg) const;
+    // one number per row, starting at x, y in back buffer pixels
+    void drawNumbers(IDXGISwapChain* pSwapChain, QuadBuffers& buffers, const int* numbers, int count, float x, float y, float width, float height,
+        const OverlayConfig& cfg) const;
+    // frame times as a line strip, samplesUs is a ring of capacity entries holding sampleCount samples so far
+    void drawGraph(IDXGISwapChain* pSwapChain, FrameGraphRing& ring, const uint32_t* samplesUs, uint32_t capacity, uint64_t sampleCount,
+        float x, float y, float width, float height, const OverlayConfig& cfg) const;
+    // drawNumbers through the swapchain's cached HUD target
+    void composeNumbers(IDXGISwapChain* pSwapChain, HudComposite& hud, const int* numbers, int count, float x, float y, float width, float height, const OverlayConfig& cfg) const;
+    // every string added to batch this frame in a single draw
+    void drawText(IDXGISwapChain* pSwapChain, const TextBatch& batch, QuadBuffers& buffers, float width, float height) const;
+    // a label right of each of count rows of numbers drawn from x, y, replacing what batch held
+    void layoutLabels(TextBatch& batch, const char* const* labels, int count, float x, float y, const OverlayConfig& cfg) const;
+    // the rows of drawNumbers and layoutLabels as widgets; the tree is only rebuilt when the rows change shape
+    void layoutWidgets(WidgetTree& tree, const int* numbers, const char* const* labels, int count, float x, float y, const OverlayConfig& cfg) const;
+    // uploads the widgets that changed, then draws all of them at once
+    void drawWidgets(IDXGISwapChain* pSwapChain, WidgetTree& tree, WidgetBuffers& buffers, float width, float height) const;
+    float numberHeight() const;
+    float numberWidth(const OverlayConfig& cfg) const;
 
-private:
-    DrawNumberTool();
+    // the draws above into a given context, also a deferred one on another thread, which passes its own
+    // constants; width and height are the size of the bound target, nothing is read back from the context
+    void renderNumbers(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, DeferredConstants* pDeferred, QuadBuffers& buffers,
+        const int* numbers, int count, float x, float y, float width, float height, const OverlayConfig& cfg) const;
+    void renderText(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, DeferredConstants* pDeferred, const TextBatch& batch, QuadBuffers& buffers,
+        float width, float height) const;
+    void renderGraph(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, DeferredConstants* pDeferred, FrameGraphRing& ring, const uint32_t* samplesUs,
+        uint32_t capacity, uint64_t sampleCount, float x, float y, float width, float height, const OverlayConfig& cfg) const;
+    // immediate context only: a deferred context needs a driver dependent offset for UpdateSubresource with a box
+    void renderWidgets(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, WidgetTree& tree, WidgetBuffers& buffers, float width, float height) const;
 
 private:
-    float           m_bias;
-    float           m_numWidth;
-    float           m_numHeight;
-    float           m_color[4];
+    DrawNumberTool();
 
 private:
-    void createVertices(int number, float width, float height, DrawNumberVertices& vertices) const;
-    void createVerticesFor(char digit, float x, float y, float width, float height, DrawNumberVertices& vertices) const;
-    ID3D11Buffer* createVertexBuffer(ID3D11Device* pDevice, const DrawNumberVertices& vertices) const;
-    ID3D11Buffer* createIndexBuffer(ID3D11Device* pDevice, const DrawNumberVertices& vertices) const;
+    bool renderHud(ID3D11Device* pDevice, ID3D11DeviceContext* pContext, HudComposite& hud, const int* numbers, int count, const OverlayConfig& cfg) const;
+    // grows buffers to hold quadCount quads, false when they could not be created
+    bool reserveQuads(ID3D11Device* pDevice, QuadBuffers& buffers, uint32_t quadCount) const;
+    bool uploadQuads(ID3D11DeviceContext* pContext, QuadBuffers& buffers, const void* vertices, uint32_t quadCount) const;
+    ID3D11Buffer* createIndexBuffer(ID3D11Device* pDevice, uint32_t quadCount, D3D11_USAGE usage) const;
 };
@@ -1,9 +1,15 @@
 Texture2D       numTexture : register(t0);
 SamplerState    numSampler : register(s0);
 
+cbuffer QuadConstants : register(b0)
+{
+    float4      quadScale;      // 2 / viewport width, 2 / viewport height, 1 / atlas width, 1 / atlas height
+};
+
+// positions in pixels from the top left of the viewport, texture coordinates in atlas texels
 struct VertexInput
 {
-    float4      position : POSITION;
+    float2      position : POSITION;
     float4      color : COLOR;
     float2      tex : TEXCOORD;
 };
@@ -18,9 +24,9 @@ struct PixelInput
 PixelInput DrawNumberVS(VertexInput input)
 {
     PixelInput output;
-    output.position = input.position;
+    output.position = float4(input.position.x * quadScale.x - 1.f, 1.f - input.position.y * quadScale.y, 0.f, 1.f);
     output.color = input.color;
-    output.tex = input.tex;
+    output.tex = input.tex * quadScale.zw;
     return output;
 }
 
@@ -31,3 +37,118 @@ float4 DrawNumberPS(PixelInput input) : SV_TARGET
     cr.xyz = input.color.xyz;
     return cr;
 }
+
+// the text atlas holds a distance field, 0.5 on the glyph edge; the edge is smoothed over one screen pixel at any scale
+float4 DrawTextPS(PixelInput input) : SV_TARGET
+{
+    float d = numTexture.Sample(numSampler, input.tex).x;
+    float w = max(fwidth(d), 0.0001f);
+    float4 cr;
+    cr.xyz = input.color.xyz;
+    cr.w = smoothstep(0.5f - 0.5f * w, 0.5f + 0.5f * w, d);
+    return cr;
+}
+
+Texture2D       textField : register(t1);
+
+cbuffer WidgetConstants : register(b0)
+{
+    float4      widgetScale;    // 2 / viewport width, 2 / viewport height, unused
+    float4      widgetAtlas;    // 1 / number atlas width, height, 1 / text atlas width, height
+    uint        widgetFirstText;    // first vertex of the text quads
+    uint3       widgetPadding;
+};
+
+struct WidgetPixelInput
+{
+    float4      position : SV_POSITION;
+    float4      color : COLOR;
+    float2      tex : TEXCOORD0;
+    nointerpolation uint text : TEXCOORD1;
+};
+
+// the retained widgets, number and text quads in one vertex buffer split at widgetFirstText
+WidgetPixelInput DrawWidgetVS(VertexInput input, uint id : SV_VertexID)
+{
+    WidgetPixelInput output;
+    output.position = float4(input.position.x * widgetScale.x - 1.f, 1.f - input.position.y * widgetScale.y, 0.f, 1.f);
+    output.color = input.color;
+    output.text = id >= widgetFirstText ? 1 : 0;
+    output.tex = input.tex * (output.text ? widgetAtlas.zw : widgetAtlas.xy);
+    return output;
+}
+
+// DrawNumberPS or DrawTextPS by the quad's atlas; both are sampled so the derivatives stay out of flow control
+float4 DrawWidgetPS(WidgetPixelInput input) : SV_TARGET
+{
+    float coverage = numTexture.Sample(numSampler, input.tex).x;
+    float d = textField.Sample(numSampler, input.tex).x;
+    float w = max(fwidth(d), 0.0001f);
+    float4 cr;
+    cr.xyz = input.color.xyz;
+    cr.w = input.text ? smoothstep(0.5f - 0.5f * w, 0.5f + 0.5f * w, d) : coverage;
+    return cr;
+}
+
+cbuffer GraphConstants : register(b0)
+{
+    float4      graphOrigin;    // x of the oldest sample, y of the baseline, x step per sample, y per millisecond; in NDC
+    float4      graphColor;
+    uint        graphStart;     // ring slot of the oldest sample drawn
+    uint        graphCapacity;
+    float       graphTop;
+    float       graphPadding;
+};
+
+Buffer<float>   graphSamples : register(t0);
+
+struct GraphPixelInput
+{
+    float4      position : SV_POSITION;
+    float4      color : COLOR;
+};
+
+// one line strip vertex per frame time, read straight from the ring
+GraphPixelInput FrameGraphVS(uint id : SV_VertexID)
+{
+    GraphPixelInput output;
+    float ms = graphSamples.Load((graphStart + id) % graphCapacity);
+    output.position.x = graphOrigin.x + graphOrigin.z * id;
+    output.position.y = min(graphOrigin.y + graphOrigin.w * ms, graphTop);
+    output.position.zw = float2(0.f, 1.f);
+    output.color = graphColor;
+    return output;
+}
+
+float4 FrameGraphPS(GraphPixelInput input) : SV_TARGET
+{
+    return input.color;
+}
+
+cbuffer ComposeConstants : register(b0)
+{
+    float4      composeRect;    // left, top, right, bottom in NDC
+    float4      composeTex;     // texture coordinates of the bottom right corner of the content
+};
+
+struct ComposePixelInput
+{
+    float4      position : SV_POSITION;
+    float2      tex : TEXCOORD;
+};
+
+// the cached HUD as one triangle strip quad, no vertex buffer
+ComposePixelInput ComposeVS(uint id : SV_VertexID)
+{
+    ComposePixelInput output;
+    float2 corner = float2(id & 1, id >> 1);
+    output.position = float4(lerp(composeRect.xy, composeRect.zw, corner), 0.f, 1.f);
+    output.tex = corner * composeTex.xy;
+    return output;
+}
+
+// the HUD texture holds premultiplied color
+float4 ComposePS(ComposePixelInput input) : SV_TARGET
+{
+    return numTexture.Sample(numSampler, input.tex);
+}
@@ -0,0 +1,775 @@
+/*
+ * Offline A/B comparison of frametime captures (.ftc files written by the hook).
+ *
+ *   g++ -O2 -std=c++11 -pthread FrameAnalyzer.cpp ../FrameHistogram.cpp -o FrameAnalyzer
+ *   cl /O2 /EHsc FrameAnalyzer.cpp ..\FrameHistogram.cpp
+ *
+ *   FrameAnalyzer [options] base.ftc run2.ftc [run3.ftc ...]
+ *
+ * Every run is compared against the first one. Captures are mapped into memory
+ * and reduced to log-linear histograms (1024 buckets per octave, < 0.1% relative
+ * bucket width), which are the only thing the statistics touch afterwards, so
+ * the cost per bootstrap replicate does not depend on the number of frames.
+ *
+ * Confidence intervals use the Poisson bootstrap: every bucket count c is
+ * resampled as Poisson(c), which is the large-sample equivalent of drawing
+ * frames with replacement. Like the Mann-Whitney test this treats frames as
+ * independent; consecutive frame times are correlated, so intervals and
+ * p-values are on the optimistic side and small deltas deserve a second run.
+ *
+ * Version 3 captures carry the whole-capture FrameHistogram written by the
+ * hook; its percentiles are printed per run and merged over all runs.
+ */
+#include <algorithm>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../CaptureFormat.h"
+#include "../FrameHistogram.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//==========================================================================================================================
+// memory mapped capture file
+
+class MappedFile
+{
+public:
+    MappedFile()
+    {
+        m_data = nullptr;
+        m_size = 0;
+#ifdef _WIN32
+        m_hFile = INVALID_HANDLE_VALUE;
+        m_hMapping = NULL;
+#endif
+    }
+    ~MappedFile() { close(); }
+    bool open(const char* szPath)
+    {
+#ifdef _WIN32
+        m_hFile = CreateFileA(szPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if(m_hFile == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER size;
+        if(!GetFileSizeEx(m_hFile, &size) || size.QuadPart == 0)
+            return false;
+        m_hMapping = CreateFileMappingA(m_hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+        if(!m_hMapping)
+            return false;
+        m_data = (const uint8_t*)MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+        m_size = (size_t)size.QuadPart;
+#else
+        int fd = ::open(szPath, O_RDONLY);
+        if(fd < 0)
+            return false;
+        struct stat st;
+        if(fstat(fd, &st) != 0 || st.st_size == 0) {
+            ::close(fd);
+            return false;
+        }
+        void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if(p == MAP_FAILED)
+            return false;
+        madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+        m_data = (const uint8_t*)p;
+        m_size = (size_t)st.st_size;
+#endif
+        return m_data != nullptr;
+    }
+    void close()
+    {
+#ifdef _WIN32
+        if(m_data)
+            UnmapViewOfFile(m_data);
+        if(m_hMapping)
+            CloseHandle(m_hMapping);
+        if(m_hFile != INVALID_HANDLE_VALUE)
+            CloseHandle(m_hFile);
+        m_hFile = INVALID_HANDLE_VALUE;
+        m_hMapping = NULL;
+#else
+        if(m_data)
+            munmap((void*)m_data, m_size);
+#endif
+        m_data = nullptr;
+        m_size = 0;
+    }
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+private:
+    const uint8_t*      m_data;
+    size_t              m_size;
+#ifdef _WIN32
+    HANDLE              m_hFile;
+    HANDLE              m_hMapping;
+#endif
+};
+
+//==========================================================================================================================
+// log-linear buckets taken straight from the float bit pattern: exponent plus the top
+// 10 mantissa bits, covering 2^-10 ms (~1 us) to 2^14 ms (~16 s)
+
+static const int        g_subBucketBits = 10;
+static const int        g_minExponent = -10;
+static const int        g_maxExponent = 14;
+static const int        g_bucketCount = (g_maxExponent - g_minExponent) << g_subBucketBits;
+static const int        g_keyBase = (127 + g_minExponent) << g_subBucketBits;
+
+static inline int bucketOf(float ms)
+{
+    uint32_t bits;
+    memcpy(&bits, &ms, sizeof(bits));
+    int key = (int)(bits >> (23 - g_subBucketBits)) - g_keyBase;
+    // negative floats have the sign bit set and land above the range as well
+    key = key < 0 ? 0 : key;
+    return key >= g_bucketCount ? g_bucketCount - 1 : key;
+}
+
+static double bucketValue(int bucket)
+{
+    // midpoint of the bucket
+    uint32_t bits = ((uint32_t)(bucket + g_keyBase) << (23 - g_subBucketBits)) | (1u << (22 - g_subBucketBits));
+    float ms;
+    memcpy(&ms, &bits, sizeof(ms));
+    return ms;
+}
+
+//==========================================================================================================================
+
+struct CaptureRun
+{
+    std::string             path;
+    MappedFile              file;
+    const CaptureFileHeader* header;
+    const FrameRecord*      records;
+    uint64_t                recordCount;
+    std::vector<FrameRecord> upgraded;          /* version 1-3 records widened to the current layout */
+    FrameHistogram          captureHistogram;   /* trailer of version 3 files */
+    bool                    hasHistogram;
+    double                  msPerTick;
+    // analysed range, record indices [first, last]
+    uint64_t                first;
+    uint64_t                last;
+    int64_t                 alignTicks;         /* shift applied to match the first run */
+    std::vector<double>     windowFps;
+    std::vector<uint32_t>   counts;             /* histogram of the analysed range */
+    uint64_t                frames;
+    double                  exactMeanMs;
+};
+
+struct Options
+{
+    int                     replicates;
+    double                  confidence;
+    int                     threads;
+    uint64_t                seed;
+    double                  skipSec;
+    double                  durationSec;
+    double                  windowSec;
+    bool                    align;
+    bool                    timeline;
+};
+
+static bool loadRun(const char* szPath, CaptureRun& run)
+{
+    run.path = szPath;
+    if(!run.file.open(szPath)) {
+        fprintf(stderr, "%s: cannot open\n", szPath);
+        return false;
+    }
+    if(run.file.size() < sizeof(CaptureFileHeader)) {
+        fprintf(stderr, "%s: not a capture file\n", szPath);
+        return false;
+    }
+    run.header = (const CaptureFileHeader*)run.file.data();
+    // versions 2 and 3 share the record layout, 3 adds the histogram trailer, 4 the display fields
+    bool current = run.header->version == CAPTURE_VERSION && run.header->recordSize == sizeof(FrameRecord);
+    bool legacy = (run.header->version == 1 && run.header->recordSize == CAPTURE_RECORD_SIZE_V1) ||
+        (run.header->version >= 2 && run.header->version <= 3 && run.header->recordSize == CAPTURE_RECORD_SIZE_V2);
+    if(memcmp(run.header->magic, CAPTURE_MAGIC, sizeof(run.header->magic)) != 0 || !(current || legacy) ||
+        run.header->tickFrequency == 0) {
+        fprintf(stderr, "%s: unsupported capture format\n", szPath);
+        return false;
+    }
+    const uint8_t* data = run.file.data() + sizeof(CaptureFileHeader);
+    size_t dataSize = run.file.size() - sizeof(CaptureFileHeader);
+    size_t trailerSize = 0;
+    run.hasHistogram = run.header->version >= 3 && run.captureHistogram.readTrailer(data, dataSize, trailerSize);
+    // trust the file size over the header, an interrupted session never patched frameCount
+    run.recordCount = (dataSize - trailerSize) / run.header->recordSize;
+    if(current) {
+        run.records = (const FrameRecord*)data;
+    }
+    else {
+        run.upgraded.resize((size_t)run.recordCount);
+        for(uint64_t i = 0; i < run.recordCount; i ++) {
+            memset(&run.upgraded[(size_t)i], 0, sizeof(FrameRecord));
+            memcpy(&run.upgraded[(size_t)i], data + i * run.header->recordSize, run.header->recordSize);
+        }
+        run.records = run.upgraded.empty() ? nullptr : &run.upgraded[0];
+    }
+    if(run.recordCount < 2) {
+        fprintf(stderr, "%s: fewer than two frames\n", szPath);
+        return false;
+    }
+    run.msPerTick = 1000.0 / (double)run.header->tickFrequency;
+    run.first = 0;
+    run.last = run.recordCount - 1;
+    run.alignTicks = 0;
+    return true;
+}
+
+static void buildTimeline(CaptureRun& run, double windowSec)
+{
+    uint64_t window = (uint64_t)(windowSec * (double)run.header->tickFrequency);
+    if(window == 0)
+        window = 1;
+    uint64_t start = run.records[0].presentStart;
+    uint64_t span = run.records[run.recordCount - 1].presentStart - start;
+    run.windowFps.assign((size_t)(span / window) + 1, 0.0);
+    for(uint64_t i = 1; i < run.recordCount; i ++)
+        run.windowFps[(size_t)((run.records[i].presentStart - start) / window)] += 1.0;
+    for(size_t i = 0; i < run.windowFps.size(); i ++)
+        run.windowFps[i] /= windowSec;
+    // the last window is usually partial
+    if(run.windowFps.size() > 1)
+        run.windowFps.pop_back();
+}
+
+// lag (in windows) of b against a that maximises the correlation of the overlapping fps series
+static int bestLag(const std::vector<double>& a, const std::vector<double>& b)
+{
+    // keep at least three quarters of the shorter run in the overlap
+    int maxLag = (int)std::min(a.size(), b.size()) / 4;
+    int best = 0;
+    double bestCorr = -2.0;
+    for(int lag = -maxLag; lag <= maxLag; lag ++) {
+        // b[i + lag] is compared with a[i]
+        int begin = std::max(0, -lag);
+        int end = std::min((int)a.size(), (int)b.size() - lag);
+        int n = end - begin;
+        if(n < 8)
+            continue;
+        double sa = 0, sb = 0, saa = 0, sbb = 0, sab = 0;
+        for(int i = begin; i < end; i ++) {
+            double x = a[i], y = b[i + lag];
+            sa += x;
+            sb += y;
+            saa += x * x;
+            sbb += y * y;
+            sab += x * y;
+        }
+        double cov = sab - sa * sb / n;
+        double va = saa - sa * sa / n;
+        double vb = sbb - sb * sb / n;
+        if(va <= 0 || vb <= 0)
+            continue;
+        double corr = cov / sqrt(va * vb);
+        if(corr > bestCorr) {
+            bestCorr = corr;
+            best = lag;
+        }
+    }
+    return best;
+}
+
+static uint64_t firstRecordAtOrAfter(const CaptureRun& run, uint64_t tick)
+{
+    uint64_t lo = 0, hi = run.recordCount;
+    while(lo < hi) {
+        uint64_t mid = (lo + hi) / 2;
+        if(run.records[mid].presentStart < tick)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+// picks [first, last] from --skip/--duration, measured on the aligned timeline
+static void selectRange(CaptureRun& run, const Options& opt, double commonSec)
+{
+    double freq = (double)run.header->tickFrequency;
+    uint64_t start = run.records[0].presentStart;
+    int64_t offset = (int64_t)(opt.skipSec * freq) + run.alignTicks;
+    uint64_t from = offset > 0 ? start + (uint64_t)offset : start;
+    run.first = firstRecordAtOrAfter(run, from);
+    double lengthSec = opt.durationSec > 0 ? opt.durationSec : commonSec;
+    run.last = run.recordCount - 1;
+    if(lengthSec > 0) {
+        uint64_t to = run.records[std::min(run.first, run.recordCount - 1)].presentStart + (uint64_t)(lengthSec * freq);
+        uint64_t end = firstRecordAtOrAfter(run, to);
+        if(end < run.recordCount)
+            run.last = end;
+    }
+    if(run.first >= run.recordCount)
+        run.first = run.recordCount - 1;
+}
+
+static void buildHistogram(CaptureRun& run, int threads)
+{
+    uint64_t n = run.last > run.first ? run.last - run.first : 0;
+    run.frames = n;
+    run.counts.assign(g_bucketCount, 0);
+    if(n == 0) {
+        run.exactMeanMs = 0;
+        return;
+    }
+    run.exactMeanMs = (double)(run.records[run.last].presentStart - run.records[run.first].presentStart) * run.msPerTick / (double)n;
+    std::vector<std::vector<uint32_t> > partial(threads, std::vector<uint32_t>(g_bucketCount, 0));
+    std::vector<std::thread> pool;
+    uint64_t chunk = (n + threads - 1) / threads;
+    const float msPerTick = (float)run.msPerTick;
+    for(int t = 0; t < threads; t ++) {
+        uint64_t begin = run.first + 1 + chunk * t;
+        uint64_t end = std::min(run.first + 1 + chunk * (t + 1), run.last + 1);
+        if(begin >= end)
+            break;
+        // scalar: the 64 bit to float conversion over 48 byte records and the scatter into the buckets
+        // do not vectorise. It streams the mapped file and is bound by memory bandwidth; splitting the
+        // scatter over several sub-histograms to break runs of equal keys measured no faster
+        pool.push_back(std::thread([&run, &partial, t, begin, end, msPerTick]() {
+            uint32_t* counts = &partial[t][0];
+            const FrameRecord* rec = run.records;
+            for(uint64_t i = begin; i < end; i ++) {
+                float ms = (float)(rec[i].presentStart - rec[i - 1].presentStart) * msPerTick;
+                counts[bucketOf(ms)] ++;
+            }
+        }));
+    }
+    for(size_t t = 0; t < pool.size(); t ++)
+        pool[t].join();
+    for(size_t t = 0; t < pool.size(); t ++) {
+        for(int b = 0; b < g_bucketCount; b ++)
+            run.counts[b] += partial[t][b];
+    }
+}
+
+//==========================================================================================================================
+// bootstrap
+
+class Rng
+{
+public:
+    explicit Rng(uint64_t seed) { m_state = seed; }
+    uint64_t next()
+    {
+        // splitmix64
+        uint64_t z = (m_state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+    double uniform() { return (double)(next() >> 11) * (1.0 / 9007199254740992.0); }
+    double normal()
+    {
+        double u1 = uniform(), u2 = uniform();
+        if(u1 < 1e-300)
+            u1 = 1e-300;
+        return sqrt(-2.0 * log(u1)) * cos(6.283185307179586 * u2);
+    }
+    uint32_t poisson(uint32_t lambda)
+    {
+        if(lambda == 0)
+            return 0;
+        if(lambda < 64) {
+            // Knuth's multiplication method, cost grows with lambda
+            double limit = exp(-(double)lambda);
+            double p = uniform();
+            uint32_t k = 0;
+            while(p > limit) {
+                p *= uniform();
+                k ++;
+            }
+            return k;
+        }
+        double v = (double)lambda + sqrt((double)lambda) * normal() + 0.5;
+        return v <= 0 ? 0 : (uint32_t)v;
+    }
+
+private:
+    uint64_t            m_state;
+};
+
+static const double     g_percentiles[] = { 50.0, 95.0, 99.0, 99.9 };
+static const int        g_percentileCount = sizeof(g_percentiles) / sizeof(g_percentiles[0]);
+static const int        g_metricCount = 1 + g_percentileCount;     /* mean, then the percentiles */
+static const char*      g_metricNames[g_metricCount] = { "mean", "p50", "p95", "p99", "p99.9" };
+
+// mean and percentiles of a weighted histogram; weights may be the original counts or a resample
+static void histogramMetrics(const uint32_t* weights, const double* values, double* metrics)
+{
+    double total = 0, sum = 0;
+    for(int b = 0; b < g_bucketCount; b ++) {
+        total += weights[b];
+        sum += weights[b] * values[b];
+    }
+    metrics[0] = total > 0 ? sum / total : 0;
+    double cumulative = 0;
+    int p = 0;
+    for(int b = 0; b < g_bucketCount && p < g_percentileCount; b ++) {
+        cumulative += weights[b];
+        while(p < g_percentileCount && cumulative >= g_percentiles[p] / 100.0 * total)
+            metrics[1 + p ++] = values[b];
+    }
+    while(p < g_percentileCount)
+        metrics[1 + p ++] = values[g_bucketCount - 1];
+}
+
+// replicates[r * g_metricCount + m]
+static void bootstrapRun(const CaptureRun& run, int runIndex, const Options& opt, const double* values, std::vector<double>& replicates)
+{
+    replicates.assign((size_t)opt.replicates * g_metricCount, 0.0);
+    // populated buckets only; typical captures touch a few thousand of them
+    std::vector<int> used;
+    for(int b = 0; b < g_bucketCount; b ++) {
+        if(run.counts[b])
+            used.push_back(b);
+    }
+    std::vector<std::thread> pool;
+    for(int t = 0; t < opt.threads; t ++) {
+        pool.push_back(std::thread([&, t]() {
+            std::vector<uint32_t> weights(g_bucketCount, 0);
+            for(int r = t; r < opt.replicates; r += opt.threads) {
+                // seeded per replicate so results do not depend on the thread count; splitmix64 steps its
+                // state by the same constant, so the seed is hashed once, or replicate r + 1 would replay
+                // the stream of replicate r one draw later
+                Rng rng(Rng(opt.seed ^ ((uint64_t)runIndex << 40) ^ ((uint64_t)r * 0x9e3779b97f4a7c15ull)).next());
+                for(size_t i = 0; i < used.size(); i ++)
+                    weights[used[i]] = rng.poisson(run.counts[used[i]]);
+                histogramMetrics(&weights[0], values, &replicates[(size_t)r * g_metricCount]);
+            }
+        }));
+    }
+    for(size_t t = 0; t < pool.size(); t ++)
+        pool[t].join();
+}
+
+static void interval(std::vector<double>& samples, double confidence, double& lo, double& hi)
+{
+    std::sort(samples.begin(), samples.end());
+    double alpha = (1.0 - confidence) / 2.0;
+    size_t n = samples.size();
+    size_t iLo = (size_t)(alpha * (double)(n - 1) + 0.5);
+    size_t iHi = (size_t)((1.0 - alpha) * (double)(n - 1) + 0.5);
+    lo = samples[iLo];
+    hi = samples[iHi];
+}
+
+// interval of metric m of one run over its replicates
+static void metricInterval(const std::vector<double>& replicates, int m, const Options& opt, double& lo, double& hi)
+{
+    std::vector<double> samples(opt.replicates);
+    for(int r = 0; r < opt.replicates; r ++)
+        samples[r] = replicates[(size_t)r * g_metricCount + m];
+    interval(samples, opt.confidence, lo, hi);
+}
+
+// interval of the change of metric m from run a to run b in percent, replicate against replicate
+static void deltaInterval(const std::vector<double>& a, const std::vector<double>& b, int m, const Options& opt, double& lo, double& hi)
+{
+    std::vector<double> delta(opt.replicates);
+    for(int r = 0; r < opt.replicates; r ++) {
+        double va = a[(size_t)r * g_metricCount + m];
+        double vb = b[(size_t)r * g_metricCount + m];
+        delta[r] = va > 0 ? (vb / va - 1.0) * 100.0 : 0.0;
+    }
+    interval(delta, opt.confidence, lo, hi);
+}
+
+//==========================================================================================================================
+// Mann-Whitney U on the bucketed distributions; frames sharing a bucket count as ties
+
+struct MannWhitney
+{
+    double              u;
+    double              z;
+    double              pValue;
+    double              probBFaster;        /* P(frame of B shorter than frame of A) */
+};
+
+static MannWhitney mannWhitney(const CaptureRun& a, const CaptureRun& b)
+{
+    MannWhitney r;
+    memset(&r, 0, sizeof(r));
+    double na = (double)a.frames, nb = (double)b.frames;
+    if(na == 0 || nb == 0)
+        return r;
+    // U for B: pairs where the B frame is shorter, ties counted half
+    double belowA = 0, u = 0, tieTerm = 0;
+    for(int k = 0; k < g_bucketCount; k ++) {
+        double ca = a.counts[k], cb = b.counts[k];
+        u += cb * (na - belowA - ca) + 0.5 * cb * ca;
+        belowA += ca;
+        double t = ca + cb;
+        tieTerm += t * t * t - t;
+    }
+    double n = na + nb;
+    double mean = na * nb / 2.0;
+    double var = na * nb / 12.0 * ((n + 1.0) - tieTerm / (n * (n - 1.0)));
+    r.u = u;
+    r.z = var > 0 ? (u - mean) / sqrt(var) : 0;
+    r.pValue = erfc(fabs(r.z) / sqrt(2.0));
+    r.probBFaster = u / (na * nb);
+    return r;
+}
+
+//==========================================================================================================================
+
+static void usage()
+{
+    fprintf(stderr,
+        "usage: FrameAnalyzer [options] base.ftc run.ftc [run.ftc ...]\n"
+        "  --bootstrap N     bootstrap replicates (2000)\n"
+        "  --confidence C    confidence level of the intervals (0.95)\n"
+        "  --threads N       worker threads (all cores)\n"
+        "  --seed N          random seed (1)\n"
+        "  --skip S          ignore the first S seconds of every run\n"
+        "  --duration S      analyse at most S seconds of every run\n"
+        "  --align           shift every run to best match the fps timeline of the base run\n"
+        "                    and compare the overlapping part only\n"
+        "  --window S        timeline resolution in seconds (1)\n"
+        "  --timeline        print the aligned per-window fps of all runs\n");
+}
+
+static bool parseOptions(int argc, char** argv, Options& opt, std::vector<const char*>& paths)
+{
+    opt.replicates = 2000;
+    opt.confidence = 0.95;
+    opt.threads = (int)std::thread::hardware_concurrency();
+    opt.seed = 1;
+    opt.skipSec = 0;
+    opt.durationSec = 0;
+    opt.windowSec = 1.0;
+    opt.align = false;
+    opt.timeline = false;
+    for(int i = 1; i < argc; i ++) {
+        const char* a = argv[i];
+        bool hasValue = i + 1 < argc;
+        if(strcmp(a, "--bootstrap") == 0 && hasValue)
+            opt.replicates = atoi(argv[++ i]);
+        else if(strcmp(a, "--confidence") == 0 && hasValue)
+            opt.confidence = atof(argv[++ i]);
+        else if(strcmp(a, "--threads") == 0 && hasValue)
+            opt.threads = atoi(argv[++ i]);
+        else if(strcmp(a, "--seed") == 0 && hasValue)
+            opt.seed = strtoull(argv[++ i], nullptr, 10);
+        else if(strcmp(a, "--skip") == 0 && hasValue)
+            opt.skipSec = atof(argv[++ i]);
+        else if(strcmp(a, "--duration") == 0 && hasValue)
+            opt.durationSec = atof(argv[++ i]);
+        else if(strcmp(a, "--window") == 0 && hasValue)
+            opt.windowSec = atof(argv[++ i]);
+        else if(strcmp(a, "--align") == 0)
+            opt.align = true;
+        else if(strcmp(a, "--timeline") == 0)
+            opt.timeline = true;
+        else if(a[0] == '-' && a[1] == '-')
+            return false;
+        else
+            paths.push_back(a);
+    }
+    if(opt.threads < 1)
+        opt.threads = 1;
+    if(opt.replicates < 100 || opt.confidence <= 0 || opt.confidence >= 1 || opt.windowSec <= 0)
+        return false;
+    return paths.size() >= 2;
+}
+
+int main(int argc, char** argv)
+{
+    Options opt;
+    std::vector<const char*> paths;
+    if(!parseOptions(argc, argv, opt, paths)) {
+        usage();
+        return 2;
+    }
+    std::vector<CaptureRun*> runs;
+    for(size_t i = 0; i < paths.size(); i ++) {
+        CaptureRun* run = new CaptureRun;
+        if(!loadRun(paths[i], *run))
+            return 1;
+        buildTimeline(*run, opt.windowSec);
+        runs.push_back(run);
+    }
+
+    // timeline alignment against the base run
+    double commonSec = 0;
+    if(opt.align) {
+        double start = 0, end = 1e300;
+        for(size_t i = 0; i < runs.size(); i ++) {
+            CaptureRun& run = *runs[i];
+            int lag = i == 0 ? 0 : bestLag(runs[0]->windowFps, run.windowFps);
+            run.alignTicks = (int64_t)((double)lag * opt.windowSec * (double)run.header->tickFrequency);
+            double length = (double)(run.records[run.recordCount - 1].presentStart - run.records[0].presentStart) /
+                (double)run.header->tickFrequency;
+            // the run covers [-lag, length - lag] on the base timeline
+            start = std::max(start, -lag * opt.windowSec);
+            end = std::min(end, length - lag * opt.windowSec);
+        }
+        // shift every run so all of them start at the common start
+        for(size_t i = 0; i < runs.size(); i ++)
+            runs[i]->alignTicks += (int64_t)(start * (double)runs[i]->header->tickFrequency);
+        commonSec = end - start - opt.skipSec;
+        if(commonSec <= 0) {
+            fprintf(stderr, "runs do not overlap after alignment\n");
+            return 1;
+        }
+    }
+
+    std::vector<double> values(g_bucketCount);
+    for(int b = 0; b < g_bucketCount; b ++)
+        values[b] = bucketValue(b);
+
+    std::vector<std::vector<double> > replicates(runs.size());
+    for(size_t i = 0; i < runs.size(); i ++) {
+        selectRange(*runs[i], opt, commonSec);
+        buildHistogram(*runs[i], opt.threads);
+        if(runs[i]->frames < 2) {
+            fprintf(stderr, "%s: no frames in the selected range\n", runs[i]->path.c_str());
+            return 1;
+        }
+        bootstrapRun(*runs[i], (int)i, opt, &values[0], replicates[i]);
+    }
+
+    printf("bootstrap: %d Poisson replicates, %.0f%% intervals, frame times in ms\n\n", opt.replicates, opt.confidence * 100.0);
+    for(size_t i = 0; i < runs.size(); i ++) {
+        const CaptureRun& run = *runs[i];
+        double seconds = (double)(run.records[run.last].presentStart - run.records[run.first].presentStart) /
+            (double)run.header->tickFrequency;
+        printf("run %d: %s\n", (int)i + 1, run.path.c_str());
+        printf("  frames %llu, %.1f s, avg %.2f fps, dropped by writer %llu", (unsigned long long)run.frames, seconds,
+            1000.0 / run.exactMeanMs, (unsigned long long)run.header->droppedCount);
+        if(opt.align)
+            printf(", aligned by %+.1f s", (double)run.alignTicks / (double)run.header->tickFrequency);
+        printf("\n");
+        if(run.header->version >= 2) {
+            uint64_t hitches = 0, shifts = 0;
+            for(uint64_t r = run.first + 1; r <= run.last; r ++) {
+                if(run.records[r].events & fe_hitch)
+                    hitches ++;
+                if(run.records[r].events & fe_level_shift)
+                    shifts ++;
+            }
+            printf("  stutter detector: %llu hitches, %llu level shifts\n", (unsigned long long)hitches, (unsigned long long)shifts);
+        }
+        if(run.header->version >= 4) {
+            uint64_t dropped = 0, unknown = 0, displayed = 0;
+            double latencyMs = 0.0;
+            for(uint64_t r = run.first + 1; r <= run.last; r ++) {
+                const FrameRecord& rec = run.records[r];
+                if(rec.events & fe_dropped)
+                    dropped ++;
+                else if(rec.events & fe_display_unknown)
+                    unknown ++;
+                else if(rec.displayTime > rec.presentStart) {
+                    displayed ++;
+                    latencyMs += (double)(rec.displayTime - rec.presentStart) * run.msPerTick;
+                }
+            }
+            printf("  display: %llu dropped, %llu without statistics", (unsigned long long)dropped, (unsigned long long)unknown);
+            if(displayed)
+                printf(", present to display avg %.2f ms", latencyMs / (double)displayed);
+            printf("\n");
+        }
+        if(run.hasHistogram) {
+            printf("  whole capture histogram: %llu frames, p50 %.3f, p99 %.3f, p99.9 %.3f ms\n",
+                (unsigned long long)run.captureHistogram.count(), run.captureHistogram.percentile(50.0) / 1e6,
+                run.captureHistogram.percentile(99.0) / 1e6, run.captureHistogram.percentile(99.9) / 1e6);
+        }
+        double point[g_metricCount];
+        histogramMetrics(&run.counts[0], &values[0], point);
+        point[0] = run.exactMeanMs;
+        for(int m = 0; m < g_metricCount; m ++) {
+            double lo, hi;
+            metricInterval(replicates[i], m, opt, lo, hi);
+            printf("  %-6s %9.3f  [%9.3f, %9.3f]\n", g_metricNames[m], point[m], lo, hi);
+        }
+        printf("\n");
+    }
+
+    for(size_t i = 1; i < runs.size(); i ++) {
+        printf("run %d vs run 1 (negative = shorter frame times)\n", (int)i + 1);
+        for(int m = 0; m < g_metricCount; m ++) {
+            double lo, hi;
+            deltaInterval(replicates[0], replicates[i], m, opt, lo, hi);
+            double a = m == 0 ? runs[0]->exactMeanMs : 0, b = m == 0 ? runs[i]->exactMeanMs : 0;
+            if(m != 0) {
+                double pa[g_metricCount], pb[g_metricCount];
+                histogramMetrics(&runs[0]->counts[0], &values[0], pa);
+                histogramMetrics(&runs[i]->counts[0], &values[0], pb);
+                a = pa[m];
+                b = pb[m];
+            }
+            bool significant = lo > 0 || hi < 0;
+            printf("  %-6s %+8.2f%%  [%+8.2f%%, %+8.2f%%]%s\n", g_metricNames[m], a > 0 ? (b / a - 1.0) * 100.0 : 0.0, lo, hi,
+                significant ? "  *" : "");
+        }
+        MannWhitney mw = mannWhitney(*runs[0], *runs[i]);
+        printf("  Mann-Whitney U = %.0f, z = %.2f, p = %.3g, P(run %d frame shorter) = %.3f\n\n", mw.u, mw.z, mw.pValue,
+            (int)i + 1, mw.probBFaster);
+    }
+
+    FrameHistogram* pMerged = new FrameHistogram;
+    int merged = 0;
+    for(size_t i = 0; i < runs.size(); i ++) {
+        if(runs[i]->hasHistogram) {
+            pMerged->merge(runs[i]->captureHistogram);
+            merged ++;
+        }
+    }
+    if(merged > 1) {
+        printf("all %d capture histograms merged: %llu frames, p50 %.3f, p99 %.3f, p99.9 %.3f ms\n\n", merged,
+            (unsigned long long)pMerged->count(), pMerged->percentile(50.0) / 1e6, pMerged->percentile(99.0) / 1e6,
+            pMerged->percentile(99.9) / 1e6);
+    }
+    delete pMerged;
+
+    if(opt.timeline) {
+        printf("timeline (fps per %.2f s window, aligned)\n", opt.windowSec);
+        printf("%10s", "t[s]");
+        for(size_t i = 0; i < runs.size(); i ++)
+            printf("  %8s%d", "run", (int)i + 1);
+        printf("\n");
+        int windows = 0;
+        std::vector<int> offsets(runs.size());
+        for(size_t i = 0; i < runs.size(); i ++) {
+            offsets[i] = (int)floor((double)runs[i]->alignTicks / (double)runs[i]->header->tickFrequency / opt.windowSec + 0.5);
+            windows = std::max(windows, (int)runs[i]->windowFps.size() - offsets[i]);
+        }
+        for(int w = 0; w < windows; w ++) {
+            printf("%10.2f", w * opt.windowSec);
+            for(size_t i = 0; i < runs.size(); i ++) {
+                int k = w + offsets[i];
+                if(k >= 0 && k < (int)runs[i]->windowFps.size())
+                    printf("  %9.1f", runs[i]->windowFps[k]);
+                else
+                    printf("  %9s", "-");
+            }
+            printf("\n");
+        }
+    }
+
+    for(size_t i = 0; i < runs.size(); i ++)
+        delete runs[i];
+    return 0;
+}
@@ -0,0 +1,40 @@
+#include "FrameArena.h"
+
+FrameArena& FrameArena::current()
+{
+    static thread_local FrameArena arena;
+    return arena;
+}
+
+FrameArena::FrameArena()
+{
+    m_blocks = nullptr;
+    m_frame = 0;
+    m_used = 0;
+    m_peak = 0;
+}
+
+FrameArena::~FrameArena()
+{
+    delete[] m_blocks;
+}
+
+void FrameArena::beginFrame()
+{
+    m_frame = (m_frame + 1) % frames_in_flight;
+    m_used = 0;
+}
+
+void* FrameArena::allocate(size_t bytes, size_t alignment)
+{
+    if(!m_blocks)
+        m_blocks = new uint8_t[frames_in_flight * block_size];
+    // alignment is a power of two; the blocks come from new, aligned for any scalar type
+    size_t offset = (m_used + alignment - 1) & ~(alignment - 1);
+    if(offset + bytes > block_size)
+        return nullptr;
+    m_used = offset + bytes;
+    if(m_used > m_peak)
+        m_peak = m_used;
+    return m_blocks + (size_t)m_frame * block_size + offset;
+}
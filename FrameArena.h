@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Scratch memory of the overlay for one frame: vertices, indices and
+ * whatever else only lives until the draw is issued. Allocation bumps an
+ * offset through one of frames_in_flight fixed blocks; beginFrame, once per
+ * Present, moves on to the next block and forgets what it held, so memory
+ * handed out stays valid through the following frame as well. Each thread
+ * drawing the overlay has its own arena, whose blocks are reserved with its
+ * first frame; after that the overlay does not touch the heap. A request
+ * that does not fit returns nullptr and the caller skips that draw, as
+ * TextLayoutCache does. Plain C++ without D3D types.
+ */
+class FrameArena
+{
+public:
+    enum
+    {
+        frames_in_flight = 2,
+        block_size = 64 * 1024,
+    };
+
+    // the calling thread's arena
+    static FrameArena& current();
+
+    FrameArena();
+    ~FrameArena();
+    void beginFrame();
+    void* allocate(size_t bytes, size_t alignment = 16);
+    template<class T> T* allocate(size_t count) { return (T*)allocate(count * sizeof(T), alignof(T)); }
+    size_t used() const { return m_used; }
+    // most any frame used so far, for sizing block_size
+    size_t peak() const { return m_peak; }
+
+private:
+    FrameArena(const FrameArena&);
+    FrameArena& operator=(const FrameArena&);
+
+private:
+    uint8_t*            m_blocks;           /* frames_in_flight blocks of block_size */
+    uint32_t            m_frame;
+    size_t              m_used;
+    size_t              m_peak;
+};
@@ -0,0 +1,259 @@
+#include "FrameCapture.h"
+#include "FrameClock.h"
+#include "TextFormat.h"
+#include <cassert>
+#include <string.h>
+#include <stdlib.h>
+
+// frames are dropped before the queue is completely full, so begin/end markers always fit
+static const int        g_reservedItems = 2;
+
+static const char*      g_csvHeader = "Application,ProcessID,Runtime,SyncInterval,PresentFlags,"
+                                      "TimeInSeconds,MsBetweenPresents,MsInPresentAPI,Dropped,MsBetweenDisplayChange,MsUntilDisplayed\r\n";
+// prefix plus eight numbers, separators and the line break
+static const size_t     g_csvRowMax = MAX_PATH + 32 + 8 * text_fixed_max + 12;
+
+FrameCapture::FrameCapture()
+{
+    m_active = false;
+    m_csvExport = false;
+    m_dropped = 0;
+    m_file = nullptr;
+    memset(&m_header, 0, sizeof(m_header));
+    m_prevFrameStart = 0;
+    m_csvFile = nullptr;
+    m_csvPrefix[0] = 0;
+    m_csvPrefixLen = 0;
+    m_csvFirstTick = 0;
+    m_csvPrevTick = 0;
+    m_csvPrevDisplay = 0;
+    m_csvLen = 0;
+    m_hStopEvent = NULL;
+    m_hThread = NULL;
+}
+
+void FrameCapture::ensureWriter()
+{
+    if(m_hThread)
+        return;
+    m_hStopEvent = CreateEventA(NULL, TRUE, FALSE, NULL);
+    m_hThread = CreateThread(NULL, 0, writerProc, this, 0, NULL);
+}
+
+bool FrameCapture::start(const char* szPath)
+{
+    assert(szPath);
+    if(m_active)
+        return false;
+    ensureWriter();
+    Item item;
+    memset(&item, 0, sizeof(item));
+    item.kind = ik_begin;
+    item.path = _strdup(szPath);
+    item.csv = m_csvExport;
+    if(!m_queue.push(item)) {
+        free(item.path);
+        return false;
+    }
+    m_dropped = 0;
+    m_active = true;
+    return true;
+}
+
+void FrameCapture::stop()
+{
+    if(!m_active)
+        return;
+    Item item;
+    memset(&item, 0, sizeof(item));
+    item.kind = ik_end;
+    item.dropped = m_dropped;
+    bool pushed = m_queue.push(item);
+    assert(pushed);
+    (void)pushed;
+    m_active = false;
+}
+
+void FrameCapture::record(const FrameRecord& rec)
+{
+    if(!m_active)
+        return;
+    if(m_queue.size() >= queue_size - g_reservedItems) {
+        m_dropped ++;
+        return;
+    }
+    Item item;
+    item.kind = ik_frame;
+    item.frame = rec;
+    item.path = nullptr;
+    item.csv = false;
+    item.dropped = 0;
+    m_queue.push(item);
+}
+
+void FrameCapture::shutdown()
+{
+    // called from DllMain, so signal only and never wait on the thread
+    if(m_hStopEvent)
+        SetEvent(m_hStopEvent);
+}
+
+void FrameCapture::openFile(char* szPath, bool csv)
+{
+    if(m_file)
+        closeFile(0);
+    m_file = fopen(szPath, "wb");
+    if(m_file && csv)
+        openCsv(szPath);
+    free(szPath);
+    if(!m_file)
+        return;
+    setvbuf(m_file, nullptr, _IOFBF, 64 * 1024);
+    memset(&m_header, 0, sizeof(m_header));
+    memcpy(m_header.magic, CAPTURE_MAGIC, sizeof(m_header.magic));
+    m_header.version = CAPTURE_VERSION;
+    m_header.recordSize = sizeof(FrameRecord);
+    m_header.tickFrequency = FrameClock::instance().frequency();
+    fwrite(&m_header, sizeof(m_header), 1, m_file);
+    m_histogram.reset();
+    m_prevFrameStart = 0;
+}
+
+void FrameCapture::closeFile(uint64_t dropped)
+{
+    if(!m_file)
+        return;
+    m_histogram.write(m_file);
+    // patch the counters now that the session is complete
+    m_header.droppedCount = dropped;
+    fseek(m_file, 0, SEEK_SET);
+    fwrite(&m_header, sizeof(m_header), 1, m_file);
+    fclose(m_file);
+    m_file = nullptr;
+    closeCsv();
+}
+
+void FrameCapture::openCsv(const char* szCapturePath)
+{
+    char path[MAX_PATH];
+    strncpy(path, szCapturePath, sizeof(path) - 5);
+    path[sizeof(path) - 5] = 0;
+    char* dot = strrchr(path, '.');
+    char* slash = strrchr(path, '\\');
+    if(dot && (!slash || dot > slash))
+        *dot = 0;
+    strcat(path, ".csv");
+    m_csvFile = fopen(path, "wb");
+    if(!m_csvFile)
+        return;
+    // rows go through m_csvBuffer, so the stdio buffer would only add a copy
+    setvbuf(m_csvFile, nullptr, _IONBF, 0);
+
+    char module[MAX_PATH];
+    DWORD len = GetModuleFileNameA(NULL, module, MAX_PATH);
+    if(len == 0 || len >= MAX_PATH)
+        strcpy(module, "unknown");
+    char* name = strrchr(module, '\\');
+    name = name ? name + 1 : module;
+    char* p = m_csvPrefix;
+    for(; *name; name ++)
+        *p ++ = (*name == ',' || *name == '"') ? '_' : *name;
+    *p ++ = ',';
+    p = appendUInt(p, GetCurrentProcessId());
+    p = appendString(p, ",DXGI,");
+    m_csvPrefixLen = p - m_csvPrefix;
+
+    m_csvFirstTick = 0;
+    m_csvPrevTick = 0;
+    m_csvPrevDisplay = 0;
+    m_csvLen = 0;
+    fputs(g_csvHeader, m_csvFile);
+}
+
+void FrameCapture::writeCsvRow(const FrameRecord& rec)
+{
+    if(csv_buffer_size - m_csvLen < g_csvRowMax)
+        flushCsv();
+    if(m_csvFirstTick == 0) {
+        m_csvFirstTick = rec.presentStart;
+        m_csvPrevTick = rec.presentStart;
+    }
+    uint64_t freq = m_header.tickFrequency;
+    char* p = m_csvBuffer + m_csvLen;
+    memcpy(p, m_csvPrefix, m_csvPrefixLen);
+    p += m_csvPrefixLen;
+    p = appendUInt(p, rec.syncInterval);
+    *p ++ = ',';
+    p = appendUInt(p, rec.presentFlags);
+    *p ++ = ',';
+    p = appendRatio(p, rec.presentStart - m_csvFirstTick, freq, 6);
+    *p ++ = ',';
+    p = appendRatio(p, (rec.presentStart - m_csvPrevTick) * 1000, freq, 3);
+    *p ++ = ',';
+    p = appendRatio(p, (rec.presentEnd - rec.presentStart) * 1000, freq, 3);
+    // PresentMon writes 0 for the display columns of frames that never reached the screen
+    bool displayed = rec.displayTime != 0;
+    p = appendString(p, (rec.events & fe_dropped) ? ",1," : ",0,");
+    p = appendRatio(p, displayed && m_csvPrevDisplay ? (rec.displayTime - m_csvPrevDisplay) * 1000 : 0, freq, 3);
+    *p ++ = ',';
+    p = appendRatio(p, displayed && rec.displayTime > rec.presentStart ? (rec.displayTime - rec.presentStart) * 1000 : 0, freq, 3);
+    if(displayed)
+        m_csvPrevDisplay = rec.displayTime;
+    *p ++ = '\r';
+    *p ++ = '\n';
+    m_csvLen = p - m_csvBuffer;
+    m_csvPrevTick = rec.presentStart;
+}
+
+void FrameCapture::flushCsv()
+{
+    if(m_csvFile && m_csvLen)
+        fwrite(m_csvBuffer, 1, m_csvLen, m_csvFile);
+    m_csvLen = 0;
+}
+
+void FrameCapture::closeCsv()
+{
+    if(!m_csvFile)
+        return;
+    flushCsv();
+    fclose(m_csvFile);
+    m_csvFile = nullptr;
+}
+
+void FrameCapture::drain()
+{
+    Item item;
+    while(m_queue.pop(item)) {
+        switch(item.kind)
+        {
+        case ik_begin:
+            openFile(item.path, item.csv);
+            break;
+        case ik_frame:
+            if(m_file) {
+                fwrite(&item.frame, sizeof(item.frame), 1, m_file);
+                m_header.frameCount ++;
+                if(m_prevFrameStart)
+                    m_histogram.recordTicks(item.frame.presentStart - m_prevFrameStart, m_header.tickFrequency);
+                m_prevFrameStart = item.frame.presentStart;
+                if(m_csvFile)
+                    writeCsvRow(item.frame);
+            }
+            break;
+        case ik_end:
+            closeFile(item.dropped);
+            break;
+        }
+    }
+}
+
+DWORD __stdcall FrameCapture::writerProc(LPVOID lpParam)
+{
+    FrameCapture* pThis = (FrameCapture*)lpParam;
+    while(WaitForSingleObject(pThis->m_hStopEvent, 10) == WAIT_TIMEOUT)
+        pThis->drain();
+    pThis->drain();
+    pThis->closeFile(0);
+    return 0;
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <Windows.h>
+#include <stdio.h>
+#include "CaptureFormat.h"
+#include "FrameHistogram.h"
+#include "SpscQueue.h"
+
+/*
+ * Per-frame timing capture. The render thread only pushes fixed-size items into
+ * a lock-free queue; opening, writing and closing the file all happen on the
+ * writer thread. With csv export enabled the writer also streams a
+ * PresentMon-style .csv next to the capture, so CapFrameX and other PresentMon
+ * tooling can read a session directly. The frame time histogram of the
+ * capture is appended when the file is closed.
+ */
+class FrameCapture
+{
+public:
+    static FrameCapture& instance()
+    {
+        static FrameCapture inst;
+        return inst;
+    }
+    // render thread only
+    bool isActive() const { return m_active; }
+    // applies to captures started afterwards
+    void setCsvExport(bool enable) { m_csvExport = enable; }
+    bool start(const char* szPath);
+    void stop();
+    void record(const FrameRecord& rec);
+    int backlog() const { return m_queue.size(); }
+    void shutdown();
+
+private:
+    FrameCapture();
+    FrameCapture(const FrameCapture&);
+
+    enum { queue_size = 8192, csv_buffer_size = 64 * 1024 };
+
+    enum ItemKind
+    {
+        ik_begin,
+        ik_frame,
+        ik_end,
+    };
+
+    struct Item
+    {
+        ItemKind        kind;
+        FrameRecord     frame;
+        char*           path;               /* ik_begin only, freed by the writer */
+        bool            csv;                /* ik_begin only */
+        uint64_t        dropped;            /* ik_end only */
+    };
+
+    void ensureWriter();
+    void drain();
+    void openFile(char* szPath, bool csv);
+    void closeFile(uint64_t dropped);
+    void openCsv(const char* szCapturePath);
+    void writeCsvRow(const FrameRecord& rec);
+    void flushCsv();
+    void closeCsv();
+    static DWORD __stdcall writerProc(LPVOID lpParam);
+
+private:
+    SpscQueue<Item, queue_size> m_queue;
+    bool                        m_active;
+    bool                        m_csvExport;
+    uint64_t                    m_dropped;
+    // writer thread state
+    FILE*                       m_file;
+    CaptureFileHeader           m_header;
+    FrameHistogram              m_histogram;
+    uint64_t                    m_prevFrameStart;
+    FILE*                       m_csvFile;
+    char                        m_csvPrefix[MAX_PATH + 32];     /* "Application,ProcessID,Runtime," of every row */
+    size_t                      m_csvPrefixLen;
+    uint64_t                    m_csvFirstTick;
+    uint64_t                    m_csvPrevTick;
+    uint64_t                    m_csvPrevDisplay;
+    size_t                      m_csvLen;
+    char                        m_csvBuffer[csv_buffer_size];
+    HANDLE                      m_hStopEvent;
+    HANDLE                      m_hThread;
+};
@@ -0,0 +1,162 @@
+#include "FrameClock.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+#if defined(FRAMECLOCK_X86) && !defined(_MSC_VER)
+#include <cpuid.h>
+#endif
+
+// length of the TSC calibration window, a 100ns OS clock gives about 10ppm
+static const uint64_t   g_calibrationMs = 20;
+
+uint64_t FrameClock::readOsClock()
+{
+#ifdef _WIN32
+    LARGE_INTEGER pfc;
+    QueryPerformanceCounter(&pfc);
+    return (uint64_t)pfc.QuadPart;
+#else
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+uint64_t FrameClock::osFrequency()
+{
+#ifdef _WIN32
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+    return (uint64_t)freq.QuadPart;
+#else
+    return 1000000000ull;
+#endif
+}
+
+uint64_t FrameClock::mulShift32(uint64_t value, uint64_t mult)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned __int64 high;
+    unsigned __int64 low = _umul128(value, mult, &high);
+    return (high << 32) | (low >> 32);
+#elif defined(__SIZEOF_INT128__)
+    return (uint64_t)(((unsigned __int128)value * mult) >> 32);
+#else
+    // schoolbook on 32-bit halves, the bits above 96 are dropped
+    uint64_t v0 = value & 0xffffffff, v1 = value >> 32;
+    uint64_t m0 = mult & 0xffffffff, m1 = mult >> 32;
+    return ((v1 * m1) << 32) + v1 * m0 + v0 * m1 + ((v0 * m0) >> 32);
+#endif
+}
+
+bool FrameClock::hasInvariantTsc()
+{
+#ifdef FRAMECLOCK_X86
+    unsigned int regs[4] = { 0, 0, 0, 0 };
+#ifdef _MSC_VER
+    __cpuid((int*)regs, 0x80000000);
+    if(regs[0] < 0x80000007)
+        return false;
+    __cpuid((int*)regs, 0x80000001);
+    bool rdtscp = (regs[3] & (1u << 27)) != 0;
+    __cpuid((int*)regs, 0x80000007);
+#else
+    if(!__get_cpuid(0x80000000, &regs[0], &regs[1], &regs[2], &regs[3]) || regs[0] < 0x80000007)
+        return false;
+    __get_cpuid(0x80000001, &regs[0], &regs[1], &regs[2], &regs[3]);
+    bool rdtscp = (regs[3] & (1u << 27)) != 0;
+    __get_cpuid(0x80000007, &regs[0], &regs[1], &regs[2], &regs[3]);
+#endif
+    return rdtscp && (regs[3] & (1u << 8)) != 0;
+#else
+    return false;
+#endif
+}
+
+#ifdef FRAMECLOCK_X86
+// OS clock reading with the TSC taken at its midpoint, best of a few tries to dodge preemption
+static void samplePair(uint64_t& tsc, uint64_t& os)
+{
+    uint64_t best = ~0ull;
+    for(int i = 0; i < 5; i ++) {
+        unsigned int aux;
+        uint64_t t0 = __rdtscp(&aux);
+        uint64_t o = FrameClock::readOsClock();
+        uint64_t t1 = __rdtscp(&aux);
+        if(t1 - t0 < best) {
+            best = t1 - t0;
+            tsc = t0 + (t1 - t0) / 2;
+            os = o;
+        }
+    }
+}
+#endif
+
+uint64_t FrameClock::calibrateTsc()
+{
+#ifdef FRAMECLOCK_X86
+    uint64_t osFreq = osFrequency();
+    uint64_t tsc0 = 0, os0 = 0, tsc1 = 0, os1 = 0;
+    samplePair(tsc0, os0);
+    uint64_t window = osFreq * g_calibrationMs / 1000;
+    // spin rather than sleep, the thread may otherwise migrate in the middle of the window
+    while(readOsClock() - os0 < window)
+        ;
+    samplePair(tsc1, os1);
+    if(os1 <= os0 || tsc1 <= tsc0)
+        return 0;
+    return (tsc1 - tsc0) * osFreq / (os1 - os0);
+#else
+    return 0;
+#endif
+}
+
+void FrameClock::setFrequency(uint64_t frequency)
+{
+    m_frequency = frequency;
+    m_nsMult = (1000000000ull << 32) / frequency;
+    m_usMult = (1000000ull << 32) / frequency;
+    m_ticksPerNsMult = ((frequency / 1000000000ull) << 32) + ((frequency % 1000000000ull) << 32) / 1000000000ull;
+}
+
+FrameClock::FrameClock()
+{
+    m_osFrequency = osFrequency();
+    m_backend = cb_os;
+    setFrequency(osFrequency());
+    if(hasInvariantTsc())
+        selectBackend(cb_tsc);
+}
+
+uint64_t FrameClock::fromOsTimestamp(uint64_t osTimestamp) const
+{
+    if(m_backend == cb_os)
+        return osTimestamp;
+    // both clocks run at a fixed rate, so carry the age of the timestamp across
+    uint64_t os = readOsClock();
+    uint64_t ticks = now();
+    if(osTimestamp >= os)
+        return ticks;
+    uint64_t age = os - osTimestamp;
+    uint64_t ageNs = age / m_osFrequency * 1000000000ull + age % m_osFrequency * 1000000000ull / m_osFrequency;
+    return ticks - fromNs(ageNs);
+}
+
+bool FrameClock::selectBackend(Backend backend)
+{
+    if(backend == cb_tsc) {
+        uint64_t frequency = calibrateTsc();
+        if(frequency == 0)
+            return false;
+        m_backend = cb_tsc;
+        setFrequency(frequency);
+        return true;
+    }
+    m_backend = cb_os;
+    setFrequency(osFrequency());
+    return true;
+}
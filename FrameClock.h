@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdint.h>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define FRAMECLOCK_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+/*
+ * Process-wide timestamp source for all hook timing. On CPUs with an
+ * invariant TSC, now() is a single rdtscp (which waits for earlier
+ * instructions, so a timestamp does not float above the code it measures)
+ * and the TSC rate is calibrated once against the OS clock. Elsewhere it
+ * falls back to QueryPerformanceCounter, or CLOCK_MONOTONIC off Windows.
+ *
+ * Conversions are 64-bit integer multiply-and-shift with a 32-bit fraction,
+ * so they stay exact to well below a nanosecond per second however long the
+ * process has been running.
+ */
+class FrameClock
+{
+public:
+    enum Backend
+    {
+        cb_os,
+        cb_tsc,
+    };
+
+    static FrameClock& instance()
+    {
+        static FrameClock inst;
+        return inst;
+    }
+
+    uint64_t now() const
+    {
+#ifdef FRAMECLOCK_X86
+        if(m_backend == cb_tsc) {
+            unsigned int aux;
+            return __rdtscp(&aux);
+        }
+#endif
+        return readOsClock();
+    }
+    uint64_t frequency() const { return m_frequency; }
+    Backend backend() const { return m_backend; }
+    const char* backendName() const { return m_backend == cb_tsc ? "tsc" : "os"; }
+
+    uint64_t toNs(uint64_t ticks) const { return mulShift32(ticks, m_nsMult); }
+    uint64_t toUs(uint64_t ticks) const { return mulShift32(ticks, m_usMult); }
+    uint64_t fromNs(uint64_t ns) const { return mulShift32(ns, m_ticksPerNsMult); }
+    // an OS clock timestamp from the past, such as DXGI's SyncQPCTime, in this clock's ticks
+    uint64_t fromOsTimestamp(uint64_t osTimestamp) const;
+
+    static uint64_t readOsClock();
+    static uint64_t osFrequency();
+    // bits 32..95 of value * mult
+    static uint64_t mulShift32(uint64_t value, uint64_t mult);
+
+    // forces a backend, for comparisons; calibrates the TSC again when selected
+    bool selectBackend(Backend backend);
+
+private:
+    FrameClock();
+    FrameClock(const FrameClock&);
+    static bool hasInvariantTsc();
+    static uint64_t calibrateTsc();
+    void setFrequency(uint64_t frequency);
+
+private:
+    Backend             m_backend;
+    uint64_t            m_frequency;
+    uint64_t            m_nsMult;           /* 1e9 / frequency as 32.32 fixed point */
+    uint64_t            m_usMult;
+    uint64_t            m_ticksPerNsMult;
+    uint64_t            m_osFrequency;
+};
@@ -0,0 +1,165 @@
+#include "FrameHistogram.h"
+#include "CaptureFormat.h"
+#include <string.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+static int highestBit(uint64_t value)
+{
+#ifdef _MSC_VER
+    unsigned long bit;
+#ifdef _WIN64
+    _BitScanReverse64(&bit, value);
+#else
+    if(value >> 32) {
+        _BitScanReverse(&bit, (unsigned long)(value >> 32));
+        bit += 32;
+    }
+    else {
+        _BitScanReverse(&bit, (unsigned long)value);
+    }
+#endif
+    return (int)bit;
+#else
+    return 63 - __builtin_clzll(value);
+#endif
+}
+
+FrameHistogram::FrameHistogram()
+{
+    reset();
+}
+
+void FrameHistogram::reset()
+{
+    memset(m_counts, 0, sizeof(m_counts));
+}
+
+int FrameHistogram::indexOf(uint64_t ns)
+{
+    if(ns > max_value_ns)
+        ns = max_value_ns;
+    if(ns < sub_bucket_count)
+        return (int)ns;
+    // the top bit selects the octave, the next sub_bucket_bits bits the linear bucket inside it
+    int shift = highestBit(ns) - sub_bucket_bits;
+    return (shift + 1) * sub_bucket_count + (int)((ns >> shift) - sub_bucket_count);
+}
+
+uint64_t FrameHistogram::lowestValue(int index)
+{
+    int octave = index >> sub_bucket_bits;
+    uint64_t sub = (uint64_t)(index & (sub_bucket_count - 1));
+    if(octave == 0)
+        return sub;
+    return (sub + sub_bucket_count) << (octave - 1);
+}
+
+uint64_t FrameHistogram::bucketWidth(int index)
+{
+    int octave = index >> sub_bucket_bits;
+    return octave == 0 ? 1 : 1ull << (octave - 1);
+}
+
+void FrameHistogram::merge(const FrameHistogram& other)
+{
+    for(int i = 0; i < bucket_count; i ++)
+        m_counts[i] += other.m_counts[i];
+}
+
+uint64_t FrameHistogram::count() const
+{
+    uint64_t total = 0;
+    for(int i = 0; i < bucket_count; i ++)
+        total += m_counts[i];
+    return total;
+}
+
+uint64_t FrameHistogram::percentile(double pct) const
+{
+    uint64_t total = count();
+    if(total == 0)
+        return 0;
+    // nearest rank, counted from whichever end is closer
+    uint64_t rank = (uint64_t)(pct / 100.0 * (double)total + 0.5);
+    if(rank < 1)
+        rank = 1;
+    if(rank > total)
+        rank = total;
+    int index = 0;
+    if(rank * 2 <= total) {
+        uint64_t seen = 0;
+        for(index = 0; index < bucket_count - 1; index ++) {
+            seen += m_counts[index];
+            if(seen >= rank)
+                break;
+        }
+    }
+    else {
+        uint64_t above = total - rank;
+        uint64_t seen = 0;
+        for(index = bucket_count - 1; index > 0; index --) {
+            seen += m_counts[index];
+            if(seen > above)
+                break;
+        }
+    }
+    return lowestValue(index) + bucketWidth(index) / 2;
+}
+
+uint64_t FrameHistogram::maxValue() const
+{
+    for(int i = bucket_count - 1; i >= 0; i --) {
+        if(m_counts[i])
+            return lowestValue(i) + bucketWidth(i) - 1;
+    }
+    return 0;
+}
+
+bool FrameHistogram::write(FILE* f) const
+{
+    HistogramFooter footer;
+    memset(&footer, 0, sizeof(footer));
+    for(int i = 0; i < bucket_count; i ++) {
+        if(!m_counts[i])
+            continue;
+        HistogramEntry entry;
+        entry.count = m_counts[i];
+        entry.index = (uint32_t)i;
+        entry.reserved = 0;
+        if(fwrite(&entry, sizeof(entry), 1, f) != 1)
+            return false;
+        footer.entryCount ++;
+    }
+    footer.subBucketBits = sub_bucket_bits;
+    footer.bucketCount = bucket_count;
+    memcpy(footer.magic, CAPTURE_HISTOGRAM_MAGIC, sizeof(footer.magic));
+    return fwrite(&footer, sizeof(footer), 1, f) == 1;
+}
+
+bool FrameHistogram::readTrailer(const uint8_t* data, size_t size, size_t& trailerSize)
+{
+    trailerSize = 0;
+    if(size < sizeof(HistogramFooter))
+        return false;
+    HistogramFooter footer;
+    memcpy(&footer, data + size - sizeof(footer), sizeof(footer));
+    if(memcmp(footer.magic, CAPTURE_HISTOGRAM_MAGIC, sizeof(footer.magic)) != 0 ||
+        footer.subBucketBits != sub_bucket_bits || footer.bucketCount != bucket_count)
+        return false;
+    if(footer.entryCount > (size - sizeof(footer)) / sizeof(HistogramEntry))
+        return false;
+    size_t entryBytes = (size_t)footer.entryCount * sizeof(HistogramEntry);
+    const uint8_t* p = data + size - sizeof(footer) - entryBytes;
+    reset();
+    for(uint64_t i = 0; i < footer.entryCount; i ++) {
+        HistogramEntry entry;
+        memcpy(&entry, p + i * sizeof(entry), sizeof(entry));
+        if(entry.index < (uint32_t)bucket_count)
+            m_counts[entry.index] += entry.count;
+    }
+    trailerSize = entryBytes + sizeof(footer);
+    return true;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+ * Fixed-size log-linear histogram of frame times in nanoseconds, in the
+ * spirit of HdrHistogram. Each power of two above 1024ns is split into 1024
+ * linear buckets, so every bucket is narrower than 0.1% of its values; below
+ * 1024ns the buckets are exact. Values are clamped to 10s, which gives
+ * bucket_count buckets and a constant footprint however long the session.
+ *
+ * record() is one index computation and one increment. Totals are only
+ * summed when queried, and high percentiles scan down from the top, so
+ * p99.9 stays cheap. Histograms with the same layout merge by adding counts,
+ * and serialize as a sparse list of non-empty buckets.
+ */
+class FrameHistogram
+{
+public:
+    enum
+    {
+        sub_bucket_bits = 10,
+        sub_bucket_count = 1 << sub_bucket_bits,
+        max_shift = 24,                             /* 2^(24 + 10) ns > 10s */
+        bucket_count = (max_shift + 1) * sub_bucket_count,
+    };
+    static const uint64_t max_value_ns = 10000000000ull;
+
+    FrameHistogram();
+    void reset();
+    void record(uint64_t ns) { m_counts[indexOf(ns)] ++; }
+    void recordTicks(uint64_t ticks, uint64_t frequency) { record(ticksToNs(ticks, frequency)); }
+    void merge(const FrameHistogram& other);
+
+    uint64_t count() const;
+    // value below which pct percent of the recorded frames fall, 0 when empty
+    uint64_t percentile(double pct) const;
+    uint64_t maxValue() const;
+
+    // sparse form used in capture files: entries, then a HistogramFooter
+    bool write(FILE* f) const;
+    // reads the trailer at the end of a buffer; trailerSize returns the bytes it occupies
+    bool readTrailer(const uint8_t* data, size_t size, size_t& trailerSize);
+
+    // split so long gaps cannot overflow
+    static uint64_t ticksToNs(uint64_t ticks, uint64_t frequency)
+    {
+        return ticks / frequency * 1000000000ull + ticks % frequency * 1000000000ull / frequency;
+    }
+    static int indexOf(uint64_t ns);
+    static uint64_t lowestValue(int index);
+    static uint64_t bucketWidth(int index);
+
+private:
+    FrameHistogram(const FrameHistogram&);
+    FrameHistogram& operator=(const FrameHistogram&);
+
+private:
+    uint64_t            m_counts[bucket_count];
+};
@@ -0,0 +1,195 @@
+#include "FramePacer.h"
+
+#ifndef _WIN32
+#include <time.h>
+#endif
+
+#ifdef _WIN32
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION   0x00000002
+#endif
+
+SystemPacingClock::SystemPacingClock()
+{
+    m_hTimer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    if(!m_hTimer)
+        m_hTimer = CreateWaitableTimerW(NULL, TRUE, NULL);
+}
+
+SystemPacingClock::~SystemPacingClock()
+{
+    if(m_hTimer)
+        CloseHandle(m_hTimer);
+}
+
+void SystemPacingClock::sleep(uint64_t ticks)
+{
+    // relative due times are negative, in 100ns units
+    LONGLONG hundredNs = (LONGLONG)(FrameClock::instance().toNs(ticks) / 100);
+    if(hundredNs <= 0)
+        return;
+    LARGE_INTEGER due;
+    due.QuadPart = -hundredNs;
+    if(m_hTimer && SetWaitableTimer(m_hTimer, &due, 0, NULL, NULL, FALSE))
+        WaitForSingleObject(m_hTimer, INFINITE);
+    else
+        Sleep((DWORD)(hundredNs / 10000));
+}
+
+void SystemPacingClock::spin()
+{
+    YieldProcessor();
+}
+
+#else
+
+SystemPacingClock::SystemPacingClock()
+{
+}
+
+SystemPacingClock::~SystemPacingClock()
+{
+}
+
+void SystemPacingClock::sleep(uint64_t ticks)
+{
+    uint64_t ns = FrameClock::instance().toNs(ticks);
+    timespec ts;
+    ts.tv_sec = (time_t)(ns / 1000000000ull);
+    ts.tv_nsec = (long)(ns % 1000000000ull);
+    nanosleep(&ts, nullptr);
+}
+
+void SystemPacingClock::spin()
+{
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#endif
+}
+
+#endif
+
+FramePacer::FramePacer(PacingClock& clock)
+    : m_clock(clock)
+{
+    m_fps = 0;
+    m_intervalTicks = 0;
+    m_intervalRem = 0;
+    m_remAcc = 0;
+    m_target = 0;
+    // set when first enabled, a global pacer is constructed under the loader lock and the
+    // clock's frequency may need calibrating
+    m_minSlack = 0;
+    m_slack = 0;
+    m_overshootMean = 0;
+    m_overshootDev = 0;
+    resetReport();
+}
+
+void FramePacer::setTargetFps(int fps)
+{
+    if(fps < 0)
+        fps = 0;
+    if(fps == m_fps)
+        return;
+    m_fps = fps;
+    if(fps && m_minSlack == 0) {
+        // never spin less than 50us, start with 2ms until the timer has been measured
+        m_minSlack = (int64_t)(m_clock.frequency() / 20000);
+        m_slack = (int64_t)(m_clock.frequency() / 500);
+        m_overshootMean = m_slack / 2;
+        m_overshootDev = m_slack / 8;
+    }
+    m_intervalTicks = fps ? m_clock.frequency() / fps : 0;
+    m_intervalRem = fps ? m_clock.frequency() % fps : 0;
+    m_remAcc = 0;
+    m_target = 0;
+    resetReport();
+}
+
+void FramePacer::advanceTarget()
+{
+    m_target += m_intervalTicks;
+    m_remAcc += m_intervalRem;
+    if(m_remAcc >= (uint64_t)m_fps) {
+        m_remAcc -= m_fps;
+        m_target ++;
+    }
+}
+
+void FramePacer::updateSlack(int64_t overshoot)
+{
+    // integer EWMAs with a weight of 1/8
+    m_overshootMean += (overshoot - m_overshootMean) / 8;
+    int64_t dev = overshoot - m_overshootMean;
+    if(dev < 0)
+        dev = -dev;
+    m_overshootDev += (dev - m_overshootDev) / 8;
+    m_slack = m_overshootMean + 4 * m_overshootDev;
+    if(m_slack < m_minSlack)
+        m_slack = m_minSlack;
+    if(m_slack > (int64_t)m_intervalTicks)
+        m_slack = (int64_t)m_intervalTicks;
+}
+
+void FramePacer::wait()
+{
+    if(m_fps == 0)
+        return;
+    uint64_t now = m_clock.now();
+    if(m_target == 0) {
+        // first frame after (re)configuration starts the schedule
+        m_target = now;
+        advanceTarget();
+        return;
+    }
+    int64_t remaining = (int64_t)(m_target - now);
+    if(remaining < -(int64_t)m_intervalTicks) {
+        // more than a frame behind (loading screen, alt-tab): restart instead of rushing frames out
+        m_resyncs ++;
+        m_target = now;
+        advanceTarget();
+        return;
+    }
+    if(remaining > m_slack) {
+        uint64_t sleepTicks = (uint64_t)(remaining - m_slack);
+        m_clock.sleep(sleepTicks);
+        uint64_t woke = m_clock.now();
+        updateSlack((int64_t)(woke - (now + sleepTicks)));
+        now = woke;
+    }
+    while((int64_t)(m_target - now) > 0) {
+        m_clock.spin();
+        now = m_clock.now();
+    }
+    uint64_t lateness = now - m_target;
+    m_frames ++;
+    m_latenessSum += lateness;
+    if(lateness > m_latenessMax)
+        m_latenessMax = lateness;
+    // late frames keep their slot, so the average rate stays exact
+    advanceTarget();
+}
+
+bool FramePacer::takeReport(PacerReport& report)
+{
+    if(m_fps == 0 || m_frames < (uint64_t)m_fps)
+        return false;
+    double usPerTick = 1000000.0 / (double)m_clock.frequency();
+    report.frames = m_frames;
+    report.avgLatenessUs = (double)m_latenessSum * usPerTick / (double)m_frames;
+    report.maxLatenessUs = (double)m_latenessMax * usPerTick;
+    report.sleepSlackUs = (double)m_slack * usPerTick;
+    report.resyncs = m_resyncs;
+    resetReport();
+    return true;
+}
+
+void FramePacer::resetReport()
+{
+    m_frames = 0;
+    m_latenessSum = 0;
+    m_latenessMax = 0;
+    m_resyncs = 0;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stdint.h>
+#include "FrameClock.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+/*
+ * Time source and wait primitives used by FramePacer. The pacer itself does
+ * no system calls, so it can be driven by a simulated clock off-target.
+ */
+class PacingClock
+{
+public:
+    virtual ~PacingClock() {}
+    virtual uint64_t frequency() const = 0;     /* ticks per second */
+    virtual uint64_t now() = 0;
+    // coarse wait; may wake early or late, the pacer measures and compensates
+    virtual void sleep(uint64_t ticks) = 0;
+    // one iteration of the busy wait for the tail of a frame
+    virtual void spin() = 0;
+};
+
+/*
+ * FrameClock time with a high resolution waitable timer on Windows (plain
+ * waitable timer before Windows 10 1803) and nanosleep elsewhere.
+ */
+class SystemPacingClock : public PacingClock
+{
+public:
+    SystemPacingClock();
+    ~SystemPacingClock();
+    uint64_t frequency() const { return FrameClock::instance().frequency(); }
+    uint64_t now() { return FrameClock::instance().now(); }
+    void sleep(uint64_t ticks);
+    void spin();
+
+private:
+#ifdef _WIN32
+    HANDLE              m_hTimer;
+#endif
+};
+
+struct PacerReport
+{
+    uint64_t            frames;
+    double              avgLatenessUs;      /* how far past its target a frame was released */
+    double              maxLatenessUs;
+    double              sleepSlackUs;       /* current spin budget before each target */
+    uint64_t            resyncs;            /* frames that fell behind and restarted the schedule */
+};
+
+/*
+ * Caps the frame rate by holding each frame until its target time. Targets
+ * advance by freq / fps using an integer remainder accumulator, so the long
+ * term rate is exact and never drifts. The bulk of each wait is slept; the
+ * last sleepSlack ticks are spun. sleepSlack follows the measured oversleep
+ * of the clock (mean plus four mean deviations), so a coarse timer spins
+ * longer and a precise one burns less CPU.
+ */
+class FramePacer
+{
+public:
+    explicit FramePacer(PacingClock& clock);
+    // 0 disables the limiter
+    void setTargetFps(int fps);
+    int targetFps() const { return m_fps; }
+    // blocks until the current frame may be presented; no-op when disabled
+    void wait();
+    // statistics since the previous report, ready about once per second
+    bool takeReport(PacerReport& report);
+
+private:
+    FramePacer(const FramePacer&);
+    void advanceTarget();
+    void updateSlack(int64_t overshoot);
+    void resetReport();
+
+private:
+    PacingClock&        m_clock;
+    int                 m_fps;
+    uint64_t            m_intervalTicks;    /* whole ticks of freq / fps */
+    uint64_t            m_intervalRem;      /* freq % fps, spread by m_remAcc */
+    uint64_t            m_remAcc;
+    uint64_t            m_target;
+    int64_t             m_minSlack;
+    int64_t             m_slack;
+    int64_t             m_overshootMean;
+    int64_t             m_overshootDev;
+    // report window
+    uint64_t            m_frames;
+    uint64_t            m_latenessSum;
+    uint64_t            m_latenessMax;
+    uint64_t            m_resyncs;
+};
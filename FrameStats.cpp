@@ -0,0 +1,69 @@
+#include "FrameStats.h"
+#include <algorithm>
+#include <cassert>
+#include <string.h>
+#include <vector>
+
+// nearest-rank percentile of an ascending sequence
+static double percentile(const std::vector<double>& sorted, double p)
+{
+    assert(!sorted.empty());
+    size_t rank = (size_t)(p / 100.0 * (double)sorted.size() + 0.5);
+    if(rank < 1)
+        rank = 1;
+    if(rank > sorted.size())
+        rank = sorted.size();
+    return sorted[rank - 1];
+}
+
+// average fps over the slowest share of frames
+static double lowFps(const std::vector<double>& sorted, double share)
+{
+    size_t n = (size_t)((double)sorted.size() * share);
+    if(n < 1)
+        n = 1;
+    double sum = 0.0;
+    for(size_t i = sorted.size() - n; i < sorted.size(); i ++)
+        sum += sorted[i];
+    return sum > 0.0 ? 1000.0 * (double)n / sum : 0.0;
+}
+
+bool computeFrameStats(const FrameRecord* records, size_t count, uint64_t tickFrequency, FrameStatsSummary& summary)
+{
+    memset(&summary, 0, sizeof(summary));
+    if(!records || count < 2 || tickFrequency == 0)
+        return false;
+    double msPerTick = 1000.0 / (double)tickFrequency;
+    std::vector<double> frameMs;
+    frameMs.reserve(count - 1);
+    uint64_t blockedTicks = 0;
+    for(size_t i = 1; i < count; i ++) {
+        frameMs.push_back((double)(records[i].presentStart - records[i - 1].presentStart) * msPerTick);
+        blockedTicks += records[i].presentEnd - records[i].presentStart;
+        if(records[i].events & fe_dropped)
+            summary.displayDropped ++;
+        if(records[i].events & fe_display_unknown)
+            summary.displayUnknown ++;
+    }
+    uint64_t totalTicks = records[count - 1].presentStart - records[0].presentStart;
+    summary.frames = frameMs.size();
+    summary.durationSec = (double)totalTicks / (double)tickFrequency;
+    summary.avgMs = (double)totalTicks * msPerTick / (double)summary.frames;
+    summary.avgFps = summary.avgMs > 0.0 ? 1000.0 / summary.avgMs : 0.0;
+    summary.presentBlockedShare = totalTicks ? (double)blockedTicks / (double)totalTicks : 0.0;
+    double stutterMs = summary.avgMs * g_stutterFactor;
+    for(size_t i = 0; i < frameMs.size(); i ++) {
+        if(frameMs[i] > stutterMs)
+            summary.stutterCount ++;
+    }
+    std::sort(frameMs.begin(), frameMs.end());
+    summary.p50Ms = percentile(frameMs, 50.0);
+    summary.p90Ms = percentile(frameMs, 90.0);
+    summary.p95Ms = percentile(frameMs, 95.0);
+    summary.p99Ms = percentile(frameMs, 99.0);
+    summary.p999Ms = percentile(frameMs, 99.9);
+    summary.maxMs = frameMs.back();
+    summary.low1Fps = lowFps(frameMs, 0.01);
+    summary.low01Fps = lowFps(frameMs, 0.001);
+    return true;
+}
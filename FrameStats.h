@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "CaptureFormat.h"
+
+/*
+ * Summary statistics over a run of captured frames. Frame time i is the
+ * distance between the Present calls of records i-1 and i, so count records
+ * describe count-1 frames.
+ */
+struct FrameStatsSummary
+{
+    uint64_t            frames;
+    double              durationSec;
+    double              avgFps;
+    double              avgMs;
+    double              p50Ms;
+    double              p90Ms;
+    double              p95Ms;
+    double              p99Ms;
+    double              p999Ms;
+    double              maxMs;
+    double              low1Fps;            /* average fps over the slowest 1% of frames */
+    double              low01Fps;           /* average fps over the slowest 0.1% of frames */
+    uint64_t            stutterCount;       /* frames longer than stutterFactor * avgMs */
+    double              presentBlockedShare;/* share of the run spent inside the real Present */
+    uint64_t            displayDropped;     /* frames DXGI reported as never shown */
+    uint64_t            displayUnknown;     /* frames without frame statistics, e.g. windowed blt model */
+};
+
+// same threshold CapFrameX uses for its stutter count
+static const double     g_stutterFactor = 2.5;
+
+bool computeFrameStats(const FrameRecord* records, size_t count, uint64_t tickFrequency, FrameStatsSummary& summary);
@@ -0,0 +1,140 @@
+#include "LatencyControl.h"
+#include <algorithm>
+
+// set around attach's own GetFrameLatencyWaitableObject call, which the hook must not count as the game's
+static thread_local bool t_ownRequest = false;
+
+LatencyControl::LatencyControl()
+    : m_predictor(m_clock.frequency())
+{
+    m_pSwapChain = nullptr;
+    m_pDxgiDevice = nullptr;
+    m_hWaitable = NULL;
+    m_prevLatency = 3;
+    m_workStart = 0;
+    m_lastPresentStart = 0;
+    m_waitableHooked = false;
+    InitializeSRWLock(&m_requestLock);
+    m_requests = 0;
+    m_seenRequests = 0;
+}
+
+void LatencyControl::onWaitableRequested(IDXGISwapChain* pSwapChain)
+{
+    if(t_ownRequest)
+        return;
+    AcquireSRWLockExclusive(&m_requestLock);
+    if(std::find(m_gameWaitables.begin(), m_gameWaitables.end(), pSwapChain) == m_gameWaitables.end())
+        m_gameWaitables.push_back(pSwapChain);
+    ReleaseSRWLockExclusive(&m_requestLock);
+    m_requests ++;
+}
+
+void LatencyControl::forgetSwapChain(IDXGISwapChain* pSwapChain)
+{
+    AcquireSRWLockExclusive(&m_requestLock);
+    m_gameWaitables.erase(std::remove(m_gameWaitables.begin(), m_gameWaitables.end(), pSwapChain), m_gameWaitables.end());
+    ReleaseSRWLockExclusive(&m_requestLock);
+}
+
+bool LatencyControl::gameUsesWaitable(IDXGISwapChain* pSwapChain)
+{
+    // without the hook there is no telling, and taking a signal the game waits for stalls it a whole timeout
+    if(!m_waitableHooked)
+        return true;
+    AcquireSRWLockShared(&m_requestLock);
+    bool used = std::find(m_gameWaitables.begin(), m_gameWaitables.end(), pSwapChain) != m_gameWaitables.end();
+    ReleaseSRWLockShared(&m_requestLock);
+    return used;
+}
+
+void LatencyControl::attach(IDXGISwapChain* pSwapChain)
+{
+    m_pSwapChain = pSwapChain;
+    m_predictor.reset();
+    m_workStart = 0;
+    m_lastPresentStart = 0;
+    m_seenRequests = m_requests;
+
+    // the waitable object only exists when the game created the swapchain with the flag; its semaphore
+    // has one signal per frame, so when the game waits on it the latency stays the game's and only the
+    // predictor's sleep is added
+    DXGI_SWAP_CHAIN_DESC desc;
+    IDXGISwapChain2* pSwapChain2 = nullptr;
+    if(SUCCEEDED(pSwapChain->GetDesc(&desc)) && (desc.Flags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT)) {
+        if(gameUsesWaitable(pSwapChain))
+            return;
+        if(SUCCEEDED(pSwapChain->QueryInterface(__uuidof(IDXGISwapChain2), (void**)&pSwapChain2))) {
+            pSwapChain2->GetMaximumFrameLatency(&m_prevLatency);
+            pSwapChain2->SetMaximumFrameLatency(1);
+            t_ownRequest = true;
+            m_hWaitable = pSwapChain2->GetFrameLatencyWaitableObject();
+            t_ownRequest = false;
+            pSwapChain2->Release();
+            if(m_hWaitable)
+                return;
+        }
+    }
+    if(SUCCEEDED(pSwapChain->GetDevice(__uuidof(IDXGIDevice1), (void**)&m_pDxgiDevice))) {
+        m_pDxgiDevice->GetMaximumFrameLatency(&m_prevLatency);
+        m_pDxgiDevice->SetMaximumFrameLatency(1);
+    }
+}
+
+// restore is only safe while the swapchain is known to be alive, i.e. from inside its Present
+void LatencyControl::detach(bool restore)
+{
+    if(m_hWaitable) {
+        IDXGISwapChain2* pSwapChain2 = nullptr;
+        if(restore && SUCCEEDED(m_pSwapChain->QueryInterface(__uuidof(IDXGISwapChain2), (void**)&pSwapChain2))) {
+            pSwapChain2->SetMaximumFrameLatency(m_prevLatency);
+            pSwapChain2->Release();
+        }
+        CloseHandle(m_hWaitable);
+        m_hWaitable = NULL;
+    }
+    if(m_pDxgiDevice) {
+        // the device reference is ours, so its latency can always be put back
+        m_pDxgiDevice->SetMaximumFrameLatency(m_prevLatency);
+        m_pDxgiDevice->Release();
+        m_pDxgiDevice = nullptr;
+    }
+    m_pSwapChain = nullptr;
+}
+
+void LatencyControl::afterPresent(IDXGISwapChain* pSwapChain, bool enabled, const FrameRecord& rec)
+{
+    if(!enabled) {
+        if(m_pSwapChain)
+            detach(m_pSwapChain == pSwapChain);
+        return;
+    }
+    if(pSwapChain != m_pSwapChain) {
+        if(m_pSwapChain)
+            detach(false);
+        attach(pSwapChain);
+    }
+    // the game may ask for the handle only after its first frames; hand the semaphore back then
+    uint32_t requests = m_requests;
+    if(requests != m_seenRequests) {
+        m_seenRequests = requests;
+        if(m_hWaitable && gameUsesWaitable(pSwapChain)) {
+            detach(true);
+            attach(pSwapChain);
+        }
+    }
+
+    if(m_hWaitable) {
+        // returns once the queue has room, so the next frame starts just in time
+        WaitForSingleObjectEx(m_hWaitable, 1000, TRUE);
+        return;
+    }
+
+    if(m_lastPresentStart)
+        m_predictor.addFrame(rec.presentStart - m_workStart, rec.presentEnd - rec.presentStart, rec.presentStart - m_lastPresentStart);
+    m_lastPresentStart = rec.presentStart;
+    uint64_t sleepTicks = m_predictor.sleepTicks();
+    if(sleepTicks)
+        m_clock.sleep(sleepTicks);
+    m_workStart = m_clock.now();
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Windows.h>
+#include <d3d11.h>
+#include <dxgi1_3.h>
+#include <atomic>
+#include <vector>
+#include "CaptureFormat.h"
+#include "FramePacer.h"
+#include "LatencyPredictor.h"
+
+/*
+ * Opt-in latency reduction (latency_mode = 1), driven from the end of the
+ * Present hook. The frame latency waitable object is a semaphore signalled
+ * once per frame, so only one waiter may take it: a swapchain created with
+ * the waitable flag whose game never asked for the handle (the hook on
+ * GetFrameLatencyWaitableObject, IDXGISwapChain2 vtable index 33, tells)
+ * gets SetMaximumFrameLatency(1) (index 31) and the hook waits on the
+ * handle before handing control back to the game. A game that waits on it
+ * itself keeps its semaphore and its maximum latency, and like every other
+ * swapchain gets a sleep after Present sized by LatencyPredictor, so the
+ * next frame samples input as late as possible; those others also get
+ * IDXGIDevice1::SetMaximumFrameLatency(1).
+ */
+class LatencyControl
+{
+public:
+    static LatencyControl& instance()
+    {
+        static LatencyControl inst;
+        return inst;
+    }
+    // render thread only
+    void afterPresent(IDXGISwapChain* pSwapChain, bool enabled, const FrameRecord& rec);
+    // set once the GetFrameLatencyWaitableObject hook is in place; without it every waitable is the game's
+    void setWaitableHooked() { m_waitableHooked = true; }
+    // from that hook, on any thread
+    void onWaitableRequested(IDXGISwapChain* pSwapChain);
+    // from the Release hook, before a new swapchain may take the address
+    void forgetSwapChain(IDXGISwapChain* pSwapChain);
+
+private:
+    LatencyControl();
+    LatencyControl(const LatencyControl&);
+    void attach(IDXGISwapChain* pSwapChain);
+    void detach(bool restore);
+    bool gameUsesWaitable(IDXGISwapChain* pSwapChain);
+
+private:
+    SystemPacingClock           m_clock;
+    LatencyPredictor            m_predictor;
+    IDXGISwapChain*             m_pSwapChain;       /* identity only, no reference held */
+    IDXGIDevice1*               m_pDxgiDevice;      /* set when the device latency was changed */
+    HANDLE                      m_hWaitable;
+    UINT                        m_prevLatency;      /* restored when the mode is switched off */
+    uint64_t                    m_workStart;        /* end of the previous post-Present sleep */
+    uint64_t                    m_lastPresentStart;
+    std::atomic<bool>           m_waitableHooked;
+    SRWLOCK                     m_requestLock;
+    std::vector<IDXGISwapChain*> m_gameWaitables;   /* swapchains whose game asked for the handle, identity only */
+    std::atomic<uint32_t>       m_requests;         /* bumped with every request the game makes */
+    uint32_t                    m_seenRequests;     /* m_requests when the render thread last looked */
+};
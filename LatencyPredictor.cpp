@@ -0,0 +1,59 @@
+#include "LatencyPredictor.h"
+#include <algorithm>
+#include <string.h>
+
+// frames needed before the first sleep, so one odd frame cannot start it
+static const int        g_warmupFrames = 8;
+
+LatencyPredictor::LatencyPredictor(uint64_t tickFrequency)
+{
+    // keep 1ms of blocking as headroom for jitter in the driver and compositor
+    m_margin = tickFrequency / 1000;
+    reset();
+}
+
+void LatencyPredictor::reset()
+{
+    memset(m_work, 0, sizeof(m_work));
+    memset(m_blocked, 0, sizeof(m_blocked));
+    memset(m_interval, 0, sizeof(m_interval));
+    m_count = 0;
+    m_next = 0;
+    m_sleep = 0;
+}
+
+uint64_t LatencyPredictor::percentile(const uint64_t* values, int count, int pct)
+{
+    uint64_t sorted[window_size];
+    memcpy(sorted, values, count * sizeof(uint64_t));
+    int k = (count - 1) * pct / 100;
+    std::nth_element(sorted, sorted + k, sorted + count);
+    return sorted[k];
+}
+
+void LatencyPredictor::addFrame(uint64_t workTicks, uint64_t blockedTicks, uint64_t intervalTicks)
+{
+    m_work[m_next] = workTicks;
+    m_blocked[m_next] = blockedTicks;
+    m_interval[m_next] = intervalTicks;
+    m_next = (m_next + 1) % window_size;
+    if(m_count < window_size)
+        m_count ++;
+    if(m_count < g_warmupFrames)
+        return;
+
+    uint64_t work = percentile(m_work, m_count, 90);
+    uint64_t blocked = percentile(m_blocked, m_count, 25);
+    uint64_t interval = percentile(m_interval, m_count, 50);
+
+    // take over half of the excess blocking per frame, give back the missing headroom at once
+    int64_t sleep = (int64_t)m_sleep;
+    if(blocked > m_margin)
+        sleep += (int64_t)(blocked - m_margin) / 2;
+    else
+        sleep -= (int64_t)(m_margin - blocked);
+    int64_t limit = (int64_t)interval - (int64_t)work - (int64_t)m_margin;
+    if(sleep > limit)
+        sleep = limit;
+    m_sleep = sleep > 0 ? (uint64_t)sleep : 0;
+}
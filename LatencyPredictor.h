@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Decides how long to sleep after Present so the next frame starts as late
+ * as possible without missing its slot. Fed once per frame with the CPU work
+ * of the frame (end of the previous post-Present sleep to the Present call),
+ * the time the real Present blocked and the Present-to-Present interval.
+ *
+ * Time spent blocked in Present is queue backpressure: the frame was started
+ * too early. The sleep is nudged towards moving all but a small margin of
+ * that blocking in front of the frame, and it is capped by the median
+ * interval minus a high percentile of recent work, so a spike in CPU time
+ * does not turn into a missed frame. Steering on the blocked time rather
+ * than on the interval keeps the loop stable: oversleeping shows up as
+ * less blocking and shrinks the next sleep.
+ */
+class LatencyPredictor
+{
+public:
+    explicit LatencyPredictor(uint64_t tickFrequency);
+    void reset();
+    void addFrame(uint64_t workTicks, uint64_t blockedTicks, uint64_t intervalTicks);
+    uint64_t sleepTicks() const { return m_sleep; }
+
+private:
+    enum { window_size = 32 };
+
+    static uint64_t percentile(const uint64_t* values, int count, int pct);
+
+private:
+    uint64_t            m_margin;
+    uint64_t            m_work[window_size];
+    uint64_t            m_blocked[window_size];
+    uint64_t            m_interval[window_size];
+    int                 m_count;
+    int                 m_next;
+    uint64_t            m_sleep;
+};
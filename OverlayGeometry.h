@@ -0,0 +1,90 @@
+#pragma once
+
+#include <stdint.h>
+#include "OverlayRenderer.h"
+#include "readimage.h"
+
+class TextBatch;
+class WidgetTree;
+struct OverlayWidget;
+
+// where the frame graph goes, in target pixels
+struct GraphPlacement
+{
+    uint64_t            first;              /* sample number of the leftmost point */
+    uint32_t            count;              /* points drawn */
+    float               left;               /* x of the leftmost point */
+    float               step;               /* x from one point to the next */
+    float               baseline;           /* y of 0 ms */
+    float               top;                /* y the strip is clipped to */
+    float               pixelsPerMs;
+};
+
+/*
+ * The overlay without D3D: both atlases as they are uploaded, the quads of
+ * the numbers, labels and widgets, and where the frame graph goes.
+ * DrawNumberTool fills its buffers from here, and the draw functions at the
+ * end send the same geometry in the same order to any OverlayRenderer, so
+ * SoftwareRenderer reproduces what the GPU draws. Colors and the number bias
+ * come in as values, OverlayConfig is Windows only. Plain C++ like
+ * TextLayout.
+ */
+class OverlayGeometry
+{
+public:
+    enum
+    {
+        number_digits_max = 10,             /* numbers are clamped to 0..INT_MAX */
+        graph_slack = 8,                    /* ring slots left out of the graph, more than the frames the GPU may lag behind */
+    };
+
+    static OverlayGeometry& instance()
+    {
+        static OverlayGeometry inst;
+        return inst;
+    }
+    // what failed while the atlases were built, nullptr when nothing did
+    const char* loadError() const { return m_loadError; }
+    // padded to whole 4x4 blocks, vertices address them in texels
+    const image& numberAtlas() const { return m_numberAtlas; }
+    const image& textAtlas() const { return m_textAtlas; }
+    float numberHeight() const { return m_numHeight; }
+    float numberWidth(float bias) const { return (m_imageWidth - bias) / 10.f; }
+
+    // writes at most number_digits_max quads, returns the vertex count
+    uint32_t createVertices(int number, float x, float y, float bias, const float color[4], DrawNumberVertex* vertices) const;
+    // vertices of count numbers, rows from x, y, in the frame arena; nullptr when it is full
+    DrawNumberVertex* createRows(const int* numbers, int count, float x, float y, float bias, const float color[4], uint32_t& vertexCount) const;
+    // a label right of each of count rows of numbers drawn from x, y, replacing what batch held
+    void layoutLabels(TextBatch& batch, const char* const* labels, int count, float x, float y, float bias, const float color[4]) const;
+    // the rows of createRows and layoutLabels as widgets; the tree is only rebuilt when the rows change shape
+    void layoutWidgets(WidgetTree& tree, const int* numbers, const char* const* labels, int count, float x, float y,
+        float bias, const float color[4]) const;
+    // a placed widget's quads, at most its span; returns the quads written, none while it is hidden
+    uint32_t tessellate(WidgetTree& tree, const OverlayWidget& widget, DrawNumberVertex* vertices) const;
+    // the newest of sampleCount samples in a ring of capacity at the right edge of the graph drawn from x, y
+    void placeGraph(uint32_t capacity, uint64_t sampleCount, float x, float y, GraphPlacement& placement) const;
+    // placement.count x, y pairs, as FrameGraphVS computes them
+    void graphPoints(const uint32_t* samplesUs, uint32_t capacity, const GraphPlacement& placement, float* points) const;
+
+    // the draws of DrawNumberTool through renderer
+    void drawNumbers(OverlayRenderer& renderer, const int* numbers, int count, float x, float y, float bias, const float color[4]) const;
+    void drawText(OverlayRenderer& renderer, const TextBatch& batch) const;
+    void drawGraph(OverlayRenderer& renderer, const uint32_t* samplesUs, uint32_t capacity, uint64_t sampleCount,
+        float x, float y, const float color[4]) const;
+    // places the tree and draws every widget, numbers before text as in the one draw of the GPU;
+    // the dirty flags are left to the D3D11 path
+    void drawWidgets(OverlayRenderer& renderer, WidgetTree& tree) const;
+
+private:
+    OverlayGeometry();
+    OverlayGeometry(const OverlayGeometry&);
+    void createVerticesFor(char digit, float x, float y, float bias, const float color[4], DrawNumberVertex* vertices) const;
+
+private:
+    image               m_numberAtlas;
+    image               m_textAtlas;
+    float               m_imageWidth;       /* of number.png, before padding */
+    float               m_numHeight;
+    const char*         m_loadError;
+};
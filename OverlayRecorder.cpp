@@ -0,0 +1,282 @@
+#include "OverlayRecorder.h"
+#include "Config.h"
+#include "DeviceActivity.h"
+#include "FrameArena.h"
+#include "FrameClock.h"
+#include <cassert>
+#include <string.h>
+
+#ifndef SAFE_RELEASE
+#define SAFE_RELEASE(ptr) do { \
+        if(ptr) { \
+            ptr->Release(); \
+            ptr = nullptr; \
+        } \
+    } while(0)
+#endif
+
+DeferredOverlay::DeferredOverlay()
+{
+    InitializeSRWLock(&lock);
+    memset(&frame, 0, sizeof(frame));
+    pSwapChain = nullptr;
+    pending = false;
+    pReady = nullptr;
+    submitted = false;
+    InitializeSRWLock(&recordLock);
+    pDevice = nullptr;
+    pContext = nullptr;
+}
+
+DeferredOverlay::~DeferredOverlay()
+{
+    release();
+}
+
+void DeferredOverlay::release()
+{
+    AcquireSRWLockExclusive(&recordLock);
+    AcquireSRWLockExclusive(&lock);
+    ID3D11CommandList* pList = pReady;
+    pReady = nullptr;
+    // a queued entry stays pending and is skipped by the worker, so it is never queued twice
+    pSwapChain = nullptr;
+    submitted = false;
+    ReleaseSRWLockExclusive(&lock);
+    SAFE_RELEASE(pList);
+    text.clear();
+    numberBuffers.release();
+    textBuffers.release();
+    graph.release();
+    constants.release();
+    SAFE_RELEASE(pContext);
+    SAFE_RELEASE(pDevice);
+    ReleaseSRWLockExclusive(&recordLock);
+}
+
+OverlayRecorder::OverlayRecorder()
+{
+    InitializeSRWLock(&m_queueLock);
+    memset(m_queue, 0, sizeof(m_queue));
+    m_queued = 0;
+    m_recordTicks.store(0, std::memory_order_relaxed);
+    m_recordCount.store(0, std::memory_order_relaxed);
+    m_driverCommandLists.store(false, std::memory_order_relaxed);
+    memset(&m_frame, 0, sizeof(m_frame));
+    m_hWakeEvent = NULL;
+    m_hStopEvent = NULL;
+    m_hThread = NULL;
+}
+
+void OverlayRecorder::ensureWorker()
+{
+    // swapchains may present from different threads
+    AcquireSRWLockExclusive(&m_queueLock);
+    if(!m_hThread) {
+        m_hWakeEvent = CreateEventA(NULL, FALSE, FALSE, NULL);
+        m_hStopEvent = CreateEventA(NULL, TRUE, FALSE, NULL);
+        m_hThread = CreateThread(NULL, 0, workerProc, this, 0, NULL);
+    }
+    ReleaseSRWLockExclusive(&m_queueLock);
+}
+
+void OverlayRecorder::submit(IDXGISwapChain* pSwapChain, DeferredOverlay& overlay, const OverlayFrame& frame)
+{
+    assert(pSwapChain && frame.cfg);
+    if(!m_hThread)
+        ensureWorker();
+    overlay.submitted = true;
+    // the frame's config snapshot is kept until the worker has recorded or dropped it
+    ConfigManager::instance().pinAgain(frame.cfgPin);
+
+    AcquireSRWLockExclusive(&overlay.lock);
+    ID3D11CommandList* pList = overlay.pReady;
+    overlay.pReady = nullptr;
+    int replacedPin = overlay.frame.cfgPin;
+    // queued once however many frames arrive before the worker gets to it, it records the newest
+    bool queue = !overlay.pending;
+    overlay.frame = frame;
+    overlay.pSwapChain = pSwapChain;
+    overlay.pending = true;
+    ReleaseSRWLockExclusive(&overlay.lock);
+    if(!queue)
+        ConfigManager::instance().unpin(replacedPin);
+
+    if(queue) {
+        AcquireSRWLockExclusive(&m_queueLock);
+        assert(m_queued < queue_size);
+        m_queue[m_queued ++] = &overlay;
+        ReleaseSRWLockExclusive(&m_queueLock);
+        SetEvent(m_hWakeEvent);
+    }
+
+    if(pList) {
+        ID3D11Device* pDevice = nullptr;
+        ID3D11DeviceContext* pContext = nullptr;
+        if(SUCCEEDED(pSwapChain->GetDevice(__uuidof(ID3D11Device), (void**)&pDevice))) {
+            pDevice->GetImmediateContext(&pContext);
+            // TRUE puts the game's pipeline state back after the list
+            pContext->ExecuteCommandList(pList, TRUE);
+            pContext->Release();
+            pDevice->Release();
+        }
+        pList->Release();
+    }
+}
+
+void OverlayRecorder::drain(DeferredOverlay& overlay)
+{
+    AcquireSRWLockExclusive(&m_queueLock);
+    for(int i = 0; i < m_queued; i ++) {
+        if(m_queue[i] == &overlay) {
+            m_queued --;
+            memmove(m_queue + i, m_queue + i + 1, (m_queued - i) * sizeof(m_queue[0]));
+            break;
+        }
+    }
+    ReleaseSRWLockExclusive(&m_queueLock);
+
+    // the worker may have taken the entry already; it finds nothing pending once it gets the lock
+    AcquireSRWLockExclusive(&overlay.recordLock);
+    AcquireSRWLockExclusive(&overlay.lock);
+    bool dropped = overlay.pending;
+    int droppedPin = overlay.frame.cfgPin;
+    overlay.pending = false;
+    overlay.pSwapChain = nullptr;
+    ReleaseSRWLockExclusive(&overlay.lock);
+    ReleaseSRWLockExclusive(&overlay.recordLock);
+    if(dropped)
+        ConfigManager::instance().unpin(droppedPin);
+}
+
+bool OverlayRecorder::takeRecordCost(double& avgUs, bool& driverCommandLists)
+{
+    uint32_t count = m_recordCount.exchange(0, std::memory_order_relaxed);
+    uint64_t ticks = m_recordTicks.exchange(0, std::memory_order_relaxed);
+    driverCommandLists = m_driverCommandLists.load(std::memory_order_relaxed);
+    if(count == 0)
+        return false;
+    avgUs = (double)FrameClock::instance().toNs(ticks) / 1000.0 / count;
+    return true;
+}
+
+void OverlayRecorder::shutdown()
+{
+    // called from DllMain, so signal only and never wait on the thread
+    if(m_hStopEvent)
+        SetEvent(m_hStopEvent);
+}
+
+void OverlayRecorder::record(DeferredOverlay& overlay)
+{
+    AcquireSRWLockExclusive(&overlay.recordLock);
+    AcquireSRWLockExclusive(&overlay.lock);
+    IDXGISwapChain* pSwapChain = overlay.pending ? overlay.pSwapChain : nullptr;
+    bool dropped = overlay.pending && !pSwapChain;
+    int droppedPin = overlay.frame.cfgPin;
+    if(pSwapChain)
+        m_frame = overlay.frame;
+    overlay.pending = false;
+    ReleaseSRWLockExclusive(&overlay.lock);
+    if(dropped)
+        ConfigManager::instance().unpin(droppedPin);
+
+    if(pSwapChain) {
+        uint64_t start = FrameClock::instance().now();
+        FrameArena::current().beginFrame();
+        ID3D11CommandList* pList = recordFrame(overlay, pSwapChain, m_frame);
+        if(pList) {
+            m_recordTicks.fetch_add(FrameClock::instance().now() - start, std::memory_order_relaxed);
+            m_recordCount.fetch_add(1, std::memory_order_relaxed);
+            AcquireSRWLockExclusive(&overlay.lock);
+            ID3D11CommandList* pStale = overlay.pReady;
+            overlay.pReady = pList;
+            ReleaseSRWLockExclusive(&overlay.lock);
+            SAFE_RELEASE(pStale);
+        }
+        ConfigManager::instance().unpin(m_frame.cfgPin);
+    }
+    ReleaseSRWLockExclusive(&overlay.recordLock);
+}
+
+ID3D11CommandList* OverlayRecorder::recordFrame(DeferredOverlay& overlay, IDXGISwapChain* pSwapChain, const OverlayFrame& frame)
+{
+    ID3D11Device* pDevice = nullptr;
+    if(FAILED(pSwapChain->GetDevice(__uuidof(ID3D11Device), (void**)&pDevice)))
+        return nullptr;
+    if(overlay.pDevice != pDevice) {
+        overlay.text.clear();
+        overlay.numberBuffers.release();
+        overlay.textBuffers.release();
+        overlay.graph.release();
+        overlay.constants.release();
+        SAFE_RELEASE(overlay.pContext);
+        SAFE_RELEASE(overlay.pDevice);
+        pDevice->CreateDeferredContext(0, &overlay.pContext);
+        if(!overlay.pContext) {
+            pDevice->Release();
+            return nullptr;
+        }
+        overlay.pDevice = pDevice;
+        overlay.pDevice->AddRef();
+        D3D11_FEATURE_DATA_THREADING threading;
+        bool driverCommandLists = SUCCEEDED(pDevice->CheckFeatureSupport(D3D11_FEATURE_THREADING, &threading, sizeof(threading))) &&
+            threading.DriverCommandLists;
+        m_driverCommandLists.store(driverCommandLists, std::memory_order_relaxed);
+    }
+
+    // a view per list rather than one kept around, so nothing but an unexecuted list holds the back buffer
+    ID3D11Texture2D* pBackBuffer = nullptr;
+    ID3D11RenderTargetView* pTarget = nullptr;
+    if(SUCCEEDED(pSwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (void**)&pBackBuffer))) {
+        pDevice->CreateRenderTargetView(pBackBuffer, nullptr, &pTarget);
+        pBackBuffer->Release();
+    }
+    ID3D11CommandList* pList = nullptr;
+    if(pTarget) {
+        ID3D11DeviceContext* pContext = overlay.pContext;
+        const OverlayConfig& cfg = *frame.cfg;
+        DrawNumberTool& tool = DrawNumberTool::instance();
+        // every list starts with nothing bound
+        D3D11_VIEWPORT viewport = { 0.f, 0.f, frame.width, frame.height, 0.f, 1.f };
+        pContext->OMSetRenderTargets(1, &pTarget, nullptr);
+        pContext->RSSetViewports(1, &viewport);
+        tool.renderNumbers(pDevice, pContext, &overlay.constants, overlay.numberBuffers, frame.numbers, frame.count,
+            frame.x, frame.y, frame.width, frame.height, cfg);
+        if(frame.labels) {
+            tool.layoutLabels(overlay.text, frame.labels, frame.count, frame.x, frame.y, cfg);
+            tool.renderText(pDevice, pContext, &overlay.constants, overlay.text, overlay.textBuffers, frame.width, frame.height);
+        }
+        if(frame.graph) {
+            tool.renderGraph(pDevice, pContext, &overlay.constants, overlay.graph, frame.frameUs, OverlayFrame::graph_capacity, frame.frameCount,
+                frame.x, frame.y + tool.numberHeight(), frame.width, frame.height, cfg);
+        }
+        pContext->FinishCommandList(FALSE, &pList);
+        pTarget->Release();
+    }
+    pDevice->Release();
+    return pList;
+}
+
+DWORD __stdcall OverlayRecorder::workerProc(LPVOID lpParam)
+{
+    OverlayRecorder* pThis = (OverlayRecorder*)lpParam;
+    DeviceActivity::instance().setRecorderThread(GetCurrentThreadId());
+    HANDLE handles[] = { pThis->m_hStopEvent, pThis->m_hWakeEvent };
+    while(WaitForMultipleObjects(2, handles, FALSE, INFINITE) == WAIT_OBJECT_0 + 1) {
+        for(;;) {
+            DeferredOverlay* pOverlay = nullptr;
+            AcquireSRWLockExclusive(&pThis->m_queueLock);
+            if(pThis->m_queued > 0) {
+                pOverlay = pThis->m_queue[0];
+                pThis->m_queued --;
+                memmove(pThis->m_queue, pThis->m_queue + 1, pThis->m_queued * sizeof(pThis->m_queue[0]));
+            }
+            ReleaseSRWLockExclusive(&pThis->m_queueLock);
+            if(!pOverlay)
+                break;
+            pThis->record(*pOverlay);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <Windows.h>
+#include <d3d11.h>
+#include <stdint.h>
+#include <atomic>
+#include "DrawNumber.h"
+#include "TextLayout.h"
+
+struct OverlayConfig;
+
+// what the overlay shows for one frame, copied to the recording thread
+struct OverlayFrame
+{
+    enum { max_rows = 4, graph_capacity = 128 };
+
+    int                         numbers[max_rows];
+    int                         count;
+    const char* const*          labels;             /* count static strings, nullptr for none */
+    bool                        graph;
+    uint32_t                    frameUs[graph_capacity];    /* the swapchain's frame time ring, for the graph */
+    uint64_t                    frameCount;
+    float                       x;
+    float                       y;
+    float                       width;              /* back buffer size */
+    float                       height;
+    const OverlayConfig*        cfg;
+    int                         cfgPin;             /* ConfigManager slot cfg was read under, pinned again while the frame is queued */
+};
+
+/*
+ * A swapchain's side of OverlayRecorder. The frame handed over and the
+ * finished list are guarded by lock; the deferred context and the buffers it
+ * draws from belong to the recording thread, which holds recordLock while it
+ * uses them.
+ */
+struct DeferredOverlay
+{
+    SRWLOCK                     lock;
+    OverlayFrame                frame;
+    IDXGISwapChain*             pSwapChain;         /* no reference, the registry drops the stats first */
+    bool                        pending;            /* frame not taken by the recording thread yet */
+    ID3D11CommandList*          pReady;             /* recorded, not executed yet */
+    bool                        submitted;          /* Present thread only */
+
+    SRWLOCK                     recordLock;
+    ID3D11Device*               pDevice;
+    ID3D11DeviceContext*        pContext;
+    TextBatch                   text;
+    QuadBuffers                 numberBuffers;
+    QuadBuffers                 textBuffers;
+    FrameGraphRing              graph;
+    DeferredConstants           constants;
+
+    DeferredOverlay();
+    ~DeferredOverlay();
+    // waits for a recording in progress, then drops the context and an unexecuted list,
+    // which holds a view of the back buffer; ResizeBuffers needs that gone
+    void release();
+
+private:
+    DeferredOverlay(const DeferredOverlay&);
+};
+
+/*
+ * Records the overlay into a deferred context on a worker thread, so the
+ * Present hook only replays it with ExecuteCommandList. Present hands the
+ * frame's figures over and executes the list finished for an earlier frame,
+ * so the overlay trails by one Present. Each swapchain has two lists at
+ * most, the one waiting for Present and the one being recorded; a list
+ * Present did not take in time is replaced by the newer one.
+ *
+ * Whether this pays off depends on the driver: without driver command lists
+ * (D3D11_FEATURE_THREADING) the runtime keeps the recorded calls and replays
+ * them on the immediate context itself. The recording cost is summed here
+ * and logged next to the cost left in Present, against overlay_deferred = 0.
+ */
+class OverlayRecorder
+{
+public:
+    enum { queue_size = 16 };
+
+    static OverlayRecorder& instance()
+    {
+        static OverlayRecorder inst;
+        return inst;
+    }
+    // Present thread: executes what was recorded for overlay and queues frame for recording
+    void submit(IDXGISwapChain* pSwapChain, DeferredOverlay& overlay, const OverlayFrame& frame);
+    // any thread: takes overlay out of the queue, drops its pending frame and waits for a recording
+    // in progress, after which the worker holds nothing of it until the next submit
+    void drain(DeferredOverlay& overlay);
+    // average recording time since the last call, false when nothing was recorded
+    bool takeRecordCost(double& avgUs, bool& driverCommandLists);
+    void shutdown();
+
+private:
+    OverlayRecorder();
+    OverlayRecorder(const OverlayRecorder&);
+    void ensureWorker();
+    void record(DeferredOverlay& overlay);
+    ID3D11CommandList* recordFrame(DeferredOverlay& overlay, IDXGISwapChain* pSwapChain, const OverlayFrame& frame);
+    static DWORD __stdcall workerProc(LPVOID lpParam);
+
+private:
+    SRWLOCK                     m_queueLock;
+    DeferredOverlay*            m_queue[queue_size];
+    int                         m_queued;
+    std::atomic<uint64_t>       m_recordTicks;
+    std::atomic<uint32_t>       m_recordCount;
+    std::atomic<bool>           m_driverCommandLists;
+    // worker thread state
+    OverlayFrame                m_frame;
+    HANDLE                      m_hWakeEvent;
+    HANDLE                      m_hStopEvent;
+    HANDLE                      m_hThread;
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+
+// pixels and atlas texels, DrawNumberVS scales both; the same layout as TextVertex
+struct DrawNumberVertex
+{
+    float               position[2];
+    float               color[4];
+    float               tex[2];
+};
+
+enum OverlayAtlas
+{
+    oa_numbers,         // coverage in the first channel, DrawNumberPS
+    oa_text,            // distance field, DrawTextPS
+};
+
+/*
+ * Where OverlayGeometry sends the overlay. A quad is four vertices, top left,
+ * top right, bottom left and bottom right, drawn as two triangles textured
+ * from one atlas; a line strip joins points in pixels. Either is blended over
+ * the target as the D3D11 paths do, SRC_ALPHA / INV_SRC_ALPHA for color and
+ * ONE / INV_SRC_ALPHA for alpha. DrawNumberTool keeps its own buffers per
+ * draw and does not go through here; SoftwareRenderer implements it to render
+ * the overlay on the CPU.
+ */
+class OverlayRenderer
+{
+public:
+    virtual ~OverlayRenderer() {}
+    virtual void drawQuads(OverlayAtlas atlas, const DrawNumberVertex* vertices, uint32_t quadCount) = 0;
+    // pointCount x, y pairs, one pixel wide
+    virtual void drawLineStrip(const float* points, uint32_t pointCount, const float color[4]) = 0;
+};
@@ -0,0 +1,318 @@
+#include "OverlayState.h"
+#include <cassert>
+#include <string.h>
+
+#ifndef SAFE_RELEASE
+#define SAFE_RELEASE(ptr) do { \
+        if(ptr) { \
+            ptr->Release(); \
+            ptr = nullptr; \
+        } \
+    } while(0)
+#endif
+
+OverlayStateGuard::OverlayStateGuard(ID3D11DeviceContext* pContext)
+{
+    m_pContext = pContext;
+    m_captured = 0;
+}
+
+OverlayStateGuard::~OverlayStateGuard()
+{
+    restore();
+}
+
+void OverlayStateGuard::setVertexShader(ID3D11VertexShader* pShader)
+{
+    if(!(m_captured & slot_vs)) {
+        m_savedVSInstanceCount = D3D11_SHADER_MAX_INTERFACES;
+        m_pContext->VSGetShader(&m_savedVS, m_savedVSInstances, &m_savedVSInstanceCount);
+        m_VS = m_savedVS;
+        m_captured |= slot_vs;
+    }
+    if(m_VS != pShader) {
+        m_pContext->VSSetShader(pShader, nullptr, 0);
+        m_VS = pShader;
+    }
+}
+
+void OverlayStateGuard::setPixelShader(ID3D11PixelShader* pShader)
+{
+    if(!(m_captured & slot_ps)) {
+        m_savedPSInstanceCount = D3D11_SHADER_MAX_INTERFACES;
+        m_pContext->PSGetShader(&m_savedPS, m_savedPSInstances, &m_savedPSInstanceCount);
+        m_PS = m_savedPS;
+        m_captured |= slot_ps;
+    }
+    if(m_PS != pShader) {
+        m_pContext->PSSetShader(pShader, nullptr, 0);
+        m_PS = pShader;
+    }
+}
+
+void OverlayStateGuard::setVSResource(ID3D11ShaderResourceView* pView)
+{
+    if(!(m_captured & slot_vs_srv)) {
+        m_pContext->VSGetShaderResources(0, 1, &m_savedVSResource);
+        m_VSResource = m_savedVSResource;
+        m_captured |= slot_vs_srv;
+    }
+    if(m_VSResource != pView) {
+        m_pContext->VSSetShaderResources(0, 1, &pView);
+        m_VSResource = pView;
+    }
+}
+
+void OverlayStateGuard::setPSResource(ID3D11ShaderResourceView* pView, UINT slot)
+{
+    assert(slot < ps_resource_slots);
+    UINT captured = slot == 0 ? slot_ps_srv : slot_ps_srv1;
+    if(!(m_captured & captured)) {
+        m_pContext->PSGetShaderResources(slot, 1, &m_savedPSResources[slot]);
+        m_PSResources[slot] = m_savedPSResources[slot];
+        m_captured |= captured;
+    }
+    if(m_PSResources[slot] != pView) {
+        m_pContext->PSSetShaderResources(slot, 1, &pView);
+        m_PSResources[slot] = pView;
+    }
+}
+
+void OverlayStateGuard::setVSConstants(ID3D11Buffer* pBuffer)
+{
+    if(!(m_captured & slot_vs_cb)) {
+        m_pContext->VSGetConstantBuffers(0, 1, &m_savedVSConstants);
+        m_VSConstants = m_savedVSConstants;
+        m_captured |= slot_vs_cb;
+    }
+    if(m_VSConstants != pBuffer) {
+        m_pContext->VSSetConstantBuffers(0, 1, &pBuffer);
+        m_VSConstants = pBuffer;
+    }
+}
+
+void OverlayStateGuard::setPSSampler(ID3D11SamplerState* pSampler)
+{
+    if(!(m_captured & slot_ps_sampler)) {
+        m_pContext->PSGetSamplers(0, 1, &m_savedPSSampler);
+        m_PSSampler = m_savedPSSampler;
+        m_captured |= slot_ps_sampler;
+    }
+    if(m_PSSampler != pSampler) {
+        m_pContext->PSSetSamplers(0, 1, &pSampler);
+        m_PSSampler = pSampler;
+    }
+}
+
+void OverlayStateGuard::setInputLayout(ID3D11InputLayout* pLayout)
+{
+    if(!(m_captured & slot_layout)) {
+        m_pContext->IAGetInputLayout(&m_savedLayout);
+        m_layout = m_savedLayout;
+        m_captured |= slot_layout;
+    }
+    if(m_layout != pLayout) {
+        m_pContext->IASetInputLayout(pLayout);
+        m_layout = pLayout;
+    }
+}
+
+void OverlayStateGuard::setVertexBuffer(ID3D11Buffer* pBuffer, UINT stride)
+{
+    if(!(m_captured & slot_vb)) {
+        m_pContext->IAGetVertexBuffers(0, 1, &m_savedVB.pBuffer, &m_savedVB.stride, &m_savedVB.offset);
+        m_VB = m_savedVB;
+        m_captured |= slot_vb;
+    }
+    if(m_VB.pBuffer != pBuffer || m_VB.stride != stride || m_VB.offset != 0) {
+        UINT offset = 0;
+        m_pContext->IASetVertexBuffers(0, 1, &pBuffer, &stride, &offset);
+        m_VB.pBuffer = pBuffer;
+        m_VB.stride = stride;
+        m_VB.offset = 0;
+    }
+}
+
+void OverlayStateGuard::setIndexBuffer(ID3D11Buffer* pBuffer, DXGI_FORMAT format)
+{
+    if(!(m_captured & slot_ib)) {
+        m_pContext->IAGetIndexBuffer(&m_savedIB.pBuffer, &m_savedIB.format, &m_savedIB.offset);
+        m_IB = m_savedIB;
+        m_captured |= slot_ib;
+    }
+    if(m_IB.pBuffer != pBuffer || m_IB.format != format || m_IB.offset != 0) {
+        m_pContext->IASetIndexBuffer(pBuffer, format, 0);
+        m_IB.pBuffer = pBuffer;
+        m_IB.format = format;
+        m_IB.offset = 0;
+    }
+}
+
+void OverlayStateGuard::setTopology(D3D11_PRIMITIVE_TOPOLOGY topology)
+{
+    if(!(m_captured & slot_topology)) {
+        m_pContext->IAGetPrimitiveTopology(&m_savedTopology);
+        m_topology = m_savedTopology;
+        m_captured |= slot_topology;
+    }
+    if(m_topology != topology) {
+        m_pContext->IASetPrimitiveTopology(topology);
+        m_topology = topology;
+    }
+}
+
+void OverlayStateGuard::setBlendState(ID3D11BlendState* pState)
+{
+    if(!(m_captured & slot_blend)) {
+        m_pContext->OMGetBlendState(&m_savedBlend, m_savedBlendFactor, &m_savedSampleMask);
+        m_blend = m_savedBlend;
+        m_sampleMask = m_savedSampleMask;
+        m_captured |= slot_blend;
+    }
+    if(m_blend != pState || m_sampleMask != 0xffffffff) {
+        m_pContext->OMSetBlendState(pState, m_savedBlendFactor, 0xffffffff);
+        m_blend = pState;
+        m_sampleMask = 0xffffffff;
+    }
+}
+
+void OverlayStateGuard::setDepthStencilState(ID3D11DepthStencilState* pState)
+{
+    if(!(m_captured & slot_depth)) {
+        m_pContext->OMGetDepthStencilState(&m_savedDepth, &m_savedStencilRef);
+        m_depth = m_savedDepth;
+        m_captured |= slot_depth;
+    }
+    if(m_depth != pState) {
+        m_pContext->OMSetDepthStencilState(pState, m_savedStencilRef);
+        m_depth = pState;
+    }
+}
+
+void OverlayStateGuard::setRasterizerState(ID3D11RasterizerState* pState)
+{
+    if(!(m_captured & slot_raster)) {
+        m_pContext->RSGetState(&m_savedRaster);
+        m_raster = m_savedRaster;
+        m_captured |= slot_raster;
+    }
+    if(m_raster != pState) {
+        m_pContext->RSSetState(pState);
+        m_raster = pState;
+    }
+}
+
+void OverlayStateGuard::setRenderTarget(ID3D11RenderTargetView* pTarget)
+{
+    if(!(m_captured & slot_target)) {
+        m_pContext->OMGetRenderTargets(D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, m_savedTargets, &m_savedDepthTarget);
+        m_targetsMatch = true;
+        m_captured |= slot_target;
+    }
+    bool bound = m_targetsMatch ? m_savedTargets[0] == pTarget && !m_savedDepthTarget : m_target == pTarget;
+    if(m_targetsMatch && bound) {
+        for(int i = 1; i < D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT; i ++) {
+            if(m_savedTargets[i])
+                bound = false;
+        }
+    }
+    if(!bound) {
+        m_pContext->OMSetRenderTargets(1, &pTarget, nullptr);
+        m_target = pTarget;
+        m_targetsMatch = false;
+    }
+}
+
+void OverlayStateGuard::setViewport(const D3D11_VIEWPORT& viewport)
+{
+    if(!(m_captured & slot_viewport)) {
+        m_savedViewportCount = D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
+        m_pContext->RSGetViewports(&m_savedViewportCount, m_savedViewports);
+        m_viewportsMatch = true;
+        m_captured |= slot_viewport;
+    }
+    bool bound = m_viewportsMatch ?
+        m_savedViewportCount == 1 && memcmp(&m_savedViewports[0], &viewport, sizeof(viewport)) == 0 :
+        memcmp(&m_viewport, &viewport, sizeof(viewport)) == 0;
+    if(!bound) {
+        m_pContext->RSSetViewports(1, &viewport);
+        m_viewport = viewport;
+        m_viewportsMatch = false;
+    }
+}
+
+void OverlayStateGuard::restore()
+{
+    // the shadow tells which slots still differ from the game's; a slot the overlay left as it found it costs nothing
+    if((m_captured & slot_vs) && m_VS != m_savedVS)
+        m_pContext->VSSetShader(m_savedVS, m_savedVSInstances, m_savedVSInstanceCount);
+    if((m_captured & slot_ps) && m_PS != m_savedPS)
+        m_pContext->PSSetShader(m_savedPS, m_savedPSInstances, m_savedPSInstanceCount);
+    if((m_captured & slot_vs_srv) && m_VSResource != m_savedVSResource)
+        m_pContext->VSSetShaderResources(0, 1, &m_savedVSResource);
+    if((m_captured & slot_ps_srv) && m_PSResources[0] != m_savedPSResources[0])
+        m_pContext->PSSetShaderResources(0, 1, &m_savedPSResources[0]);
+    if((m_captured & slot_ps_srv1) && m_PSResources[1] != m_savedPSResources[1])
+        m_pContext->PSSetShaderResources(1, 1, &m_savedPSResources[1]);
+    if((m_captured & slot_vs_cb) && m_VSConstants != m_savedVSConstants)
+        m_pContext->VSSetConstantBuffers(0, 1, &m_savedVSConstants);
+    if((m_captured & slot_ps_sampler) && m_PSSampler != m_savedPSSampler)
+        m_pContext->PSSetSamplers(0, 1, &m_savedPSSampler);
+    if((m_captured & slot_layout) && m_layout != m_savedLayout)
+        m_pContext->IASetInputLayout(m_savedLayout);
+    if((m_captured & slot_vb) && (m_VB.pBuffer != m_savedVB.pBuffer || m_VB.stride != m_savedVB.stride || m_VB.offset != m_savedVB.offset))
+        m_pContext->IASetVertexBuffers(0, 1, &m_savedVB.pBuffer, &m_savedVB.stride, &m_savedVB.offset);
+    if((m_captured & slot_ib) && (m_IB.pBuffer != m_savedIB.pBuffer || m_IB.format != m_savedIB.format || m_IB.offset != m_savedIB.offset))
+        m_pContext->IASetIndexBuffer(m_savedIB.pBuffer, m_savedIB.format, m_savedIB.offset);
+    if((m_captured & slot_topology) && m_topology != m_savedTopology)
+        m_pContext->IASetPrimitiveTopology(m_savedTopology);
+    if((m_captured & slot_blend) && (m_blend != m_savedBlend || m_sampleMask != m_savedSampleMask))
+        m_pContext->OMSetBlendState(m_savedBlend, m_savedBlendFactor, m_savedSampleMask);
+    if((m_captured & slot_depth) && m_depth != m_savedDepth)
+        m_pContext->OMSetDepthStencilState(m_savedDepth, m_savedStencilRef);
+    if((m_captured & slot_raster) && m_raster != m_savedRaster)
+        m_pContext->RSSetState(m_savedRaster);
+    if((m_captured & slot_target) && !m_targetsMatch)
+        m_pContext->OMSetRenderTargets(D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, m_savedTargets, m_savedDepthTarget);
+    if((m_captured & slot_viewport) && !m_viewportsMatch)
+        m_pContext->RSSetViewports(m_savedViewportCount, m_savedViewports);
+
+    if(m_captured & slot_vs) {
+        SAFE_RELEASE(m_savedVS);
+        for(UINT i = 0; i < m_savedVSInstanceCount; i ++)
+            SAFE_RELEASE(m_savedVSInstances[i]);
+    }
+    if(m_captured & slot_ps) {
+        SAFE_RELEASE(m_savedPS);
+        for(UINT i = 0; i < m_savedPSInstanceCount; i ++)
+            SAFE_RELEASE(m_savedPSInstances[i]);
+    }
+    if(m_captured & slot_vs_srv)
+        SAFE_RELEASE(m_savedVSResource);
+    if(m_captured & slot_ps_srv)
+        SAFE_RELEASE(m_savedPSResources[0]);
+    if(m_captured & slot_ps_srv1)
+        SAFE_RELEASE(m_savedPSResources[1]);
+    if(m_captured & slot_vs_cb)
+        SAFE_RELEASE(m_savedVSConstants);
+    if(m_captured & slot_ps_sampler)
+        SAFE_RELEASE(m_savedPSSampler);
+    if(m_captured & slot_layout)
+        SAFE_RELEASE(m_savedLayout);
+    if(m_captured & slot_vb)
+        SAFE_RELEASE(m_savedVB.pBuffer);
+    if(m_captured & slot_ib)
+        SAFE_RELEASE(m_savedIB.pBuffer);
+    if(m_captured & slot_blend)
+        SAFE_RELEASE(m_savedBlend);
+    if(m_captured & slot_depth)
+        SAFE_RELEASE(m_savedDepth);
+    if(m_captured & slot_raster)
+        SAFE_RELEASE(m_savedRaster);
+    if(m_captured & slot_target) {
+        for(int i = 0; i < D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT; i ++)
+            SAFE_RELEASE(m_savedTargets[i]);
+        SAFE_RELEASE(m_savedDepthTarget);
+    }
+    m_captured = 0;
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <d3d11.h>
+
+/*
+ * Pipeline state of the game around the overlay draws. Nothing is read up
+ * front: the first set of a slot reads the game's value, later sets compare
+ * against a shadow of what is bound and only reach the context when the
+ * value changes. restore() puts back only the slots that still differ from
+ * the game's, so a slot that already matched costs a single Get. One guard
+ * may span several draws; all calls are on the thread owning the context.
+ */
+class OverlayStateGuard
+{
+public:
+    explicit OverlayStateGuard(ID3D11DeviceContext* pContext);
+    ~OverlayStateGuard();
+
+    void setVertexShader(ID3D11VertexShader* pShader);
+    void setPixelShader(ID3D11PixelShader* pShader);
+    // slot 0 of each stage is all the overlay uses, but for the second atlas of the widgets
+    void setVSResource(ID3D11ShaderResourceView* pView);
+    void setPSResource(ID3D11ShaderResourceView* pView, UINT slot = 0);
+    void setVSConstants(ID3D11Buffer* pBuffer);
+    void setPSSampler(ID3D11SamplerState* pSampler);
+    void setInputLayout(ID3D11InputLayout* pLayout);
+    void setVertexBuffer(ID3D11Buffer* pBuffer, UINT stride);
+    void setIndexBuffer(ID3D11Buffer* pBuffer, DXGI_FORMAT format);
+    void setTopology(D3D11_PRIMITIVE_TOPOLOGY topology);
+    // the overlay blend ignores the blend factor and never uses stencil, so the game's factor and stencil ref are kept
+    void setBlendState(ID3D11BlendState* pState);
+    void setDepthStencilState(ID3D11DepthStencilState* pState);
+    void setRasterizerState(ID3D11RasterizerState* pState);
+    // a single render target without depth, and a single viewport; the game's full sets come back on restore
+    void setRenderTarget(ID3D11RenderTargetView* pTarget);
+    void setViewport(const D3D11_VIEWPORT& viewport);
+    // puts back what the game had bound and releases the references taken by the Gets; the destructor calls it too
+    void restore();
+
+private:
+    OverlayStateGuard(const OverlayStateGuard&);
+    OverlayStateGuard& operator=(const OverlayStateGuard&);
+
+private:
+    enum { ps_resource_slots = 2 };
+
+    enum
+    {
+        slot_vs = 1 << 0,
+        slot_ps = 1 << 1,
+        slot_vs_srv = 1 << 2,
+        slot_ps_srv = 1 << 3,
+        slot_vs_cb = 1 << 4,
+        slot_ps_sampler = 1 << 5,
+        slot_layout = 1 << 6,
+        slot_vb = 1 << 7,
+        slot_ib = 1 << 8,
+        slot_topology = 1 << 9,
+        slot_blend = 1 << 10,
+        slot_depth = 1 << 11,
+        slot_raster = 1 << 12,
+        slot_target = 1 << 13,
+        slot_viewport = 1 << 14,
+        slot_ps_srv1 = 1 << 15,
+    };
+
+    struct VertexBufferBinding
+    {
+        ID3D11Buffer*           pBuffer;
+        UINT                    stride;
+        UINT                    offset;
+    };
+
+    struct IndexBufferBinding
+    {
+        ID3D11Buffer*           pBuffer;
+        DXGI_FORMAT             format;
+        UINT                    offset;
+    };
+
+    ID3D11DeviceContext*        m_pContext;
+    UINT                        m_captured;         /* slot_* read from the game */
+
+    // the game's values, held with a reference until restore()
+    ID3D11VertexShader*         m_savedVS;
+    ID3D11ClassInstance*        m_savedVSInstances[D3D11_SHADER_MAX_INTERFACES];
+    UINT                        m_savedVSInstanceCount;
+    ID3D11PixelShader*          m_savedPS;
+    ID3D11ClassInstance*        m_savedPSInstances[D3D11_SHADER_MAX_INTERFACES];
+    UINT                        m_savedPSInstanceCount;
+    ID3D11ShaderResourceView*   m_savedVSResource;
+    ID3D11ShaderResourceView*   m_savedPSResources[ps_resource_slots];
+    ID3D11Buffer*               m_savedVSConstants;
+    ID3D11SamplerState*         m_savedPSSampler;
+    ID3D11InputLayout*          m_savedLayout;
+    VertexBufferBinding         m_savedVB;
+    IndexBufferBinding          m_savedIB;
+    D3D11_PRIMITIVE_TOPOLOGY    m_savedTopology;
+    ID3D11BlendState*           m_savedBlend;
+    FLOAT                       m_savedBlendFactor[4];
+    UINT                        m_savedSampleMask;
+    ID3D11DepthStencilState*    m_savedDepth;
+    UINT                        m_savedStencilRef;
+    ID3D11RasterizerState*      m_savedRaster;
+    ID3D11RenderTargetView*     m_savedTargets[D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT];
+    ID3D11DepthStencilView*     m_savedDepthTarget;
+    D3D11_VIEWPORT              m_savedViewports[D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE];
+    UINT                        m_savedViewportCount;
+
+    // shadow of what is bound now, for the slots already captured
+    ID3D11VertexShader*         m_VS;
+    ID3D11PixelShader*          m_PS;
+    ID3D11ShaderResourceView*   m_VSResource;
+    ID3D11ShaderResourceView*   m_PSResources[ps_resource_slots];
+    ID3D11Buffer*               m_VSConstants;
+    ID3D11SamplerState*         m_PSSampler;
+    ID3D11InputLayout*          m_layout;
+    VertexBufferBinding         m_VB;
+    IndexBufferBinding          m_IB;
+    D3D11_PRIMITIVE_TOPOLOGY    m_topology;
+    ID3D11BlendState*           m_blend;
+    UINT                        m_sampleMask;
+    ID3D11DepthStencilState*    m_depth;
+    ID3D11RasterizerState*      m_raster;
+    bool                        m_targetsMatch;     /* the bound targets are still the game's */
+    ID3D11RenderTargetView*     m_target;           /* when they are not, the single one bound */
+    bool                        m_viewportsMatch;
+    D3D11_VIEWPORT              m_viewport;
+};
@@ -0,0 +1,158 @@
+#include "OverlayWidgets.h"
+#include <cassert>
+#include <string.h>
+
+WidgetTree::WidgetTree()
+{
+    clear();
+}
+
+void WidgetTree::clear()
+{
+    memset(m_widgets, 0, sizeof(m_widgets));
+    m_count = 0;
+    m_numberQuads = 0;
+    m_textQuads = 0;
+    add(wk_group, -1, 0.f, 0.f, 0);
+}
+
+int WidgetTree::add(WidgetKind kind, int parent, float x, float y, uint32_t quadCount)
+{
+    assert(parent < m_count && (parent < 0 || m_widgets[parent].kind == wk_group));
+    uint32_t first;
+    if(kind == wk_label) {
+        if(text_first + m_textQuads + quadCount > quads_max)
+            return -1;
+        first = text_first + m_textQuads;
+    }
+    else {
+        if(m_numberQuads + quadCount > text_first)
+            return -1;
+        first = m_numberQuads;
+    }
+    if(m_count == widgets_max)
+        return -1;
+    if(kind == wk_label)
+        m_textQuads += quadCount;
+    else
+        m_numberQuads += quadCount;
+
+    OverlayWidget& widget = m_widgets[m_count];
+    memset(&widget, 0, sizeof(widget));
+    widget.kind = kind;
+    widget.parent = parent;
+    widget.x = x;
+    widget.y = y;
+    widget.visible = true;
+    widget.firstQuad = first;
+    widget.quadCount = quadCount;
+    widget.moved = true;
+    widget.dirty = kind != wk_group;
+    return m_count ++;
+}
+
+int WidgetTree::addGroup(int parent, float x, float y)
+{
+    return add(wk_group, parent, x, y, 0);
+}
+
+int WidgetTree::addNumber(int parent, float x, float y, const WidgetStyle& style)
+{
+    int index = add(wk_number, parent, x, y, number_quads);
+    if(index >= 0)
+        m_widgets[index].style = style;
+    return index;
+}
+
+int WidgetTree::addLabel(int parent, float x, float y, const char* text, const WidgetStyle& style)
+{
+    int index = add(wk_label, parent, x, y, OverlayWidget::text_max - 1);
+    if(index >= 0) {
+        m_widgets[index].style = style;
+        strncpy(m_widgets[index].text, text, OverlayWidget::text_max - 1);
+    }
+    return index;
+}
+
+void WidgetTree::setPosition(int widget, float x, float y)
+{
+    assert(widget >= 0 && widget < m_count);
+    OverlayWidget& w = m_widgets[widget];
+    if(w.x != x || w.y != y) {
+        w.x = x;
+        w.y = y;
+        w.moved = true;
+    }
+}
+
+void WidgetTree::setVisible(int widget, bool visible)
+{
+    assert(widget >= 0 && widget < m_count);
+    OverlayWidget& w = m_widgets[widget];
+    if(w.visible != visible) {
+        w.visible = visible;
+        w.moved = true;
+    }
+}
+
+void WidgetTree::setStyle(int widget, const WidgetStyle& style)
+{
+    assert(widget >= 0 && widget < m_count);
+    OverlayWidget& w = m_widgets[widget];
+    if(memcmp(&w.style, &style, sizeof(style)) != 0) {
+        w.style = style;
+        w.dirty = w.kind != wk_group;
+    }
+}
+
+void WidgetTree::setNumber(int widget, int value)
+{
+    assert(widget >= 0 && widget < m_count && m_widgets[widget].kind == wk_number);
+    OverlayWidget& w = m_widgets[widget];
+    if(w.value != value) {
+        w.value = value;
+        w.dirty = true;
+    }
+}
+
+void WidgetTree::setText(int widget, const char* text)
+{
+    assert(widget >= 0 && widget < m_count && m_widgets[widget].kind == wk_label);
+    OverlayWidget& w = m_widgets[widget];
+    if(strncmp(w.text, text, OverlayWidget::text_max - 1) != 0) {
+        memset(w.text, 0, sizeof(w.text));
+        strncpy(w.text, text, OverlayWidget::text_max - 1);
+        w.dirty = true;
+    }
+}
+
+void WidgetTree::invalidate()
+{
+    for(int i = 0; i < m_count; i ++) {
+        m_widgets[i].dirty = m_widgets[i].kind != wk_group;
+        m_widgets[i].filled = 0;
+    }
+}
+
+uint32_t WidgetTree::layout()
+{
+    // parents come first, so one pass places the tree; the moved flags are read by the children until it ends
+    uint32_t dirty = 0;
+    for(int i = 0; i < m_count; i ++) {
+        OverlayWidget& w = m_widgets[i];
+        const OverlayWidget* parent = w.parent >= 0 ? &m_widgets[w.parent] : nullptr;
+        if(parent && parent->moved)
+            w.moved = true;
+        if(w.moved) {
+            w.left = (parent ? parent->left : 0.f) + w.x;
+            w.top = (parent ? parent->top : 0.f) + w.y;
+            w.shown = w.visible && (!parent || parent->shown);
+            w.dirty = w.kind != wk_group;
+        }
+        if(w.dirty)
+            dirty ++;
+    }
+    for(int i = 0; i < m_count; i ++)
+        m_widgets[i].moved = false;
+    return dirty;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stdint.h>
+#include "TextLayout.h"
+
+// how a widget looks; a change of any of it tessellates the widget again
+struct WidgetStyle
+{
+    float               color[4];
+    float               bias;               /* wk_number: overlay_bias of the number atlas */
+    float               size;               /* wk_label: line height in pixels */
+};
+
+enum WidgetKind
+{
+    wk_group,           // places its children, draws nothing
+    wk_number,
+    wk_label,
+};
+
+struct OverlayWidget
+{
+    enum { text_max = 16 };
+
+    WidgetKind          kind;
+    int                 parent;             /* always a lower index, -1 for the root */
+    float               x;                  /* relative to the parent */
+    float               y;
+    bool                visible;
+    WidgetStyle         style;
+    int                 value;              /* wk_number */
+    char                text[text_max];     /* wk_label */
+    uint32_t            firstQuad;          /* span of the widget in the vertex buffer */
+    uint32_t            quadCount;
+    uint32_t            filled;             /* quads of the span holding geometry now, the rest is collapsed */
+    // kept by WidgetTree::layout()
+    float               left;               /* back buffer pixels */
+    float               top;
+    bool                shown;              /* visible, and so is every ancestor */
+    bool                moved;              /* placed again, so are the descendants */
+    bool                dirty;              /* to be tessellated and uploaded */
+};
+
+/*
+ * The overlay as a small retained tree. Each drawing widget owns a fixed span
+ * of quads in one persistent vertex buffer, sized for its largest content: a
+ * number the most digits there are, a label text_max - 1 glyphs. Setters
+ * compare with what the widget holds and only a real change marks it dirty;
+ * moving or hiding a group marks its whole subtree. The renderer tessellates
+ * and uploads the dirty widgets alone, as far into the span as the old or
+ * the new geometry reaches, and draws the whole buffer in one call every
+ * frame; quads without geometry are collapsed to a point.
+ *
+ * Number quads fill the buffer from 0 and text quads from text_first, so the
+ * draw tells the two atlases apart by vertex id; the quads between the two
+ * parts stay collapsed. Plain C++ without D3D types, like TextLayout.
+ */
+class WidgetTree
+{
+public:
+    enum
+    {
+        widgets_max = 32,
+        number_quads = 10,                  /* OverlayGeometry::number_digits_max */
+        text_first = 128,
+        quads_max = 512,
+        root = 0,                           /* a group, where the overlay is placed */
+    };
+
+    WidgetTree();
+    // the root alone, at 0, 0
+    void clear();
+    // the new widget's index, -1 when the tree or its part of the buffer is full
+    int addGroup(int parent, float x, float y);
+    int addNumber(int parent, float x, float y, const WidgetStyle& style);
+    int addLabel(int parent, float x, float y, const char* text, const WidgetStyle& style);
+
+    void setPosition(int widget, float x, float y);
+    void setVisible(int widget, bool visible);
+    void setStyle(int widget, const WidgetStyle& style);
+    void setNumber(int widget, int value);
+    void setText(int widget, const char* text);
+
+    // every widget is tessellated again, for a new vertex buffer
+    void invalidate();
+    // places what moved since the last call, returns the widgets to tessellate
+    uint32_t layout();
+    // filled quads of the span were just uploaded
+    void clean(int widget, uint32_t filled) { m_widgets[widget].dirty = false; m_widgets[widget].filled = filled; }
+    int count() const { return m_count; }
+    const OverlayWidget& widget(int index) const { return m_widgets[index]; }
+    // quads the draw covers, the numbers and when there is text up to its end
+    uint32_t drawQuads() const { return m_textQuads > 0 ? text_first + m_textQuads : m_numberQuads; }
+    TextLayoutCache& textCache() { return m_textCache; }
+
+private:
+    WidgetTree(const WidgetTree&);
+    int add(WidgetKind kind, int parent, float x, float y, uint32_t quadCount);
+
+private:
+    OverlayWidget       m_widgets[widgets_max];
+    int                 m_count;
+    uint32_t            m_numberQuads;      /* spans taken from 0 */
+    uint32_t            m_textQuads;        /* and from text_first */
+    TextLayoutCache     m_textCache;
+};
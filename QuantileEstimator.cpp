@@ -0,0 +1,139 @@
+#include "QuantileEstimator.h"
+
+static const double     g_quantiles[FrameQuantiles::quantile_count] = { 0.50, 0.95, 0.99 };
+
+P2Quantile::P2Quantile(double p)
+{
+    m_p = p;
+    reset();
+}
+
+void P2Quantile::reset()
+{
+    for(int i = 0; i < 5; i ++) {
+        m_height[i] = 0.0;
+        m_position[i] = (double)(i + 1);
+    }
+    m_desired[0] = 1.0;
+    m_desired[1] = 1.0 + 2.0 * m_p;
+    m_desired[2] = 1.0 + 4.0 * m_p;
+    m_desired[3] = 3.0 + 2.0 * m_p;
+    m_desired[4] = 5.0;
+    m_increment[0] = 0.0;
+    m_increment[1] = m_p / 2.0;
+    m_increment[2] = m_p;
+    m_increment[3] = (1.0 + m_p) / 2.0;
+    m_increment[4] = 1.0;
+    m_count = 0;
+}
+
+double P2Quantile::parabolic(int i, double d) const
+{
+    const double* n = m_position;
+    const double* q = m_height;
+    return q[i] + d / (n[i + 1] - n[i - 1]) *
+        ((n[i] - n[i - 1] + d) * (q[i + 1] - q[i]) / (n[i + 1] - n[i]) +
+         (n[i + 1] - n[i] - d) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+}
+
+double P2Quantile::linear(int i, int d) const
+{
+    return m_height[i] + d * (m_height[i + d] - m_height[i]) / (m_position[i + d] - m_position[i]);
+}
+
+void P2Quantile::add(double x)
+{
+    if(m_count < 5) {
+        // insertion sort of the first five samples, they become the initial markers
+        int i = (int)m_count;
+        while(i > 0 && m_height[i - 1] > x) {
+            m_height[i] = m_height[i - 1];
+            i --;
+        }
+        m_height[i] = x;
+        m_count ++;
+        return;
+    }
+    m_count ++;
+
+    int k;
+    if(x < m_height[0]) {
+        m_height[0] = x;
+        k = 0;
+    }
+    else if(x >= m_height[4]) {
+        m_height[4] = x;
+        k = 3;
+    }
+    else {
+        k = 0;
+        while(x >= m_height[k + 1])
+            k ++;
+    }
+    for(int i = k + 1; i < 5; i ++)
+        m_position[i] += 1.0;
+    for(int i = 0; i < 5; i ++)
+        m_desired[i] += m_increment[i];
+
+    for(int i = 1; i <= 3; i ++) {
+        double d = m_desired[i] - m_position[i];
+        if((d >= 1.0 && m_position[i + 1] - m_position[i] > 1.0) || (d <= -1.0 && m_position[i - 1] - m_position[i] < -1.0)) {
+            int step = d >= 0.0 ? 1 : -1;
+            double q = parabolic(i, (double)step);
+            // fall back to linear when the parabola would break the ordering of the heights
+            if(m_height[i - 1] < q && q < m_height[i + 1])
+                m_height[i] = q;
+            else
+                m_height[i] = linear(i, step);
+            m_position[i] += (double)step;
+        }
+    }
+}
+
+double P2Quantile::value() const
+{
+    if(m_count == 0)
+        return 0.0;
+    if(m_count < 5) {
+        // nearest rank over the sorted samples
+        int rank = (int)(m_p * (double)m_count + 0.5);
+        if(rank < 1)
+            rank = 1;
+        return m_height[rank - 1];
+    }
+    return m_height[2];
+}
+
+FrameQuantiles::FrameQuantiles()
+{
+    for(int b = 0; b < 2; b ++) {
+        for(int q = 0; q < quantile_count; q ++)
+            m_bank[b][q] = P2Quantile(g_quantiles[q]);
+    }
+    m_current = 0;
+}
+
+void FrameQuantiles::reset()
+{
+    for(int b = 0; b < 2; b ++) {
+        for(int q = 0; q < quantile_count; q ++)
+            m_bank[b][q].reset();
+    }
+    m_current = 0;
+}
+
+void FrameQuantiles::add(double value)
+{
+    for(int b = 0; b < 2; b ++) {
+        for(int q = 0; q < quantile_count; q ++)
+            m_bank[b][q].add(value);
+    }
+}
+
+void FrameQuantiles::rotate()
+{
+    // the younger bank takes over and the one it replaces starts again
+    for(int q = 0; q < quantile_count; q ++)
+        m_bank[m_current][q].reset();
+    m_current ^= 1;
+}
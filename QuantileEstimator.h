@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * P-square estimator (Jain and Chlamtac, 1985) of one quantile of a stream.
+ * Five markers track the minimum, the maximum, the quantile and the two
+ * midpoints between them; each sample moves the markers by at most one
+ * position and adjusts their heights with a piecewise-parabolic fit. Memory
+ * and time per sample are constant, and nothing is stored or sorted.
+ */
+class P2Quantile
+{
+public:
+    explicit P2Quantile(double p = 0.5);
+    void reset();
+    void add(double x);
+    // the estimate, exact while fewer than five samples were added; 0 when empty
+    double value() const;
+    uint32_t count() const { return m_count; }
+
+private:
+    double parabolic(int i, double d) const;
+    double linear(int i, int d) const;
+
+private:
+    double              m_p;
+    double              m_height[5];
+    double              m_position[5];
+    double              m_desired[5];
+    double              m_increment[5];
+    uint32_t            m_count;
+};
+
+/*
+ * Live p50 / p95 / p99 of frame times for the overlay. P-square converges to
+ * the quantile of everything it has seen, so two banks run staggered: every
+ * rotate() restarts the older one, and values come from the bank that has
+ * been running longer. With a rotation every few seconds the figures always
+ * cover between one and two rotation periods of recent frames.
+ */
+class FrameQuantiles
+{
+public:
+    enum
+    {
+        q_p50,
+        q_p95,
+        q_p99,
+        quantile_count,
+    };
+
+    FrameQuantiles();
+    void reset();
+    void add(double value);
+    void rotate();
+    double value(int quantile) const { return m_bank[m_current][quantile].value(); }
+    uint32_t count() const { return m_bank[m_current][0].count(); }
+
+private:
+    P2Quantile          m_bank[2][quantile_count];
+    int                 m_current;          /* bank that has been running longer */
+};
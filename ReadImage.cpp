@@ -177,8 +177,8 @@ static void my_png_warning(png_structp, png_const_charp message)
 {
 }
 
-void my_png_read_fn(png_structp png_ptr, png_bytep data, png_size_t length);
-void my_png_setup_image(image& img, png_structp png_ptr, png_infop info_ptr, float gamma);
+static void my_png_read_fn(png_structp png_ptr, png_bytep data, png_size_t length);
+static void my_png_setup_image(image& img, png_structp png_ptr, png_infop info_ptr, float gamma);
 
 struct png_reader
 {
@@ -338,3 +338,73 @@ bool imageio::read_png_image(image& img, const void* ptr, int size)
     png_reader reader(ds);
     return reader.read(img);
 }
+
+static void my_png_write_fn(png_structp png_ptr, png_bytep data, png_size_t length)
+{
+    std::vector<byte>* out = (std::vector<byte>*)png_get_io_ptr(png_ptr);
+    out->insert(out->end(), data, data + length);
+}
+
+static void my_png_flush_fn(png_structp)
+{
+}
+
+struct png_writer
+{
+    png_struct*         png_ptr;
+    png_info*           info_ptr;
+    png_byte**          row_pointers;
+    std::vector<byte>&  device;
+
+public:
+    png_writer(std::vector<byte>& data):
+        device(data)
+    {
+        png_ptr = nullptr;
+        info_ptr = nullptr;
+        row_pointers = nullptr;
+    }
+    ~png_writer()
+    {
+        if(png_ptr) {
+            png_destroy_write_struct(&png_ptr, info_ptr ? &info_ptr : 0);
+            png_ptr = nullptr;
+        }
+        if(row_pointers) {
+            delete [] row_pointers;
+            row_pointers = nullptr;
+        }
+    }
+    bool write(const image& img)
+    {
+        if(!img.is_valid())
+            return false;
+        png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, 0, 0, 0);
+        if(!png_ptr)
+            return false;
+        png_set_error_fn(png_ptr, 0, 0, my_png_warning);
+        info_ptr = png_create_info_struct(png_ptr);
+        if(!info_ptr)
+            return false;
+        if(setjmp(png_jmpbuf(png_ptr)))
+            return false;
+        png_set_write_fn(png_ptr, &device, my_png_write_fn, my_png_flush_fn);
+        int color_type = img.get_format() == image::fmt_gray ? PNG_COLOR_TYPE_GRAY : PNG_COLOR_TYPE_RGB_ALPHA;
+        png_set_IHDR(png_ptr, info_ptr, img.get_width(), img.get_height(), 8, color_type,
+            PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+        png_set_pHYs(png_ptr, info_ptr, convert_dpi_to_dpm(img.get_xdpi()), convert_dpi_to_dpm(img.get_ydpi()), PNG_RESOLUTION_METER);
+        png_write_info(png_ptr, info_ptr);
+        row_pointers = new png_bytep[img.get_height()];
+        for(int y = 0; y < img.get_height(); y ++)
+            row_pointers[y] = img.get_data(0, y);
+        png_write_image(png_ptr, row_pointers);
+        png_write_end(png_ptr, info_ptr);
+        return true;
+    }
+};
+
+bool imageio::write_png_image(const image& img, std::vector<byte>& data)
+{
+    png_writer writer(data);
+    return writer.write(img);
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <vector>
 
 typedef uint8_t byte;
 typedef uint32_t uint;
@@ -55,4 +56,6 @@ class imageio
 {
 public:
     static bool read_png_image(image& img, const void* ptr, int size);
+    // 8 bit gray or RGBA, appended to data
+    static bool write_png_image(const image& img, std::vector<byte>& data);
 };
@@ -0,0 +1,254 @@
+#include "SoftwareRenderer.h"
+#include <cassert>
+#include <math.h>
+#include <stdlib.h>
+
+// D3D11 snaps vertex positions to 8 bits of sub-pixel precision, and filters with at least 8 bits of weight
+static const int        g_subpixelBits = 8;
+static const float      g_weightSteps = 256.f;
+
+// an attribute over a triangle, a + dx * x + dy * y at pixel x, y
+struct AttributePlane
+{
+    float               a;
+    float               dx;
+    float               dy;
+
+    float at(float x, float y) const { return a + dx * x + dy * y; }
+};
+
+static int64_t snapToSubpixel(float v)
+{
+    return (int64_t)floorf(v * (float)(1 << g_subpixelBits) + 0.5f);
+}
+
+static float texel(const image& atlas, int x, int y)
+{
+    x = x < 0 ? 0 : (x >= atlas.get_width() ? atlas.get_width() - 1 : x);
+    y = y < 0 ? 0 : (y >= atlas.get_height() ? atlas.get_height() - 1 : y);
+    return (float)*atlas.get_data(x, y) / 255.f;
+}
+
+// the first channel at u, v in texels, as a linear sampler with clamped addressing reads it
+static float sampleAtlas(const image& atlas, float u, float v)
+{
+    // texel centers sit at .5
+    float x = u - 0.5f;
+    float y = v - 0.5f;
+    float fx = floorf(x);
+    float fy = floorf(y);
+    float wx = floorf((x - fx) * g_weightSteps + 0.5f) / g_weightSteps;
+    float wy = floorf((y - fy) * g_weightSteps + 0.5f) / g_weightSteps;
+    int x0 = (int)fx;
+    int y0 = (int)fy;
+    float top = texel(atlas, x0, y0) * (1.f - wx) + texel(atlas, x0 + 1, y0) * wx;
+    float bottom = texel(atlas, x0, y0 + 1) * (1.f - wx) + texel(atlas, x0 + 1, y0 + 1) * wx;
+    return top * (1.f - wy) + bottom * wy;
+}
+
+static float smoothstep(float edge0, float edge1, float x)
+{
+    float t = (x - edge0) / (edge1 - edge0);
+    t = t < 0.f ? 0.f : (t > 1.f ? 1.f : t);
+    return t * t * (3.f - 2.f * t);
+}
+
+SoftwareRenderer::SoftwareRenderer(image& target, const image& numberAtlas, const image& textAtlas):
+    m_target(target),
+    m_numbers(numberAtlas),
+    m_text(textAtlas)
+{
+    assert(target.is_valid() && target.get_format() == image::fmt_rgba);
+    assert(numberAtlas.is_valid() && textAtlas.is_valid());
+}
+
+void SoftwareRenderer::drawQuads(OverlayAtlas atlas, const DrawNumberVertex* vertices, uint32_t quadCount)
+{
+    // the index pattern of DrawNumberTool::createIndexBuffer
+    for(uint32_t i = 0; i < quadCount; i ++, vertices += 4) {
+        drawTriangle(atlas, vertices[0], vertices[1], vertices[3]);
+        drawTriangle(atlas, vertices[0], vertices[3], vertices[2]);
+    }
+}
+
+void SoftwareRenderer::drawTriangle(OverlayAtlas atlas, const DrawNumberVertex& v0, const DrawNumberVertex& v1, const DrawNumberVertex& v2)
+{
+    const DrawNumberVertex* v[3] = { &v0, &v1, &v2 };
+    int64_t x[3];
+    int64_t y[3];
+    for(int i = 0; i < 3; i ++) {
+        x[i] = snapToSubpixel(v[i]->position[0]);
+        y[i] = snapToSubpixel(v[i]->position[1]);
+    }
+    int64_t area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+    if(area == 0)
+        return;
+    // culling is off, so either winding draws; turned so the inside is on the positive side of every edge
+    if(area < 0) {
+        const DrawNumberVertex* pv = v[1];
+        v[1] = v[2];
+        v[2] = pv;
+        int64_t t = x[1];
+        x[1] = x[2];
+        x[2] = t;
+        t = y[1];
+        y[1] = y[2];
+        y[2] = t;
+        area = -area;
+    }
+
+    // a pixel center on an edge belongs to the triangle if the edge is a top or a left one
+    int64_t bias[3];
+    for(int i = 0; i < 3; i ++) {
+        int j = (i + 1) % 3;
+        int64_t dx = x[j] - x[i];
+        int64_t dy = y[j] - y[i];
+        bool topLeft = dy < 0 || (dy == 0 && dx > 0);
+        bias[i] = topLeft ? 0 : -1;
+    }
+
+    // texture coordinates and color as planes over the snapped positions
+    const double scale = 1.0 / (double)(1 << g_subpixelBits);
+    double px[3];
+    double py[3];
+    for(int i = 0; i < 3; i ++) {
+        px[i] = (double)x[i] * scale;
+        py[i] = (double)y[i] * scale;
+    }
+    double det = (px[1] - px[0]) * (py[2] - py[0]) - (py[1] - py[0]) * (px[2] - px[0]);
+    AttributePlane planes[6];
+    for(int k = 0; k < 6; k ++) {
+        double f[3];
+        for(int i = 0; i < 3; i ++)
+            f[i] = k < 2 ? v[i]->tex[k] : v[i]->color[k - 2];
+        double dx = ((f[1] - f[0]) * (py[2] - py[0]) - (f[2] - f[0]) * (py[1] - py[0])) / det;
+        double dy = ((f[2] - f[0]) * (px[1] - px[0]) - (f[1] - f[0]) * (px[2] - px[0])) / det;
+        planes[k].a = (float)(f[0] - dx * px[0] - dy * py[0]);
+        planes[k].dx = (float)dx;
+        planes[k].dy = (float)dy;
+    }
+
+    int64_t minX = x[0] < x[1] ? x[0] : x[1];
+    int64_t maxX = x[0] > x[1] ? x[0] : x[1];
+    int64_t minY = y[0] < y[1] ? y[0] : y[1];
+    int64_t maxY = y[0] > y[1] ? y[0] : y[1];
+    minX = x[2] < minX ? x[2] : minX;
+    maxX = x[2] > maxX ? x[2] : maxX;
+    minY = y[2] < minY ? y[2] : minY;
+    maxY = y[2] > maxY ? y[2] : maxY;
+    int left = (int)(minX >> g_subpixelBits);
+    int right = (int)(maxX >> g_subpixelBits);
+    int top = (int)(minY >> g_subpixelBits);
+    int bottom = (int)(maxY >> g_subpixelBits);
+    left = left < 0 ? 0 : left;
+    top = top < 0 ? 0 : top;
+    right = right >= m_target.get_width() ? m_target.get_width() - 1 : right;
+    bottom = bottom >= m_target.get_height() ? m_target.get_height() - 1 : bottom;
+
+    const image& texture = atlas == oa_text ? m_text : m_numbers;
+    const int64_t half = 1 << (g_subpixelBits - 1);
+    for(int row = top; row <= bottom; row ++) {
+        int64_t cy = ((int64_t)row << g_subpixelBits) + half;
+        for(int column = left; column <= right; column ++) {
+            int64_t cx = ((int64_t)column << g_subpixelBits) + half;
+            bool inside = true;
+            for(int i = 0; i < 3 && inside; i ++) {
+                int j = (i + 1) % 3;
+                int64_t e = (x[j] - x[i]) * (cy - y[i]) - (y[j] - y[i]) * (cx - x[i]);
+                inside = e + bias[i] >= 0;
+            }
+            if(!inside)
+                continue;
+            float fx = (float)column + 0.5f;
+            float fy = (float)row + 0.5f;
+            float color[4];
+            for(int k = 0; k < 4; k ++)
+                color[k] = planes[2 + k].at(fx, fy);
+            float d = sampleAtlas(texture, planes[0].at(fx, fy), planes[1].at(fx, fy));
+            float alpha = d;
+            if(atlas == oa_text) {
+                // fine derivatives: differences along the row and the column of the pixel's 2x2 quad,
+                // helper pixels outside the triangle read the extrapolated coordinates
+                float qx = (float)(column & ~1) + 0.5f;
+                float qy = (float)(row & ~1) + 0.5f;
+                float ddx = sampleAtlas(texture, planes[0].at(qx + 1.f, fy), planes[1].at(qx + 1.f, fy)) -
+                    sampleAtlas(texture, planes[0].at(qx, fy), planes[1].at(qx, fy));
+                float ddy = sampleAtlas(texture, planes[0].at(fx, qy + 1.f), planes[1].at(fx, qy + 1.f)) -
+                    sampleAtlas(texture, planes[0].at(fx, qy), planes[1].at(fx, qy));
+                float w = fabsf(ddx) + fabsf(ddy);
+                w = w > 0.0001f ? w : 0.0001f;
+                alpha = smoothstep(0.5f - 0.5f * w, 0.5f + 0.5f * w, d);
+            }
+            blend(column, row, color, alpha);
+        }
+    }
+}
+
+void SoftwareRenderer::drawLineStrip(const float* points, uint32_t pointCount, const float color[4])
+{
+    for(uint32_t i = 1; i < pointCount; i ++)
+        drawLine(points[i * 2 - 2], points[i * 2 - 1], points[i * 2], points[i * 2 + 1], color);
+}
+
+void SoftwareRenderer::drawLine(float x0, float y0, float x1, float y1, const float color[4])
+{
+    // along the major axis, the pixels whose centers lie from the start up to but not including the end
+    bool xMajor = fabsf(x1 - x0) >= fabsf(y1 - y0);
+    float from = xMajor ? x0 : y0;
+    float to = xMajor ? x1 : y1;
+    if(from == to)
+        return;
+    float slope = xMajor ? (y1 - y0) / (x1 - x0) : (x1 - x0) / (y1 - y0);
+    float across = xMajor ? y0 : x0;
+    int first;
+    int last;
+    if(from < to) {
+        first = (int)ceilf(from - 0.5f);
+        last = (int)ceilf(to - 0.5f) - 1;
+    }
+    else {
+        first = (int)floorf(to - 0.5f) + 1;
+        last = (int)floorf(from - 0.5f);
+    }
+    for(int i = first; i <= last; i ++) {
+        float center = (float)i + 0.5f;
+        int j = (int)floorf(across + (center - from) * slope);
+        int px = xMajor ? i : j;
+        int py = xMajor ? j : i;
+        if(px >= 0 && py >= 0 && px < m_target.get_width() && py < m_target.get_height())
+            blend(px, py, color, color[3]);
+    }
+}
+
+void SoftwareRenderer::blend(int x, int y, const float color[4], float alpha)
+{
+    byte* pixel = m_target.get_data(x, y);
+    alpha = alpha < 0.f ? 0.f : (alpha > 1.f ? 1.f : alpha);
+    for(int c = 0; c < 4; c ++) {
+        float dst = (float)pixel[c] / 255.f;
+        float src = c < 3 ? color[c] : 1.f;
+        float value = src * alpha + dst * (1.f - alpha);
+        value = value < 0.f ? 0.f : (value > 1.f ? 1.f : value);
+        pixel[c] = (byte)(value * 255.f + 0.5f);
+    }
+}
+
+int countDifferences(const image& a, const image& b, int tolerance)
+{
+    if(!a.is_valid() || !b.is_valid() || a.get_format() != b.get_format() ||
+        a.get_width() != b.get_width() || a.get_height() != b.get_height())
+        return -1;
+    int pixelBytes = a.get_format() == image::fmt_rgba ? 4 : 1;
+    int count = 0;
+    for(int y = 0; y < a.get_height(); y ++) {
+        const byte* pa = a.get_data(0, y);
+        const byte* pb = b.get_data(0, y);
+        for(int x = 0; x < a.get_width(); x ++, pa += pixelBytes, pb += pixelBytes) {
+            bool differs = false;
+            for(int c = 0; c < pixelBytes; c ++)
+                differs = differs || abs((int)pa[c] - (int)pb[c]) > tolerance;
+            count += differs ? 1 : 0;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "OverlayRenderer.h"
+#include "readimage.h"
+
+/*
+ * The overlay rasterized on the CPU into an RGBA image, following what the
+ * D3D11 paths set up: vertices snapped to 1/256 pixel, triangles covering the
+ * pixel centers inside them with the top-left rule, attributes interpolated
+ * linearly (everything is 2D), bilinear filtering with clamped addressing and
+ * 8 bit weights, the DrawNumberPS and DrawTextPS shading with fwidth from
+ * fine derivatives over 2x2 pixel quads, and the blend of OverlayRenderer
+ * rounded to 8 bits. Lines light the pixel nearest to the line in each column
+ * or row they cross, close to the diamond exit rule without its corner cases.
+ * A GPU differs by a count or two where filtering or rounding precision
+ * differs, so comparisons take a tolerance. Pass the atlases decoded with
+ * decodeBC4 to see what a device sampling BC4 shows. Plain C++, for checking
+ * the overlay without a GPU.
+ */
+class SoftwareRenderer : public OverlayRenderer
+{
+public:
+    // target is fmt_rgba and drawn over as it is; the atlases are read from their first channel
+    SoftwareRenderer(image& target, const image& numberAtlas, const image& textAtlas);
+    void drawQuads(OverlayAtlas atlas, const DrawNumberVertex* vertices, uint32_t quadCount);
+    void drawLineStrip(const float* points, uint32_t pointCount, const float color[4]);
+
+private:
+    SoftwareRenderer(const SoftwareRenderer&);
+    void drawTriangle(OverlayAtlas atlas, const DrawNumberVertex& v0, const DrawNumberVertex& v1, const DrawNumberVertex& v2);
+    void drawLine(float x0, float y0, float x1, float y1, const float color[4]);
+    void blend(int x, int y, const float color[4], float alpha);
+
+private:
+    image&              m_target;
+    const image&        m_numbers;
+    const image&        m_text;
+};
+
+// pixels where a channel of a and b differs by more than tolerance, -1 when their size or format differs
+int countDifferences(const image& a, const image& b, int tolerance);
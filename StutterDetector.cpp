@@ -0,0 +1,104 @@
+#include "StutterDetector.h"
+#include <math.h>
+#include <string.h>
+
+static const double     g_hitchFactor = 2.5;
+static const double     g_hitchMinMs = 2.0;         /* 1ms -> 3ms at very high fps is not a visible hitch */
+static const double     g_ewmaWeight = 1.0 / 32.0;
+// CUSUM allowance and decision threshold, in standard deviations
+static const double     g_cusumDrift = 0.5;
+static const double     g_cusumLimit = 12.0;
+// one frame moves the CUSUM and the baseline by at most this many deviations, so a lone
+// long frame under the hitch threshold is not taken for a shift; a real one takes five frames
+static const double     g_residualClamp = 3.0;
+// floor of the deviation relative to the baseline, keeps the z score sane on very steady frames
+static const double     g_minRelativeDeviation = 0.03;
+
+StutterDetector::StutterDetector(uint64_t tickFrequency)
+{
+    m_msPerTick = 1000.0 / (double)tickFrequency;
+    reset();
+}
+
+void StutterDetector::reset()
+{
+    memset(m_ring, 0, sizeof(m_ring));
+    memset(m_sorted, 0, sizeof(m_sorted));
+    m_count = 0;
+    m_next = 0;
+    m_mean = 0.0;
+    m_variance = 0.0;
+    m_cusumHigh = 0.0;
+    m_cusumLow = 0.0;
+}
+
+double StutterDetector::deviationMs() const
+{
+    double floor = m_mean * g_minRelativeDeviation;
+    double dev = sqrt(m_variance);
+    return dev > floor ? dev : floor;
+}
+
+void StutterDetector::insert(double ms)
+{
+    // drop the value leaving the window from the sorted copy, then insert the new one in place
+    int n = m_count;
+    if(m_count == window_size) {
+        double old = m_ring[m_next];
+        int i = 0;
+        while(m_sorted[i] != old)
+            i ++;
+        memmove(m_sorted + i, m_sorted + i + 1, (n - i - 1) * sizeof(double));
+        n --;
+    }
+    else {
+        m_count ++;
+    }
+    int i = n;
+    while(i > 0 && m_sorted[i - 1] > ms) {
+        m_sorted[i] = m_sorted[i - 1];
+        i --;
+    }
+    m_sorted[i] = ms;
+    m_ring[m_next] = ms;
+    m_next = (m_next + 1) % window_size;
+}
+
+uint32_t StutterDetector::onFrame(uint64_t frameTicks, uint64_t blockedTicks)
+{
+    double ms = (double)frameTicks * m_msPerTick;
+    if(m_count < window_size) {
+        insert(ms);
+        if(m_count == window_size) {
+            m_mean = medianMs();
+            m_variance = 0.0;
+        }
+        return 0;
+    }
+
+    uint32_t events = 0;
+    double median = medianMs();
+    if(ms > median * g_hitchFactor && ms > median + g_hitchMinMs) {
+        events |= fe_hitch;
+    }
+    else {
+        double dev = deviationMs();
+        double z = (ms - m_mean) / dev;
+        z = z > g_residualClamp ? g_residualClamp : (z < -g_residualClamp ? -g_residualClamp : z);
+        m_cusumHigh = m_cusumHigh + z - g_cusumDrift > 0.0 ? m_cusumHigh + z - g_cusumDrift : 0.0;
+        m_cusumLow = m_cusumLow - z - g_cusumDrift > 0.0 ? m_cusumLow - z - g_cusumDrift : 0.0;
+        double delta = z * dev;
+        m_mean += g_ewmaWeight * delta;
+        m_variance = (1.0 - g_ewmaWeight) * (m_variance + g_ewmaWeight * delta * delta);
+        if(m_cusumHigh > g_cusumLimit || m_cusumLow > g_cusumLimit) {
+            events |= fe_level_shift;
+            // restart from the new level instead of letting the EWMA crawl towards it
+            m_cusumHigh = m_cusumLow = 0.0;
+            m_mean = ms;
+        }
+    }
+    insert(ms);
+    if(events && (double)blockedTicks * m_msPerTick > ms * 0.5)
+        events |= fe_present_bound;
+    return events;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h>
+#include "CaptureFormat.h"
+
+/*
+ * Streaming hitch and level-shift detection over frame times, constant work
+ * per frame. A frame is a hitch when it exceeds g_hitchFactor times the
+ * median of the last window_size frames (and the median by at least
+ * g_hitchMinMs). Frames that are not hitches feed an EWMA baseline and
+ * variance, and a two-sided CUSUM on the standardised residual, clamped to
+ * three deviations per frame, reports sustained shifts of the level, such as
+ * a heavier scene, which a single frame test misses.
+ */
+class StutterDetector
+{
+public:
+    explicit StutterDetector(uint64_t tickFrequency);
+    void reset();
+    // classifies one frame; returns FrameEvent bits, 0 for an ordinary frame
+    uint32_t onFrame(uint64_t frameTicks, uint64_t blockedTicks);
+
+    double medianMs() const { return m_count ? m_sorted[m_count / 2] : 0.0; }
+    double baselineMs() const { return m_mean; }
+    double deviationMs() const;
+
+private:
+    enum { window_size = 31 };
+
+    void insert(double ms);
+
+private:
+    double              m_msPerTick;
+    // ring of recent frame times plus the same values kept sorted for the median
+    double              m_ring[window_size];
+    double              m_sorted[window_size];
+    int                 m_count;
+    int                 m_next;
+    double              m_mean;
+    double              m_variance;
+    double              m_cusumHigh;
+    double              m_cusumLow;
+};
@@ -0,0 +1,219 @@
+#include "SwapChainStats.h"
+#include "Config.h"
+#include <string.h>
+
+// keeps a corner of the overlay on screen when the configured position is outside a small window
+static const float      g_overlayMargin = 16.f;
+
+static_assert((int)OverlayFrame::graph_capacity == (int)SwapChainStats::ring_size, "the recorded graph copies the whole frame time ring");
+static_assert((int)OverlayRecorder::queue_size >= (int)SwapChainRegistry::table_size, "every swapchain can wait for recording at once");
+
+SwapChainStats::SwapChainStats()
+    : detector(FrameClock::instance().frequency())
+{
+    reset(0, nullptr);
+}
+
+void SwapChainStats::reset(uint32_t newId, IDXGISwapChain* pSwapChain)
+{
+    id = newId;
+    frameCounter.reset();
+    detector.reset();
+    memset(frameUs, 0, sizeof(frameUs));
+    ringHead = 0;
+    frameCount = 0;
+    graph.release();
+    hud.release();
+    text.clear();
+    textBuffers.release();
+    widgets.clear();
+    widgetBuffers.release();
+    deferred.release();
+    memset(telemetry, 0, sizeof(telemetry));
+    telemetryHead = 0;
+    telemetryCount = 0;
+    width = 0;
+    height = 0;
+    lastPresentStart = 0;
+    lastPresentBlocked = 0;
+    lastHitchTick = 0;
+    lastHitchMs = 0;
+    if(pSwapChain)
+        updateSize(pSwapChain);
+}
+
+void SwapChainStats::updateSize(IDXGISwapChain* pSwapChain)
+{
+    DXGI_SWAP_CHAIN_DESC desc;
+    if(SUCCEEDED(pSwapChain->GetDesc(&desc))) {
+        width = desc.BufferDesc.Width;
+        height = desc.BufferDesc.Height;
+    }
+}
+
+void SwapChainStats::pushFrame(uint64_t frameTicks)
+{
+    uint64_t us = FrameClock::instance().toUs(frameTicks);
+    frameUs[ringHead] = us > 0xffffffff ? 0xffffffff : (uint32_t)us;
+    ringHead = (ringHead + 1) % ring_size;
+    frameCount ++;
+}
+
+void SwapChainStats::pushTelemetry()
+{
+    TelemetrySample& sample = telemetry[telemetryHead];
+    sample.fps = frameCounter.fps();
+    sample.maxFrameMs = frameCounter.maxFrameMs();
+    sample.p50Us = frameCounter.p50Us();
+    sample.p95Us = frameCounter.p95Us();
+    sample.p99Us = frameCounter.p99Us();
+    telemetryHead = (telemetryHead + 1) % telemetry_size;
+    if(telemetryCount < telemetry_size)
+        telemetryCount ++;
+}
+
+uint32_t SwapChainStats::copyTelemetry(TelemetrySample* samples) const
+{
+    uint32_t first = (telemetryHead + telemetry_size - telemetryCount) % telemetry_size;
+    for(uint32_t i = 0; i < telemetryCount; i ++)
+        samples[i] = telemetry[(first + i) % telemetry_size];
+    return telemetryCount;
+}
+
+void SwapChainStats::placeOverlay(const OverlayConfig& cfg, float& x, float& y) const
+{
+    x = cfg.overlayX;
+    y = cfg.overlayY;
+    if(width > g_overlayMargin && x > width - g_overlayMargin)
+        x = width - g_overlayMargin;
+    if(height > g_overlayMargin && y > height - g_overlayMargin)
+        y = height - g_overlayMargin;
+}
+
+SwapChainRegistry::SwapChainRegistry()
+{
+    for(int i = 0; i < table_size; i ++)
+        m_keys[i].store(key_empty, std::memory_order_relaxed);
+    m_primary.store(0, std::memory_order_relaxed);
+    m_active.store(0, std::memory_order_relaxed);
+    m_nextId.store(1, std::memory_order_relaxed);
+    InitializeCriticalSection(&m_primaryLock);
+}
+
+uint32_t SwapChainRegistry::slotOf(uintptr_t key)
+{
+    // Fibonacci hashing, the low bits of a heap pointer carry no information
+    return (uint32_t)((((uint64_t)key >> 4) * 0x9E3779B97F4A7C15ull) >> (64 - table_bits));
+}
+
+SwapChainStats* SwapChainRegistry::find(IDXGISwapChain* pSwapChain)
+{
+    uintptr_t key = (uintptr_t)pSwapChain;
+    uint32_t slot = slotOf(key);
+    for(int i = 0; i < table_size; i ++, slot = (slot + 1) & (table_size - 1)) {
+        uintptr_t k = m_keys[slot].load(std::memory_order_acquire);
+        if(k == key)
+            return &m_stats[slot];
+        if(k == key_empty)
+            return nullptr;
+    }
+    return nullptr;
+}
+
+SwapChainStats* SwapChainRegistry::acquire(IDXGISwapChain* pSwapChain)
+{
+    SwapChainStats* stats = find(pSwapChain);
+    if(stats)
+        return stats;
+    // a swapchain is only presented from one thread at a time, so only other keys compete for the slot
+    uintptr_t key = (uintptr_t)pSwapChain;
+    uint32_t slot = slotOf(key);
+    for(int i = 0; i < table_size; i ++, slot = (slot + 1) & (table_size - 1)) {
+        uintptr_t k = m_keys[slot].load(std::memory_order_relaxed);
+        if(k != key_empty && k != key_removed)
+            continue;
+        if(!m_keys[slot].compare_exchange_strong(k, key_busy, std::memory_order_acquire))
+            continue;
+        // lookups of other keys probe past a busy slot, and none finds this key before the stats are clean
+        m_stats[slot].reset(m_nextId.fetch_add(1, std::memory_order_relaxed), pSwapChain);
+        m_keys[slot].store(key, std::memory_order_release);
+        m_active.fetch_add(1, std::memory_order_relaxed);
+        uintptr_t none = 0;
+        m_primary.compare_exchange_strong(none, key, std::memory_order_acq_rel);
+        return &m_stats[slot];
+    }
+    return nullptr;
+}
+
+void SwapChainRegistry::remove(IDXGISwapChain* pSwapChain)
+{
+    uintptr_t key = (uintptr_t)pSwapChain;
+    uint32_t slot = slotOf(key);
+    for(int i = 0; i < table_size; i ++, slot = (slot + 1) & (table_size - 1)) {
+        uintptr_t k = m_keys[slot].load(std::memory_order_acquire);
+        if(k == key_empty)
+            return;
+        if(k != key)
+            continue;
+        // the swapchain is going, its overlay resources should not keep the device alive until the slot is reused;
+        // the recorder uses the swapchain without a reference, so it lets go of it before the list is dropped
+        SwapChainStats& stats = m_stats[slot];
+        stats.graph.release();
+        stats.hud.release();
+        stats.textBuffers.release();
+        stats.widgetBuffers.release();
+        OverlayRecorder::instance().drain(stats.deferred);
+        stats.deferred.release();
+        // a tombstone rather than empty keeps the probe chains of later keys intact
+        m_keys[slot].store(key_removed, std::memory_order_release);
+        m_active.fetch_sub(1, std::memory_order_relaxed);
+        m_primary.compare_exchange_strong(k, 0, std::memory_order_acq_rel);
+        return;
+    }
+}
+
+void SwapChainRegistry::onResize(IDXGISwapChain* pSwapChain)
+{
+    // a swapchain is not resized and presented at the same time, so this is the owning thread
+    SwapChainStats* stats = find(pSwapChain);
+    if(stats)
+        stats->updateSize(pSwapChain);
+}
+
+void SwapChainRegistry::updatePrimary(IDXGISwapChain* pSwapChain, const SwapChainStats& stats)
+{
+    uintptr_t key = (uintptr_t)pSwapChain;
+    uintptr_t primary = m_primary.load(std::memory_order_relaxed);
+    if(primary == key)
+        return;
+    if(primary != 0) {
+        const SwapChainStats* current = find((IDXGISwapChain*)primary);
+        const FrameClock& clock = FrameClock::instance();
+        // a swapchain that has not published for two seconds is no longer presenting
+        bool stale = !current || clock.now() - current->frameCounter.publishedTick() > 2 * clock.frequency();
+        // a quarter more frames to take over, so two similar swapchains do not trade places every second
+        if(!stale && stats.frameCounter.fps() * 4 <= current->frameCounter.fps() * 5)
+            return;
+    }
+    m_primary.compare_exchange_strong(primary, key, std::memory_order_acq_rel);
+}
+
+bool SwapChainRegistry::beginPrimaryFrame(IDXGISwapChain* pSwapChain)
+{
+    if(!isPrimary(pSwapChain))
+        return false;
+    // the previous primary may still be in the frame it began as primary; rather than wait for
+    // its Present this frame runs without the primary work, the next one gets it
+    if(!TryEnterCriticalSection(&m_primaryLock))
+        return false;
+    if(!isPrimary(pSwapChain)) {
+        LeaveCriticalSection(&m_primaryLock);
+        return false;
+    }
+    return true;
+}
+
+void SwapChainRegistry::endPrimaryFrame()
+{
+    LeaveCriticalSection(&m_primaryLock);
+}
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <Windows.h>
+#include <dxgi.h>
+#include <stdint.h>
+#include <atomic>
+#include "FrameClock.h"
+#include "StutterDetector.h"
+#include "QuantileEstimator.h"
+#include "DrawNumber.h"
+#include "TextLayout.h"
+#include "OverlayWidgets.h"
+#include "OverlayRecorder.h"
+#include "ControlProtocol.h"
+
+struct OverlayConfig;
+
+class AnimFrameCounter
+{
+public:
+    // the percentile window restarts this often, so it covers 4 to 8 seconds of frames
+    enum { quantile_rotate_seconds = 4 };
+
+    AnimFrameCounter()
+    {
+        reset();
+    }
+    void reset()
+    {
+        m_lastTick = 0xffffffffffffffff;
+        m_prevTick = 0;
+        m_maxFrameTicks = 0;
+        m_fpsCounter = 0;
+        m_fps.store(0, std::memory_order_relaxed);
+        m_publishedTick.store(0, std::memory_order_relaxed);
+        m_maxFrameMs = 0;
+        m_quantiles.reset();
+        m_publishCount = 0;
+        m_p50Us = 0;
+        m_p95Us = 0;
+        m_p99Us = 0;
+    }
+    // returns true when a new one second figure was published
+    bool onFrameStart()
+    {
+        const FrameClock& clock = FrameClock::instance();
+        uint64_t now = clock.now();
+        if(m_lastTick == 0xffffffffffffffff)
+        {
+            m_lastTick = now;
+            m_prevTick = now;
+            m_fpsCounter = 0;
+            m_publishedTick.store(now, std::memory_order_relaxed);
+            return false;
+        }
+        m_fpsCounter ++;
+        uint64_t frameTicks = now - m_prevTick;
+        if(frameTicks > m_maxFrameTicks)
+            m_maxFrameTicks = frameTicks;
+        m_quantiles.add((double)clock.toUs(frameTicks));
+        m_prevTick = now;
+        if(clock.toNs(now - m_lastTick) >= 1000000000ull)
+        {
+            m_fps.store(m_fpsCounter, std::memory_order_relaxed);
+            m_publishedTick.store(now, std::memory_order_relaxed);
+            m_maxFrameMs = (int)((clock.toUs(m_maxFrameTicks) + 500) / 1000);
+            m_p50Us = (uint32_t)m_quantiles.value(FrameQuantiles::q_p50);
+            m_p95Us = (uint32_t)m_quantiles.value(FrameQuantiles::q_p95);
+            m_p99Us = (uint32_t)m_quantiles.value(FrameQuantiles::q_p99);
+            if(++ m_publishCount % quantile_rotate_seconds == 0)
+                m_quantiles.rotate();
+            m_lastTick = now;
+            m_maxFrameTicks = 0;
+            m_fpsCounter = 0;
+            return true;
+        }
+        return false;
+    }
+    // readable from other threads, for choosing the primary swapchain
+    int fps() const { return m_fps.load(std::memory_order_relaxed); }
+    uint64_t publishedTick() const { return m_publishedTick.load(std::memory_order_relaxed); }
+    int maxFrameMs() const { return m_maxFrameMs; }
+    // streaming frame time percentiles, published with the fps
+    uint32_t p50Us() const { return m_p50Us; }
+    uint32_t p95Us() const { return m_p95Us; }
+    uint32_t p99Us() const { return m_p99Us; }
+
+protected:
+    uint64_t					m_lastTick;
+    uint64_t					m_prevTick;
+    uint64_t					m_maxFrameTicks;
+    int						    m_fpsCounter;
+    std::atomic<int>            m_fps;
+    std::atomic<uint64_t>       m_publishedTick;
+    int                         m_maxFrameMs;
+    FrameQuantiles              m_quantiles;
+    uint32_t                    m_publishCount;
+    uint32_t                    m_p50Us;
+    uint32_t                    m_p95Us;
+    uint32_t                    m_p99Us;
+};
+
+/*
+ * Everything the hook tracks for one swapchain. Only the thread presenting
+ * the swapchain writes it, other threads at most read the published fps.
+ */
+struct SwapChainStats
+{
+    enum { ring_size = 128, telemetry_size = TELEMETRY_SAMPLES };
+
+    SwapChainStats();
+    void reset(uint32_t newId, IDXGISwapChain* pSwapChain);
+    // back buffer size, read on registration and after each resize rather than every frame
+    void updateSize(IDXGISwapChain* pSwapChain);
+    // frame time of the frame ending at this Present, in the ring
+    void pushFrame(uint64_t frameTicks);
+    // appends the figures AnimFrameCounter just published to the telemetry ring
+    void pushTelemetry();
+    // the telemetry ring oldest first, returns the number of samples in it
+    uint32_t copyTelemetry(TelemetrySample* samples) const;
+    // overlay origin for the configured position, kept inside this swapchain's back buffer
+    void placeOverlay(const OverlayConfig& cfg, float& x, float& y) const;
+
+    uint32_t                    id;                 /* 1, 2, ... in order of first Present */
+    AnimFrameCounter            frameCounter;
+    StutterDetector             detector;
+    uint32_t                    frameUs[ring_size];
+    uint32_t                    ringHead;           /* next slot of frameUs to write */
+    uint64_t                    frameCount;         /* frames pushed since registration */
+    FrameGraphRing              graph;
+    HudComposite                hud;
+    TextBatch                   text;               /* overlay labels, refilled every frame */
+    QuadBuffers                 textBuffers;
+    WidgetTree                  widgets;            /* the overlay rows with overlay_compose = 0 */
+    WidgetBuffers               widgetBuffers;
+    DeferredOverlay             deferred;           /* overlay_deferred recording */
+    TelemetrySample             telemetry[telemetry_size];  /* the last minute, one sample per second */
+    uint32_t                    telemetryHead;
+    uint32_t                    telemetryCount;
+    UINT                        width;
+    UINT                        height;
+    uint64_t                    lastPresentStart;
+    uint64_t                    lastPresentBlocked;
+    uint64_t                    lastHitchTick;
+    int                         lastHitchMs;
+};
+
+/*
+ * Swapchain -> stats map for processes that present more than one swapchain.
+ * Open addressing with linear probing over a fixed table, keyed by the
+ * swapchain pointer. Keys are atomics claimed with a CAS, so lookups from
+ * concurrent Present calls never lock; a slot is freed (tombstoned) when the
+ * detoured Release is about to drop the last reference.
+ *
+ * One swapchain is primary: captures, benchmarks, the frame limiter and the
+ * latency mode follow it. It is the first swapchain seen, and is taken over
+ * by a swapchain presenting at a clearly higher rate, or when it is released
+ * or has stopped presenting. The process wide state behind it belongs to
+ * one thread at a time: a Present does the primary work only while it holds
+ * the primary frame, so a takeover in the middle of the old primary's frame
+ * takes effect with the new primary's first frame after that one.
+ */
+class SwapChainRegistry
+{
+public:
+    enum
+    {
+        table_bits = 4,
+        table_size = 1 << table_bits,
+    };
+
+    static SwapChainRegistry& instance()
+    {
+        static SwapChainRegistry inst;
+        return inst;
+    }
+    // stats of pSwapChain, registered on its first call; nullptr when the table is full
+    SwapChainStats* acquire(IDXGISwapChain* pSwapChain);
+    SwapChainStats* find(IDXGISwapChain* pSwapChain);
+    void remove(IDXGISwapChain* pSwapChain);
+    // from the ResizeBuffers / ResizeTarget detours, after the resize succeeded
+    void onResize(IDXGISwapChain* pSwapChain);
+    // call when the swapchain published a new fps figure
+    void updatePrimary(IDXGISwapChain* pSwapChain, const SwapChainStats& stats);
+    bool isPrimary(IDXGISwapChain* pSwapChain) const { return m_primary.load(std::memory_order_acquire) == (uintptr_t)pSwapChain; }
+    // true when pSwapChain is primary and no other thread is still in a primary frame; pair with endPrimaryFrame
+    bool beginPrimaryFrame(IDXGISwapChain* pSwapChain);
+    void endPrimaryFrame();
+    int activeCount() const { return m_active.load(std::memory_order_relaxed); }
+
+private:
+    SwapChainRegistry();
+    SwapChainRegistry(const SwapChainRegistry&);
+    static uint32_t slotOf(uintptr_t key);
+
+private:
+    enum
+    {
+        key_empty = 0,
+        key_removed = 1,
+        key_busy = 2,                   /* claimed, the stats are being reset before the key is published */
+    };
+    std::atomic<uintptr_t>      m_keys[table_size];
+    SwapChainStats              m_stats[table_size];
+    std::atomic<uintptr_t>      m_primary;
+    CRITICAL_SECTION            m_primaryLock;
+    std::atomic<int>            m_active;
+    std::atomic<uint32_t>       m_nextId;
+};
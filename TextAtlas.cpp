@@ -0,0 +1,674 @@
+#include "TextAtlas.h"
+
+const float            g_textAtlasLineHeight = 29.f;
+const int              g_textAtlasWidth = 256;
+const int              g_textAtlasHeight = 256;
+
+const TextGlyph        g_textGlyphs[text_glyph_count] =
+{
+    {   2,   2,  0,  0,  0,  0,  8.00f },   // space
+    {   4,   2,  3, 18,  3,  5, 10.00f },   // !
+    {   9,   2,  7,  7,  2,  5, 11.00f },   // "
+    {  18,   2, 18, 18,  1,  5, 20.00f },   // #
+    {  38,   2, 12, 22,  2,  5, 15.00f },   // $
+    {  52,   2, 21, 18,  1,  5, 23.00f },   // %
+    {  75,   2, 17, 18,  1,  5, 19.00f },   // &
+    {  94,   2,  3,  7,  2,  5,  7.00f },   // '
+    {  99,   2,  6, 21,  2,  5,  9.00f },   // (
+    { 107,   2,  7, 21,  1,  5,  9.00f },   // )
+    { 116,   2, 12, 10,  0,  5, 12.00f },   // *
+    { 130,   2, 16, 16,  2,  7, 20.00f },   // +
+    { 148,   2,  5,  6,  1, 20,  8.00f },   // ,
+    { 155,   2,  7,  2,  1, 15,  9.00f },   // -
+    { 164,   2,  4,  3,  2, 20,  8.00f },   // .
+    { 170,   2,  9, 20,  0,  5,  8.00f },   // /
+    { 181,   2, 13, 18,  1,  5, 15.00f },   // 0
+    { 196,   2, 12, 18,  2,  5, 15.00f },   // 1
+    { 210,   2, 12, 18,  1,  5, 15.00f },   // 2
+    { 224,   2, 13, 18,  1,  5, 15.00f },   // 3
+    { 239,   2, 13, 18,  1,  5, 15.00f },   // 4
+    {   2,  26, 13, 18,  1,  5, 15.00f },   // 5
+    {  17,  26, 13, 18,  1,  5, 15.00f },   // 6
+    {  32,  26, 13, 18,  1,  5, 15.00f },   // 7
+    {  47,  26, 13, 18,  1,  5, 15.00f },   // 8
+    {  62,  26, 13, 18,  1,  5, 15.00f },   // 9
+    {  77,  26,  4, 12,  2, 11,  8.00f },   // :
+    {  83,  26,  5, 15,  1, 11,  8.00f },   // ;
+    {  90,  26, 16, 13,  2,  9, 20.00f },   // <
+    { 108,  26, 16,  7,  2, 12, 20.00f },   // =
+    { 126,  26, 16, 13,  2,  9, 20.00f },   // >
+    { 144,  26, 11, 18,  1,  5, 13.00f },   // ?
+    { 157,  26, 22, 21,  1,  6, 24.00f },   // @
+    { 181,  26, 17, 18,  0,  5, 16.00f },   // A
+    { 200,  26, 13, 18,  2,  5, 16.00f },   // B
+    { 215,  26, 15, 18,  1,  5, 17.00f },   // C
+    { 232,  26, 16, 18,  2,  5, 18.00f },   // D
+    {   2,  49, 12, 18,  2,  5, 15.00f },   // E
+    {  16,  49, 11, 18,  2,  5, 14.00f },   // F
+    {  29,  49, 16, 18,  1,  5, 19.00f },   // G
+    {  47,  49, 14, 18,  2,  5, 18.00f },   // H
+    {  63,  49,  3, 18,  2,  5,  7.00f },   // I
+    {  68,  49,  7, 23, -2,  5,  7.00f },   // J
+    {  77,  49, 15, 18,  2,  5, 16.00f },   // K
+    {  94,  49, 12, 18,  2,  5, 13.00f },   // L
+    { 108,  49, 17, 18,  2,  5, 21.00f },   // M
+    { 127,  49, 14, 18,  2,  5, 18.00f },   // N
+    { 143,  49, 17, 18,  1,  5, 19.00f },   // O
+    { 162,  49, 12, 18,  2,  5, 14.00f },   // P
+    { 176,  49, 17, 21,  1,  5, 19.00f },   // Q
+    { 195,  49, 14, 18,  2,  5, 17.00f },   // R
+    { 211,  49, 13, 18,  1,  5, 15.00f },   // S
+    { 226,  49, 16, 18, -1,  5, 15.00f },   // T
+    {   2,  74, 14, 18,  2,  5, 18.00f },   // U
+    {  18,  74, 17, 18,  0,  5, 16.00f },   // V
+    {  37,  74, 23, 18,  0,  5, 24.00f },   // W
+    {  62,  74, 16, 18,  0,  5, 16.00f },   // X
+    {  80,  74, 15, 18,  0,  5, 15.00f },   // Y
+    {  97,  74, 15, 18,  1,  5, 16.00f },   // Z
+    { 114,  74,  6, 21,  2,  5,  9.00f },   // [
+    { 122,  74,  9, 20,  0,  5,  8.00f },   // backslash
+    { 133,  74,  6, 21,  2,  5,  9.00f },   // ]
+    { 141,  74, 16,  7,  2,  5, 20.00f },   // ^
+    { 159,  74, 14,  2, -1, 27, 12.00f },   // _
+    { 175,  74,  6,  4,  2,  4, 12.00f },   // `
+    { 183,  74, 12, 13,  1, 10, 15.00f },   // a
+    { 197,  74, 12, 18,  2,  5, 15.00f },   // b
+    { 211,  74, 11, 13,  1, 10, 13.00f },   // c
+    { 224,  74, 13, 18,  1,  5, 15.00f },   // d
+    { 239,  74, 13, 13,  1, 10, 15.00f },   // e
+    {   2,  97,  9, 18,  0,  5,  8.00f },   // f
+    {  13,  97, 13, 18,  1, 10, 15.00f },   // g
+    {  28,  97, 12, 18,  2,  5, 15.00f },   // h
+    {  42,  97,  3, 18,  2,  5,  7.00f },   // i
+    {  47,  97,  6, 23, -1,  5,  7.00f },   // j
+    {  55,  97, 12, 18,  2,  5, 14.00f },   // k
+    {  69,  97,  3, 18,  2,  5,  7.00f },   // l
+    {  74,  97, 20, 13,  2, 10, 23.00f },   // m
+    {  96,  97, 12, 13,  2, 10, 15.00f },   // n
+    { 110,  97, 13, 13,  1, 10, 15.00f },   // o
+    { 125,  97, 12, 18,  2, 10, 15.00f },   // p
+    { 139,  97, 13, 18,  1, 10, 15.00f },   // q
+    { 154,  97,  8, 13,  2, 10, 10.00f },   // r
+    { 164,  97, 11, 13,  1, 10, 13.00f },   // s
+    { 177,  97,  9, 17,  0,  6,  9.00f },   // t
+    { 188,  97, 12, 13,  2, 10, 15.00f },   // u
+    { 202,  97, 14, 13,  0, 10, 14.00f },   // v
+    { 218,  97, 18, 13,  1, 10, 20.00f },   // w
+    { 238,  97, 14, 13,  0, 10, 14.00f },   // x
+    {   2, 122, 14, 18,  0, 10, 14.00f },   // y
+    {  18, 122, 11, 13,  1, 10, 13.00f },   // z
+    {  31, 122, 10, 22,  3,  5, 15.00f },   // {
+    {  43, 122,  3, 24,  3,  5,  8.00f },   // |
+    {  48, 122, 10, 22,  3,  5, 15.00f },   // }
+    {  60, 122, 16,  5,  2, 13, 20.00f },   // ~
+};
+
+const uint8_t          g_textAtlasSource[] =
+{
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x79, 0x19, 0xf7,
+    0xba, 0x00, 0x00, 0x23, 0x06, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0x5d, 0x67, 0x60, 0x55,
+    0x45, 0x1a, 0x3d, 0x2f, 0x3d, 0x21, 0x8d, 0x1e, 0x20, 0x34, 0xe9, 0x45, 0x40, 0x40, 0xa5, 0x4b,
+    0x09, 0x52, 0xa4, 0x2c, 0x1d, 0xa4, 0x09, 0x52, 0x04, 0x82, 0x20, 0xa0, 0xac, 0x4b, 0x97, 0xe2,
+    0x82, 0xe0, 0x02, 0x02, 0x6a, 0x68, 0x2a, 0xa1, 0x57, 0x15, 0x04, 0x24, 0x48, 0x93, 0x8e, 0x1a,
+    0x6a, 0x42, 0x13, 0x08, 0x09, 0x09, 0x21, 0x40, 0x7a, 0xf2, 0xf2, 0xca, 0xd9, 0x1f, 0x73, 0xdb,
+    0x7b, 0x79, 0x2f, 0x10, 0xd8, 0xb5, 0xc0, 0x3d, 0x7f, 0x72, 0x67, 0xee, 0xdc, 0x76, 0x32, 0xf3,
+    0xcd, 0x37, 0x67, 0xbe, 0x99, 0x07, 0xe8, 0xd0, 0x81, 0xb7, 0x48, 0x60, 0x07, 0x3b, 0x20, 0x84,
+    0x11, 0x4a, 0xe6, 0x4c, 0x0e, 0x01, 0x6a, 0x72, 0xa7, 0x92, 0x11, 0xc8, 0x60, 0xf9, 0xd0, 0xf3,
+    0xe3, 0xdb, 0xd9, 0xe7, 0xfa, 0x48, 0x89, 0x01, 0x9c, 0xa1, 0xde, 0xaa, 0xf5, 0xde, 0x87, 0x19,
+    0x97, 0xbe, 0x6e, 0x61, 0x90, 0x92, 0x3b, 0xd8, 0x01, 0x00, 0xb0, 0xd7, 0x5a, 0x0b, 0x30, 0x44,
+    0x66, 0x96, 0x56, 0x4b, 0x6e, 0xd9, 0x62, 0xfb, 0x12, 0x49, 0xf4, 0x55, 0x8e, 0xeb, 0x90, 0x6d,
+    0x81, 0x0b, 0x24, 0xc9, 0xc9, 0xc0, 0x58, 0x2a, 0xe7, 0x0a, 0x9b, 0x93, 0x5c, 0x01, 0x00, 0xa5,
+    0x97, 0xdd, 0xc8, 0x4e, 0xd8, 0xda, 0x10, 0x00, 0xe0, 0x5a, 0xff, 0xbd, 0x6d, 0x89, 0x64, 0x1d,
+    0xa9, 0x4c, 0xcd, 0x09, 0xbb, 0xaf, 0x64, 0xa4, 0x9f, 0x9f, 0x5f, 0x06, 0x00, 0x10, 0xd0, 0xf3,
+    0x9b, 0xb3, 0x0f, 0x8c, 0xb7, 0xd6, 0x35, 0xd1, 0x3c, 0xcb, 0xe3, 0x12, 0x19, 0xfa, 0x28, 0x02,
+    0x0e, 0xb0, 0x32, 0x30, 0x8a, 0x1f, 0x38, 0x22, 0x60, 0x63, 0x76, 0xfb, 0x02, 0xf3, 0xf8, 0x96,
+    0xc8, 0xbe, 0x7b, 0xdd, 0x4b, 0x29, 0x13, 0x6a, 0x25, 0x49, 0xb2, 0xa6, 0x2d, 0x01, 0x1d, 0xb8,
+    0x01, 0x00, 0x3a, 0x72, 0xdd, 0xd3, 0x12, 0x30, 0x80, 0xdf, 0x00, 0x00, 0x5e, 0x7d, 0x48, 0x92,
+    0x34, 0x0f, 0x03, 0x80, 0x7e, 0xe2, 0xa1, 0x12, 0x01, 0xe5, 0x28, 0x21, 0xb5, 0x3d, 0x00, 0x84,
+    0xcb, 0xc9, 0xd9, 0xea, 0xb3, 0xa6, 0xf0, 0xd1, 0x04, 0xb8, 0x67, 0xc6, 0x03, 0xd8, 0xc4, 0x57,
+    0x1d, 0x10, 0xd0, 0x90, 0x2b, 0x01, 0xd7, 0xf8, 0x7b, 0x9e, 0x00, 0xb0, 0x94, 0xed, 0x95, 0x22,
+    0xa5, 0x8c, 0x8c, 0xa8, 0xed, 0x59, 0xfa, 0xad, 0x83, 0xd5, 0x6d, 0x08, 0x70, 0xbd, 0x6c, 0xad,
+    0x02, 0x00, 0x38, 0xc5, 0x57, 0x00, 0xc0, 0xff, 0xe4, 0x08, 0x77, 0x6c, 0xd9, 0x02, 0xf7, 0x11,
+    0x27, 0xfc, 0x1d, 0x12, 0xd0, 0x8e, 0xd9, 0xa5, 0x34, 0xef, 0xa7, 0x21, 0x60, 0x0b, 0xbb, 0x03,
+    0x80, 0x5f, 0x3c, 0x2f, 0x35, 0xf5, 0xaa, 0xbc, 0x99, 0xe6, 0xfa, 0x00, 0x7a, 0x9f, 0xf9, 0x4f,
+    0xd7, 0xa6, 0x0a, 0x01, 0x65, 0xcf, 0xcf, 0x7b, 0xbd, 0x92, 0x4f, 0xc9, 0x01, 0xf1, 0xcc, 0x2c,
+    0x07, 0x60, 0xd1, 0xf2, 0xee, 0x35, 0x7c, 0x8b, 0xb4, 0x3c, 0x4c, 0xf6, 0x90, 0xef, 0x57, 0x29,
+    0xeb, 0x72, 0xf2, 0x23, 0x09, 0x68, 0xc8, 0x8d, 0x00, 0x12, 0xd2, 0xdd, 0x44, 0xd2, 0x77, 0xe2,
+    0xf1, 0x14, 0x66, 0x46, 0x7e, 0xd9, 0xdc, 0x05, 0xc0, 0x6c, 0x76, 0x07, 0xb0, 0x8a, 0xaf, 0x01,
+    0xa8, 0x67, 0xd9, 0xae, 0xde, 0x68, 0x28, 0x1f, 0xf8, 0xda, 0xfc, 0x5b, 0x05, 0x01, 0x5d, 0x78,
+    0x50, 0x3e, 0xbf, 0x11, 0x00, 0xdc, 0x07, 0x5f, 0xbe, 0xde, 0x77, 0xdb, 0xb6, 0xbe, 0xd7, 0xa3,
+    0x07, 0xbb, 0x3b, 0x24, 0xe0, 0xdf, 0x5c, 0xe6, 0xb8, 0xb1, 0x7a, 0xa4, 0x1a, 0xfd, 0x00, 0x60,
+    0x32, 0xd3, 0x4a, 0x03, 0x70, 0x39, 0xce, 0xbd, 0xd2, 0x99, 0xaa, 0x6a, 0x13, 0x90, 0x50, 0x2b,
+    0x9b, 0x73, 0xd5, 0x94, 0xd7, 0x45, 0xfe, 0x24, 0x1f, 0xef, 0x67, 0xeb, 0xa4, 0x47, 0x12, 0xf0,
+    0x01, 0x47, 0x01, 0x55, 0xb9, 0x4f, 0xa4, 0x82, 0x2e, 0xcb, 0x15, 0xa9, 0x01, 0x80, 0x70, 0x36,
+    0x06, 0x30, 0x93, 0x03, 0x01, 0x97, 0x53, 0x19, 0x65, 0xd4, 0x1b, 0xfd, 0x8b, 0xc7, 0xe0, 0x80,
+    0x80, 0x08, 0x0e, 0x12, 0xc9, 0x80, 0xac, 0x9c, 0x12, 0x00, 0x00, 0x97, 0xee, 0x67, 0xac, 0xd6,
+    0x33, 0xdd, 0x5d, 0x9c, 0x34, 0x81, 0xe3, 0x39, 0x65, 0x1c, 0x13, 0xd0, 0x96, 0x7b, 0x00, 0x00,
+    0x51, 0x12, 0x43, 0x9d, 0x69, 0x29, 0xe6, 0x8c, 0x00, 0xfc, 0xc4, 0x1f, 0x35, 0xa9, 0x39, 0xbc,
+    0x23, 0x1d, 0x0d, 0xe4, 0x46, 0x28, 0x04, 0xb8, 0x38, 0x7a, 0x4c, 0x24, 0xc9, 0xb9, 0x58, 0x42,
+    0x46, 0x21, 0x84, 0x64, 0x08, 0x30, 0xb7, 0xf2, 0xfd, 0xc1, 0x95, 0x50, 0xa3, 0xfe, 0xf0, 0x43,
+    0x16, 0x00, 0x06, 0x10, 0x80, 0x01, 0x00, 0x86, 0xbd, 0x3c, 0x33, 0x46, 0xbd, 0xf0, 0x3a, 0x6a,
+    0xf8, 0xe5, 0xbe, 0x5d, 0xe9, 0x56, 0x56, 0xa9, 0x96, 0xa4, 0xec, 0x73, 0xef, 0x0b, 0x00, 0xa0,
+    0x15, 0x00, 0xad, 0x74, 0xfc, 0x99, 0x3e, 0xf5, 0xbe, 0x8a, 0x71, 0x7c, 0xa6, 0x13, 0xbe, 0x03,
+    0x80, 0xa0, 0xaa, 0xd8, 0x0d, 0x00, 0x88, 0x30, 0xbb, 0x34, 0x77, 0x6a, 0xdb, 0xef, 0xda, 0x7c,
+    0x9d, 0x09, 0xc9, 0x92, 0x1d, 0x9d, 0x9f, 0xf6, 0x9e, 0x9a, 0xed, 0xf2, 0x78, 0xfd, 0xc4, 0x1b,
+    0x78, 0x77, 0x75, 0x12, 0x52, 0x7f, 0x09, 0x6b, 0x7e, 0x1a, 0xc0, 0x4d, 0x94, 0x00, 0x50, 0x02,
+    0x37, 0x51, 0x74, 0x4e, 0xf4, 0x02, 0x4d, 0xb1, 0x9d, 0xf7, 0xfd, 0x17, 0xe5, 0xbe, 0xb8, 0x25,
+    0xa2, 0x92, 0xe5, 0x7f, 0x2d, 0x5a, 0x01, 0x70, 0x1b, 0x78, 0xe9, 0x93, 0x85, 0x3b, 0x76, 0x2c,
+    0xfa, 0xe4, 0xe2, 0x40, 0x37, 0x47, 0x4f, 0xcb, 0xf4, 0x18, 0xe6, 0xe4, 0x3d, 0x3a, 0xe0, 0x7b,
+    0x00, 0xa8, 0x0e, 0x5c, 0x00, 0x00, 0x64, 0xdc, 0x40, 0x75, 0x67, 0xef, 0xec, 0xd2, 0x08, 0xe7,
+    0xd5, 0x94, 0xdb, 0x1b, 0x38, 0x20, 0x8e, 0x16, 0x14, 0x99, 0x76, 0xc7, 0xae, 0xe8, 0x40, 0xe6,
+    0xfa, 0x57, 0x88, 0xca, 0x7f, 0xd5, 0x2c, 0x55, 0x4b, 0x23, 0x5f, 0xd1, 0x18, 0xc1, 0xc6, 0x0c,
+    0x03, 0x0c, 0xb7, 0xef, 0x7b, 0x61, 0x35, 0x5b, 0xd8, 0x5c, 0xf6, 0x1f, 0xf2, 0xc3, 0x5c, 0x6f,
+    0xb2, 0x8a, 0x2b, 0xe4, 0xc3, 0x16, 0x4c, 0x73, 0x03, 0x02, 0x4e, 0x8d, 0x14, 0x46, 0x70, 0xe4,
+    0x29, 0x7f, 0x60, 0x02, 0x6d, 0xb0, 0x30, 0x8f, 0xff, 0x43, 0x5d, 0xfe, 0x0a, 0x00, 0xe8, 0x4b,
+    0x7a, 0xc8, 0x7d, 0xd5, 0x97, 0xce, 0x9a, 0xc0, 0x70, 0x5a, 0x6a, 0xc9, 0xc7, 0x01, 0x0d, 0x77,
+    0xf2, 0x56, 0x09, 0xe9, 0x15, 0xce, 0xba, 0x01, 0xb6, 0x36, 0xa0, 0x07, 0x33, 0xec, 0x1f, 0x35,
+    0x9c, 0x93, 0x81, 0x20, 0x9e, 0x96, 0x92, 0xa7, 0xf9, 0x8d, 0xbb, 0xa6, 0x1b, 0xdc, 0x92, 0xd5,
+    0xd6, 0x67, 0x36, 0x87, 0xa0, 0xb1, 0x75, 0x2d, 0x5c, 0xa7, 0xdc, 0x30, 0x46, 0xbf, 0x23, 0xf2,
+    0x27, 0x5a, 0x49, 0x4e, 0xb5, 0xbf, 0xd7, 0x31, 0x4e, 0x96, 0x0f, 0xcb, 0x93, 0xe5, 0xec, 0xbb,
+    0xc1, 0x7c, 0x10, 0x30, 0x9d, 0xd3, 0x01, 0x00, 0xc3, 0x68, 0x96, 0x72, 0x76, 0x71, 0xad, 0x13,
+    0x02, 0x6a, 0xa6, 0x73, 0xb1, 0x38, 0xaa, 0x48, 0x92, 0xc6, 0xb0, 0x92, 0xc2, 0x85, 0xb9, 0x6c,
+    0x6d, 0x04, 0x7b, 0x02, 0x5e, 0x67, 0xbc, 0xfd, 0xa3, 0xd6, 0xb1, 0x29, 0xd0, 0x83, 0x9f, 0xca,
+    0xfe, 0x8d, 0x89, 0xb7, 0xd7, 0xb0, 0x83, 0x8f, 0x6c, 0x52, 0xe7, 0xc6, 0x19, 0x2f, 0xf4, 0x83,
+    0xdb, 0xd9, 0x94, 0x20, 0x7c, 0x61, 0xe9, 0xe3, 0x3d, 0x9e, 0xef, 0x8b, 0x4e, 0x3a, 0xbb, 0xf3,
+    0x62, 0xf2, 0x63, 0x00, 0x28, 0x46, 0x06, 0x4a, 0xa5, 0xaf, 0x72, 0x84, 0x7c, 0x5b, 0x7f, 0x8a,
+    0x8e, 0xf0, 0x11, 0x7e, 0x80, 0x33, 0xfc, 0xca, 0xba, 0xd2, 0xbf, 0xc7, 0xf4, 0x28, 0x02, 0x4a,
+    0xfe, 0xce, 0x93, 0x9e, 0x1a, 0x02, 0x18, 0x29, 0x1c, 0xb7, 0x8f, 0xb8, 0x12, 0xb9, 0x08, 0x78,
+    0x95, 0x97, 0xed, 0x1f, 0x15, 0x9b, 0xe5, 0x09, 0x2c, 0x66, 0x57, 0x39, 0xdd, 0x60, 0xbf, 0x95,
+    0x64, 0xf6, 0xf7, 0x8d, 0xb5, 0x85, 0xc6, 0xf1, 0x5d, 0x54, 0xe7, 0xb7, 0x00, 0xce, 0x66, 0x16,
+    0x04, 0x0a, 0xdc, 0x67, 0x28, 0x30, 0x95, 0x5c, 0x64, 0x00, 0x5a, 0x33, 0x4a, 0x2e, 0x96, 0xc8,
+    0x7e, 0xf2, 0xa1, 0x81, 0x7c, 0xdd, 0xc9, 0xc7, 0x3d, 0x06, 0x01, 0xc1, 0xbc, 0x8d, 0xc7, 0x6c,
+    0x02, 0x45, 0x2e, 0xf2, 0x5c, 0x21, 0x35, 0x59, 0xe8, 0xe5, 0x2f, 0x2d, 0x9c, 0x00, 0xa0, 0xaa,
+    0xf1, 0x7e, 0x91, 0xdc, 0x04, 0x54, 0x55, 0xaa, 0xba, 0x4a, 0x98, 0x82, 0x24, 0x29, 0xbb, 0xf8,
+    0x9b, 0x3c, 0x9c, 0x4a, 0xeb, 0x3b, 0x1a, 0x92, 0x53, 0x7f, 0x73, 0xc5, 0x04, 0xbe, 0x03, 0x60,
+    0x2e, 0xbb, 0x01, 0xdd, 0xf8, 0xc0, 0x1d, 0xc0, 0x08, 0x0b, 0xc3, 0x5c, 0x10, 0xc6, 0x29, 0x72,
+    0xb9, 0x2b, 0x1c, 0xa9, 0xb4, 0x45, 0xf2, 0xe5, 0x27, 0x27, 0x60, 0xa4, 0xec, 0x1e, 0xb4, 0x24,
+    0xcb, 0xcb, 0xf7, 0x9e, 0xee, 0x88, 0x80, 0x82, 0xbf, 0xf1, 0x72, 0x71, 0xdb, 0x8b, 0xdf, 0x63,
+    0x66, 0x11, 0xe0, 0x07, 0x0e, 0x45, 0x6e, 0x02, 0x6c, 0xe1, 0x84, 0x00, 0x04, 0x32, 0xb8, 0xc0,
+    0x67, 0xcc, 0x0a, 0x54, 0x0a, 0x6e, 0xb4, 0x36, 0x04, 0x96, 0xb0, 0x33, 0x80, 0x31, 0x1c, 0x0f,
+    0x4c, 0xe0, 0x6f, 0x00, 0x80, 0x5e, 0x46, 0xae, 0xa9, 0x90, 0xf9, 0xa0, 0xa0, 0x5c, 0xee, 0xa8,
+    0xca, 0xc5, 0x0b, 0xaa, 0x0d, 0x78, 0x02, 0x02, 0xf6, 0xb0, 0xad, 0xe4, 0x96, 0x90, 0x1d, 0x45,
+    0x87, 0x69, 0x62, 0x4f, 0x07, 0x04, 0xf8, 0x9f, 0xe2, 0x8d, 0x60, 0xbb, 0x8b, 0x03, 0xc8, 0x10,
+    0xd9, 0xbd, 0xd6, 0x7c, 0x99, 0x83, 0x6e, 0xf0, 0x9a, 0xc1, 0x60, 0x58, 0x8a, 0x8e, 0x06, 0x43,
+    0x6b, 0xac, 0x34, 0x18, 0x0c, 0x45, 0x34, 0xa7, 0x32, 0xc6, 0x66, 0x7a, 0xd5, 0x96, 0x13, 0x21,
+    0x3d, 0x57, 0x1e, 0xb7, 0xf1, 0x09, 0x1e, 0xe2, 0x05, 0x2f, 0x00, 0xd8, 0xd8, 0x31, 0xa3, 0xdf,
+    0x6f, 0xde, 0x63, 0x1f, 0xca, 0x05, 0xa3, 0xa0, 0x7c, 0x74, 0x39, 0xa4, 0xc7, 0x3e, 0xf1, 0x98,
+    0xcd, 0xb7, 0x79, 0xba, 0xd4, 0x93, 0x25, 0x44, 0xa3, 0x9d, 0xb0, 0x4d, 0x6e, 0xd6, 0x43, 0x0e,
+    0x0a, 0xee, 0x79, 0x39, 0xae, 0xa5, 0xfd, 0x73, 0xdc, 0x00, 0xf7, 0xc7, 0x7f, 0xd6, 0x39, 0x6b,
+    0x41, 0xe0, 0x23, 0x0e, 0xd0, 0xe6, 0x05, 0x32, 0x18, 0x25, 0x2d, 0xac, 0x27, 0x7b, 0xa5, 0xd1,
+    0x49, 0x85, 0x01, 0x6d, 0x13, 0x28, 0x6b, 0x91, 0x4d, 0x78, 0x5b, 0x32, 0x56, 0x1d, 0x21, 0xf5,
+    0xe7, 0x45, 0xd5, 0x55, 0xdc, 0x83, 0x27, 0xae, 0x01, 0xdd, 0xa9, 0xd8, 0xcd, 0xa9, 0x92, 0x2b,
+    0x7c, 0x4c, 0x71, 0xf6, 0x34, 0x35, 0xc0, 0xfb, 0x20, 0x13, 0x2a, 0xe7, 0xba, 0x7a, 0x12, 0x2d,
+    0x25, 0xb4, 0x4f, 0xcb, 0xe5, 0x0a, 0x6b, 0x51, 0xc8, 0x7a, 0x16, 0xc0, 0x41, 0x96, 0x95, 0x33,
+    0x2e, 0x4e, 0xaf, 0xe7, 0x1d, 0xc8, 0x3a, 0x3d, 0xa2, 0x18, 0xe3, 0xaa, 0xdc, 0x70, 0x08, 0x00,
+    0xd9, 0x08, 0x66, 0x15, 0x02, 0xb0, 0x90, 0xfc, 0xbe, 0xb9, 0xaf, 0x67, 0x95, 0x09, 0xf1, 0xcc,
+    0xe1, 0x76, 0x57, 0x65, 0x88, 0x64, 0xb5, 0xca, 0xed, 0xe6, 0x7b, 0xd1, 0x5d, 0x3c, 0x19, 0x01,
+    0xdf, 0xa8, 0xff, 0x90, 0x80, 0xbb, 0xbc, 0xd4, 0xd4, 0xab, 0xd2, 0x66, 0x9a, 0x5f, 0xc9, 0x45,
+    0x80, 0xe7, 0x5e, 0xde, 0xab, 0xa1, 0x5c, 0x54, 0xfd, 0xc8, 0xc8, 0xba, 0x41, 0x6e, 0x01, 0x4d,
+    0x56, 0x92, 0x5f, 0xe3, 0xb1, 0x09, 0xe8, 0xcc, 0x25, 0x80, 0x67, 0xd6, 0x2d, 0x25, 0x83, 0x24,
+    0x33, 0x49, 0x32, 0xb9, 0xa9, 0x5c, 0x99, 0x33, 0x8f, 0x8b, 0x41, 0xff, 0x97, 0x96, 0x3e, 0x5e,
+    0xe3, 0xf9, 0x4f, 0x00, 0x70, 0x5d, 0x21, 0xb5, 0xae, 0x9c, 0xa9, 0xf5, 0x32, 0x55, 0xef, 0x07,
+    0x3f, 0x72, 0xb0, 0x3c, 0x16, 0x30, 0x95, 0x7c, 0xe2, 0x16, 0xe0, 0x9a, 0x64, 0x2e, 0xac, 0x24,
+    0x1a, 0xa6, 0x90, 0x24, 0x2d, 0x23, 0x00, 0xc0, 0x4d, 0x6d, 0xd7, 0x81, 0x40, 0x13, 0x35, 0x75,
+    0x13, 0xa8, 0xa9, 0x24, 0x76, 0xf8, 0x3c, 0x3e, 0x01, 0x0b, 0xd8, 0x13, 0x68, 0xca, 0x35, 0x4a,
+    0x46, 0xe5, 0xf1, 0xbb, 0x2f, 0xa7, 0x33, 0xf9, 0xe4, 0x47, 0x4a, 0x2d, 0xfa, 0xce, 0xfc, 0x92,
+    0xf4, 0x5e, 0x53, 0x6e, 0xe6, 0x5c, 0x96, 0xcd, 0xfc, 0x6b, 0xe1, 0x37, 0xb3, 0xd3, 0xce, 0x7d,
+    0x52, 0x0e, 0xe8, 0x2f, 0xf9, 0x03, 0x00, 0xf0, 0x0f, 0x75, 0x34, 0xb8, 0xf9, 0xc9, 0x65, 0x9b,
+    0x66, 0x3c, 0xac, 0x49, 0x95, 0xf9, 0xe2, 0xa6, 0x31, 0x71, 0x5b, 0x23, 0x3c, 0x8a, 0x00, 0xc3,
+    0x2b, 0x73, 0x8e, 0xc5, 0x9a, 0xd2, 0x2e, 0x7d, 0x15, 0x62, 0x57, 0xdf, 0x42, 0xf3, 0xfd, 0x02,
+    0x45, 0x18, 0xfc, 0xa4, 0xff, 0xbb, 0x68, 0x6b, 0x55, 0x49, 0x0f, 0x68, 0xf0, 0xe4, 0x04, 0xcc,
+    0xe7, 0x84, 0x3f, 0x57, 0x38, 0x2b, 0xfc, 0xc4, 0x04, 0xa8, 0x8a, 0xd0, 0xfa, 0xa7, 0x78, 0xfe,
+    0x65, 0x56, 0xfe, 0x73, 0x09, 0x28, 0xf4, 0xe4, 0x04, 0x60, 0xaf, 0xb5, 0x36, 0x60, 0x88, 0xcc,
+    0x2c, 0xf3, 0x77, 0x96, 0x4e, 0x0b, 0x3e, 0x05, 0x01, 0x3a, 0x74, 0xfc, 0x95, 0xf1, 0x8e, 0xdc,
+    0x6b, 0x28, 0xde, 0x63, 0xc5, 0x85, 0x51, 0xe9, 0xf7, 0x8e, 0x8e, 0x2b, 0x0c, 0xc0, 0x4b, 0xe3,
+    0x3c, 0x0b, 0x13, 0xde, 0x75, 0xd7, 0x5d, 0x53, 0xf2, 0x89, 0x09, 0xde, 0xd2, 0xf8, 0xae, 0xd7,
+    0xbe, 0xfb, 0xd9, 0x37, 0xbe, 0xac, 0xa0, 0x91, 0xb3, 0xe5, 0x3f, 0x1a, 0x18, 0x9a, 0xad, 0x98,
+    0xe1, 0x68, 0xe4, 0x3f, 0x72, 0x5d, 0x5b, 0x57, 0xfb, 0xd7, 0x69, 0xbe, 0x35, 0xd1, 0x78, 0x63,
+    0x49, 0x90, 0xc6, 0x89, 0xed, 0xf4, 0xe5, 0xf9, 0x7b, 0xa6, 0xa4, 0x63, 0xb3, 0xab, 0xda, 0x16,
+    0xfc, 0x07, 0x35, 0xa2, 0x9f, 0x50, 0xbf, 0x2d, 0x49, 0x3f, 0x0d, 0x55, 0x6e, 0x58, 0x20, 0x74,
+    0x57, 0x4c, 0x56, 0xea, 0xc5, 0x65, 0x75, 0x95, 0xf3, 0xa6, 0xa4, 0xab, 0xdb, 0x26, 0x96, 0x7e,
+    0x34, 0x01, 0x43, 0xb3, 0x44, 0xfa, 0x2b, 0x5b, 0x02, 0xb2, 0x0b, 0x01, 0x70, 0x91, 0x75, 0xf6,
+    0x0b, 0xc5, 0x00, 0xc0, 0x6d, 0x93, 0x48, 0xa5, 0xb7, 0xce, 0x83, 0x80, 0x8a, 0x33, 0x7e, 0x27,
+    0x17, 0x3a, 0x22, 0x60, 0x02, 0x79, 0x67, 0xfe, 0x8b, 0xda, 0xb2, 0x5e, 0x2b, 0xc5, 0xc9, 0x3b,
+    0xe5, 0xe5, 0x9c, 0x3e, 0x57, 0x95, 0x2b, 0x56, 0x17, 0xd2, 0x16, 0xdd, 0x4e, 0x5a, 0x82, 0x6d,
+    0x09, 0x20, 0xc9, 0x83, 0x92, 0xc3, 0xd3, 0xf5, 0xae, 0x9c, 0xb3, 0xbe, 0x90, 0xf6, 0xbc, 0xf9,
+    0xeb, 0x80, 0x5c, 0x04, 0xfc, 0x6c, 0x93, 0xee, 0x67, 0xe5, 0x86, 0x46, 0xbe, 0xde, 0x75, 0xe7,
+    0x7d, 0x62, 0xab, 0x94, 0x6e, 0x06, 0x80, 0x11, 0xe4, 0x86, 0x5a, 0x3e, 0xe5, 0xa7, 0x99, 0x84,
+    0x63, 0x3e, 0x87, 0xd6, 0x39, 0xa5, 0x3d, 0x5e, 0xda, 0xc7, 0xd4, 0x52, 0x4e, 0x08, 0x08, 0x1c,
+    0x7e, 0x94, 0x64, 0xec, 0xbc, 0x4a, 0x8e, 0x2a, 0x5f, 0xa9, 0xe9, 0xd7, 0x48, 0x46, 0x8e, 0x2b,
+    0xae, 0xd1, 0x7d, 0x0f, 0xb6, 0xf7, 0x2f, 0x3e, 0xc6, 0xc4, 0x1d, 0x92, 0x63, 0xbb, 0x8a, 0x3c,
+    0x3a, 0xaa, 0x4e, 0x80, 0x47, 0xe9, 0x96, 0x8b, 0x12, 0x99, 0xf8, 0x92, 0xa6, 0x5b, 0xce, 0xe1,
+    0x7d, 0xe1, 0x81, 0x0a, 0x02, 0xf6, 0x00, 0xf0, 0xae, 0x11, 0x26, 0x3b, 0x60, 0xc3, 0xad, 0x8c,
+    0x19, 0x53, 0xad, 0x80, 0x4f, 0xa5, 0x21, 0x27, 0x38, 0x41, 0x3a, 0x6f, 0x08, 0xa8, 0x36, 0xf8,
+    0x28, 0x79, 0xb5, 0x48, 0x9e, 0x04, 0x04, 0x25, 0x73, 0x4e, 0xee, 0x57, 0xad, 0x4d, 0xbe, 0x21,
+    0x7c, 0x99, 0xa3, 0x06, 0x00, 0x98, 0x4d, 0x73, 0x20, 0x50, 0x30, 0x93, 0x4b, 0x01, 0xc0, 0xe3,
+    0xba, 0x2c, 0x4c, 0xd8, 0x0d, 0xc1, 0x3a, 0x6e, 0xce, 0x26, 0x53, 0x57, 0xb7, 0x72, 0x2e, 0xbe,
+    0x36, 0x5c, 0x96, 0x44, 0x9a, 0x7f, 0xe8, 0x2d, 0x0d, 0x9e, 0x9a, 0x0f, 0x93, 0xbc, 0x1e, 0xa3,
+    0x0b, 0x00, 0xb8, 0x7c, 0xc7, 0xdb, 0x8a, 0x84, 0x12, 0xb0, 0x48, 0xeb, 0xe5, 0x8f, 0xe6, 0x8d,
+    0x0f, 0x55, 0xd5, 0x25, 0x5c, 0x1e, 0x66, 0xed, 0x62, 0x0c, 0x00, 0xd4, 0xcf, 0xe1, 0x8f, 0xf2,
+    0xe0, 0xa2, 0xfb, 0x20, 0xcd, 0x79, 0x0c, 0xb7, 0x28, 0x93, 0x09, 0x8e, 0x09, 0x98, 0xc9, 0xab,
+    0x0e, 0xb4, 0xda, 0x85, 0x8c, 0x77, 0x15, 0x3e, 0xa4, 0x50, 0x3d, 0x5f, 0x21, 0xeb, 0x00, 0x5d,
+    0x29, 0x0d, 0x98, 0x46, 0x33, 0xc5, 0x23, 0xd7, 0x35, 0xf5, 0x16, 0x25, 0x92, 0xa6, 0x9d, 0xbd,
+    0xbd, 0xf3, 0xb6, 0x41, 0xee, 0x9d, 0xb7, 0x64, 0x93, 0xc9, 0xcb, 0x9b, 0x1a, 0xd4, 0xbc, 0x3e,
+    0xa4, 0xa7, 0xa8, 0x61, 0xc7, 0xb5, 0xc2, 0xc6, 0x3b, 0xd6, 0x68, 0x65, 0x94, 0x79, 0x86, 0x73,
+    0xcb, 0xab, 0x0a, 0x9b, 0xf2, 0x81, 0xa3, 0x49, 0x77, 0x00, 0xfb, 0x78, 0xdb, 0xa6, 0xa6, 0xab,
+    0x04, 0x60, 0x36, 0xd9, 0x34, 0x2f, 0x02, 0x7e, 0x57, 0x35, 0x4c, 0xcd, 0x4b, 0x26, 0x72, 0xbe,
+    0xe4, 0x8f, 0xfd, 0x53, 0x26, 0x20, 0x18, 0x18, 0x27, 0xcb, 0xa9, 0x2d, 0xc9, 0xc6, 0x76, 0x97,
+    0xb4, 0xb8, 0x48, 0xf2, 0xe4, 0xe8, 0xa2, 0x6a, 0x8e, 0x73, 0xf9, 0x33, 0x70, 0xe8, 0x21, 0x2b,
+    0xf9, 0x7b, 0x77, 0x25, 0x63, 0x29, 0xcf, 0x01, 0x40, 0x85, 0x9c, 0xb8, 0xa2, 0x80, 0xcb, 0x98,
+    0xa8, 0xec, 0x98, 0xf9, 0x05, 0x76, 0x10, 0x98, 0xcd, 0x71, 0x52, 0x89, 0x1a, 0x64, 0x5d, 0x9c,
+    0x12, 0x15, 0xd0, 0x96, 0x80, 0x0c, 0xa1, 0xbc, 0x8c, 0x83, 0x13, 0x02, 0x02, 0xd2, 0xf9, 0x85,
+    0x1d, 0x01, 0x49, 0xe7, 0xb3, 0x52, 0xcf, 0x7d, 0x22, 0xcc, 0x63, 0x71, 0xb2, 0x59, 0xe3, 0x5d,
+    0x0f, 0x32, 0x2f, 0xcd, 0x2d, 0x6a, 0x33, 0x3e, 0x94, 0x26, 0x3c, 0x97, 0xf1, 0x67, 0x03, 0x00,
+    0xcc, 0xe2, 0x65, 0x03, 0x30, 0x9e, 0xe9, 0xe2, 0x7c, 0x2b, 0xd2, 0x5e, 0xcb, 0x9f, 0x40, 0xc6,
+    0x85, 0xd8, 0xe7, 0x38, 0xd7, 0x7f, 0x1b, 0x5c, 0xd7, 0xe4, 0xb4, 0x33, 0xb3, 0x33, 0x00, 0xac,
+    0x64, 0x1b, 0x00, 0x61, 0x24, 0xc9, 0x33, 0x3f, 0x12, 0xf0, 0xbe, 0x77, 0x45, 0x2a, 0x32, 0x8f,
+    0xd7, 0x80, 0xf1, 0xbc, 0xef, 0x61, 0xf7, 0x81, 0xdf, 0xf3, 0x67, 0x00, 0x6f, 0x2b, 0xa2, 0x59,
+    0x6e, 0x02, 0xb0, 0x47, 0x15, 0x28, 0x6c, 0x7a, 0x81, 0xd4, 0x4e, 0x00, 0xd0, 0x84, 0x9c, 0x68,
+    0x26, 0x49, 0xc6, 0xd5, 0xd0, 0x5a, 0xdc, 0x33, 0x92, 0x10, 0x78, 0x8b, 0xeb, 0x6a, 0x7a, 0x97,
+    0x9d, 0x6c, 0x32, 0xb6, 0x01, 0xd0, 0x8b, 0x14, 0xde, 0x6d, 0x28, 0x65, 0x71, 0xce, 0xa6, 0x06,
+    0x58, 0x0f, 0x0d, 0x2b, 0xf8, 0x58, 0x62, 0xcf, 0x80, 0x1f, 0xcd, 0x9a, 0x1a, 0xd0, 0x35, 0x5b,
+    0x88, 0xeb, 0xae, 0xf7, 0xcf, 0x00, 0x68, 0xcd, 0xac, 0x77, 0x4b, 0x14, 0x1b, 0x9e, 0x4e, 0x02,
+    0x58, 0x2e, 0xb5, 0x39, 0xd7, 0x3b, 0x9c, 0x0d, 0x94, 0xb6, 0xb2, 0x9b, 0xf6, 0x03, 0xbd, 0xaa,
+    0x2f, 0xa3, 0xb9, 0x1d, 0x80, 0xf9, 0x4c, 0x81, 0x53, 0x02, 0xe6, 0xda, 0x4d, 0x03, 0x0c, 0xf8,
+    0xb2, 0x4d, 0x59, 0x8f, 0xe0, 0x61, 0xf1, 0xcc, 0xae, 0x03, 0xa0, 0x03, 0x69, 0xba, 0xd1, 0xd1,
+    0x27, 0xf0, 0xad, 0x14, 0x5e, 0x56, 0x34, 0xa4, 0x22, 0x39, 0x1c, 0x2d, 0x4b, 0xa1, 0x61, 0x46,
+    0x92, 0xfc, 0xb1, 0x11, 0x00, 0x04, 0x99, 0xf8, 0x19, 0x00, 0x78, 0x5c, 0x23, 0x17, 0xe4, 0xfa,
+    0xac, 0xfa, 0x8b, 0x13, 0x49, 0xe3, 0xb6, 0x6e, 0x9e, 0x79, 0x7f, 0xbd, 0x5b, 0xfb, 0x75, 0x19,
+    0x64, 0xca, 0x8a, 0x66, 0xb2, 0x0d, 0xe8, 0x6c, 0xe2, 0x24, 0xa9, 0x9d, 0x4d, 0x06, 0xb0, 0x91,
+    0xe3, 0x01, 0x60, 0x08, 0x09, 0x20, 0x94, 0xad, 0x44, 0x1d, 0x21, 0x6b, 0x01, 0x38, 0xca, 0xef,
+    0xec, 0xba, 0xc1, 0xc3, 0xaf, 0x03, 0xc0, 0x6a, 0xde, 0x70, 0x4e, 0xc0, 0x44, 0xc9, 0xc0, 0xd8,
+    0xa1, 0xf4, 0x5d, 0x7e, 0x0f, 0xa0, 0x13, 0x69, 0xae, 0x29, 0x14, 0x28, 0xca, 0x31, 0x10, 0x18,
+    0x43, 0xa3, 0x2c, 0x46, 0x74, 0x3b, 0x43, 0x92, 0xbc, 0x3d, 0xd9, 0x15, 0x00, 0x96, 0xd3, 0x3a,
+    0x2b, 0xd8, 0xbd, 0xce, 0x5e, 0x9a, 0xf8, 0x89, 0x83, 0x6e, 0xd0, 0xbd, 0xd3, 0x96, 0x6c, 0x32,
+    0x79, 0x45, 0x73, 0x83, 0xd3, 0xcf, 0x7f, 0xf5, 0xb3, 0x44, 0xd2, 0xbc, 0xbb, 0x8f, 0x6a, 0x29,
+    0x7d, 0x1f, 0xc8, 0x93, 0x2b, 0xdd, 0xd9, 0x09, 0xc0, 0x35, 0x16, 0x01, 0x00, 0x77, 0x33, 0x01,
+    0x0c, 0x93, 0xe4, 0xd0, 0x0d, 0x8c, 0x06, 0x80, 0x77, 0x69, 0x2a, 0x6a, 0x4b, 0x40, 0xca, 0xb2,
+    0x02, 0x8f, 0x22, 0xe0, 0x43, 0x45, 0x55, 0xb7, 0xc5, 0xfb, 0xcc, 0xf6, 0x04, 0x5a, 0x92, 0xdf,
+    0x4b, 0xea, 0xa8, 0x98, 0x43, 0x10, 0x33, 0x12, 0x5b, 0xa5, 0xa3, 0xb1, 0x34, 0x7d, 0x5c, 0xc5,
+    0xbb, 0xf4, 0xdb, 0x77, 0xb8, 0x1d, 0x00, 0x0a, 0x1c, 0x11, 0x8f, 0x5d, 0x11, 0xcd, 0x49, 0x8e,
+    0xfd, 0x80, 0x82, 0xef, 0x1c, 0x23, 0x19, 0x33, 0xb7, 0xa2, 0x43, 0x3f, 0x60, 0xda, 0x15, 0x92,
+    0x67, 0xc7, 0x07, 0x69, 0x33, 0x43, 0x98, 0x29, 0x75, 0x43, 0xc3, 0xd8, 0x1c, 0x40, 0x52, 0xb6,
+    0x48, 0xc5, 0x11, 0xc0, 0xc7, 0xc2, 0x1f, 0x0d, 0xc8, 0x12, 0x71, 0x29, 0x25, 0x2c, 0x1c, 0xa3,
+    0xf9, 0x40, 0xd7, 0xe0, 0x5e, 0x57, 0x78, 0xca, 0xed, 0x11, 0x4d, 0x60, 0x9e, 0x6c, 0xb9, 0xec,
+    0xd0, 0x98, 0x2c, 0x0f, 0x54, 0xa5, 0x3c, 0xad, 0xfe, 0x9d, 0xe2, 0x69, 0xbe, 0x28, 0xcb, 0xd0,
+    0x28, 0x9a, 0x21, 0xc5, 0x8c, 0xd4, 0x35, 0x8b, 0xc0, 0x08, 0xf7, 0x51, 0xc7, 0x53, 0x33, 0x4f,
+    0x0f, 0x72, 0xcf, 0x62, 0x4f, 0xe5, 0xcb, 0xed, 0xe2, 0x1b, 0x50, 0xf1, 0xa3, 0xdf, 0x9d, 0x4c,
+    0x79, 0x4d, 0x20, 0xe3, 0x17, 0xd4, 0xb2, 0xcb, 0xec, 0xc5, 0x38, 0xe9, 0xa8, 0x07, 0xbb, 0x03,
+    0xb8, 0x2e, 0x6a, 0x80, 0x9b, 0x89, 0x80, 0xe1, 0x6c, 0x96, 0x97, 0xa0, 0x86, 0xc2, 0x42, 0x1d,
+    0x94, 0xa6, 0x0b, 0x95, 0x0f, 0xac, 0x98, 0xc3, 0x61, 0x8f, 0x30, 0x82, 0x7b, 0xa9, 0xce, 0x9a,
+    0xda, 0x39, 0x28, 0x04, 0xae, 0x19, 0x15, 0x07, 0x1e, 0xb2, 0x52, 0x36, 0x08, 0x89, 0xbb, 0xa5,
+    0x66, 0xed, 0x03, 0x11, 0xe6, 0xf2, 0xeb, 0x65, 0x34, 0x03, 0x00, 0xd3, 0xd2, 0x86, 0xfe, 0x3e,
+    0x2f, 0xaf, 0xae, 0xef, 0x85, 0x13, 0x40, 0xa4, 0xc1, 0xb0, 0x07, 0xc0, 0x6b, 0x58, 0x15, 0x67,
+    0x23, 0xb4, 0x4f, 0xad, 0xd0, 0x7c, 0x55, 0x8a, 0x23, 0x02, 0x32, 0x37, 0xb4, 0x0f, 0x1e, 0x7f,
+    0xce, 0x2e, 0x53, 0x7d, 0x6e, 0x2c, 0xaa, 0x01, 0xf8, 0x15, 0x03, 0x01, 0xa0, 0x9f, 0x1b, 0x80,
+    0x77, 0x6a, 0xad, 0xcd, 0x06, 0x80, 0x81, 0xb2, 0xc4, 0xff, 0x1a, 0x5e, 0x7a, 0xd1, 0x56, 0xd5,
+    0x8f, 0xc6, 0x6b, 0xc0, 0x41, 0xa0, 0x8b, 0xb3, 0x46, 0x17, 0xd8, 0x18, 0x47, 0xe0, 0xbc, 0x09,
+    0x60, 0xaf, 0xda, 0x04, 0xc2, 0x24, 0x2b, 0x95, 0xa0, 0x4c, 0x12, 0xf6, 0xa4, 0xac, 0x0a, 0x5c,
+    0x54, 0xba, 0x60, 0x61, 0x74, 0x34, 0xf7, 0x74, 0x1a, 0xdf, 0x90, 0x5f, 0x78, 0xa4, 0xfe, 0x02,
+    0xa0, 0x3d, 0x33, 0x47, 0x97, 0x28, 0x3a, 0x38, 0x85, 0xac, 0xfe, 0xa9, 0x35, 0x36, 0x28, 0xd7,
+    0xe4, 0xcd, 0x7c, 0xdb, 0xff, 0xf0, 0x79, 0xee, 0x03, 0x10, 0xe1, 0xdc, 0x11, 0x9a, 0x43, 0x36,
+    0x71, 0x38, 0xf3, 0x96, 0xc0, 0x5d, 0x00, 0xd0, 0x4f, 0x35, 0x82, 0x12, 0x89, 0x1d, 0x85, 0xc5,
+    0x05, 0x80, 0x5a, 0x54, 0x9b, 0xc0, 0x68, 0xf5, 0xda, 0xb6, 0x16, 0x4d, 0xa4, 0x90, 0x4f, 0x4e,
+    0xd8, 0xff, 0x6a, 0xa0, 0xba, 0x91, 0xad, 0x01, 0x7c, 0x2d, 0xfc, 0x80, 0xbd, 0x24, 0x2f, 0x54,
+    0x96, 0xbc, 0x55, 0x53, 0x09, 0x45, 0x2c, 0x8f, 0x77, 0xd5, 0x7e, 0x60, 0xa5, 0x1c, 0x7e, 0x09,
+    0xe0, 0x15, 0x8d, 0x2b, 0xdc, 0xcd, 0xc6, 0x15, 0x1e, 0x66, 0xb1, 0x9b, 0x9c, 0xa8, 0x70, 0x7c,
+    0x4c, 0xbd, 0x20, 0xf7, 0x52, 0x43, 0xee, 0x30, 0xbb, 0x2e, 0x00, 0xb8, 0xfc, 0xca, 0x1b, 0x1d,
+    0x7c, 0x02, 0x06, 0x26, 0xf3, 0x17, 0xa9, 0x81, 0x6c, 0x95, 0xe6, 0xbc, 0xc4, 0x58, 0xc0, 0x34,
+    0xa7, 0x8a, 0x57, 0xf0, 0xe0, 0x3b, 0x4c, 0x2d, 0x06, 0xa0, 0xfb, 0x9a, 0x90, 0x12, 0x9e, 0x55,
+    0x66, 0x66, 0xab, 0xf6, 0xf2, 0xe9, 0x11, 0xca, 0x6c, 0xf9, 0xb0, 0x96, 0x25, 0x3a, 0x00, 0x70,
+    0x1d, 0x7f, 0xd9, 0x78, 0xfb, 0x3f, 0xbe, 0x9b, 0x6e, 0xef, 0xe8, 0x2f, 0xac, 0xa3, 0xe1, 0x26,
+    0xb7, 0xc9, 0x45, 0x9a, 0x90, 0xed, 0x55, 0x23, 0x58, 0xaa, 0xd7, 0x15, 0x5a, 0x1b, 0x00, 0xc0,
+    0x48, 0x2b, 0x6f, 0x8d, 0xa9, 0xe2, 0xe3, 0x5d, 0xe9, 0x6d, 0xcd, 0x60, 0xc8, 0xbf, 0xda, 0xe0,
+    0x9f, 0x73, 0x0d, 0x86, 0x94, 0xea, 0x94, 0xd2, 0x59, 0x52, 0x9c, 0x6f, 0x88, 0xf4, 0x15, 0x69,
+    0x5e, 0xa4, 0xb0, 0x51, 0xb2, 0xb4, 0x00, 0x50, 0xf1, 0xa6, 0x54, 0x3a, 0xfd, 0x0d, 0x51, 0x5d,
+    0x04, 0x56, 0xb9, 0xfe, 0x5f, 0x08, 0xc0, 0x52, 0xfe, 0xe4, 0x60, 0xbe, 0xa4, 0x85, 0xb6, 0x9b,
+    0xb9, 0xc8, 0x8d, 0x36, 0xc3, 0x61, 0xf3, 0x58, 0xc9, 0x82, 0xde, 0x93, 0x73, 0xd6, 0x15, 0xd4,
+    0x9e, 0xb7, 0x7c, 0x13, 0x68, 0xef, 0xaf, 0xcc, 0x39, 0x1e, 0x97, 0xf3, 0x50, 0xa3, 0xf9, 0xfb,
+    0xcd, 0xb8, 0x90, 0x91, 0xfe, 0xdb, 0x24, 0x3f, 0xe5, 0x85, 0x72, 0x34, 0x5e, 0xb1, 0xdf, 0x07,
+    0x3f, 0x3f, 0x30, 0xa7, 0x9d, 0x5b, 0x50, 0x4e, 0xb4, 0xd2, 0xde, 0xbb, 0x62, 0xb2, 0x6f, 0x6f,
+    0x68, 0xf5, 0xbf, 0x14, 0x68, 0xb4, 0x04, 0xb8, 0x1f, 0x62, 0xd4, 0xcb, 0xea, 0x2c, 0x8f, 0x88,
+    0x30, 0xc2, 0x57, 0xbc, 0xa9, 0x5a, 0xef, 0x31, 0xcc, 0x0e, 0x54, 0x3e, 0x30, 0xe3, 0xe2, 0xe7,
+    0x4a, 0xa7, 0xe2, 0x3b, 0x7a, 0x77, 0x6c, 0x76, 0xda, 0xc5, 0xa5, 0x75, 0x54, 0x41, 0xe4, 0xc1,
+    0xb5, 0xed, 0x0e, 0x04, 0x91, 0xbf, 0x34, 0xfc, 0xb6, 0x93, 0x7b, 0x86, 0x54, 0xf1, 0xf7, 0x2c,
+    0xdb, 0x67, 0xbb, 0x25, 0xa3, 0xcb, 0x73, 0x28, 0xd8, 0x19, 0x46, 0xdc, 0x51, 0xbc, 0xdc, 0x17,
+    0x9f, 0x4f, 0xcd, 0xd2, 0xbb, 0xef, 0xba, 0xcb, 0x29, 0x99, 0x57, 0x57, 0xb7, 0xd1, 0xe5, 0x5b,
+    0x1d, 0xff, 0x17, 0xa8, 0x1d, 0x04, 0x43, 0xb5, 0x29, 0x29, 0x1a, 0xc8, 0x67, 0xf8, 0xf6, 0x9b,
+    0xe9, 0x59, 0x31, 0xdb, 0x87, 0xfb, 0xda, 0x39, 0x54, 0x5b, 0xb8, 0x43, 0x93, 0x0e, 0xe7, 0x1e,
+    0x4d, 0xaa, 0xc4, 0x25, 0xde, 0xab, 0x63, 0xe7, 0x81, 0x03, 0xe1, 0x94, 0xc7, 0x6e, 0x40, 0x4f,
+    0x92, 0xfd, 0x80, 0x70, 0xca, 0x42, 0x03, 0x76, 0xca, 0x3a, 0x4d, 0xb1, 0x29, 0xc7, 0xee, 0x1a,
+    0xe3, 0x0f, 0xbe, 0x1f, 0xa0, 0x7d, 0xbf, 0xb4, 0x8b, 0x4b, 0x15, 0x55, 0xbc, 0xd8, 0x94, 0x63,
+    0x77, 0x8d, 0x09, 0x87, 0x3e, 0xb0, 0x29, 0x90, 0x1e, 0xbd, 0xa2, 0xae, 0xd2, 0x77, 0x0c, 0xfd,
+    0xf1, 0x6e, 0xce, 0xbd, 0x73, 0x1b, 0x07, 0x95, 0x00, 0x50, 0xc4, 0x56, 0x86, 0x89, 0xc8, 0x27,
+    0x01, 0x5d, 0x13, 0xe4, 0x74, 0x72, 0xa8, 0xcb, 0xe3, 0x12, 0x50, 0xfa, 0x2a, 0xe3, 0xab, 0xc3,
+    0x11, 0x01, 0x1c, 0x25, 0x1d, 0x7f, 0xab, 0x10, 0x20, 0xfb, 0x9b, 0x32, 0x01, 0x6f, 0xa7, 0x4a,
+    0x0f, 0xbc, 0xd7, 0xd9, 0xf6, 0xfd, 0x8c, 0xd2, 0xe8, 0x5c, 0x29, 0x90, 0xd4, 0xc5, 0xb6, 0x80,
+    0x59, 0x0a, 0xc7, 0x2b, 0xf6, 0xab, 0x9c, 0x13, 0xfd, 0x48, 0x02, 0x5c, 0x00, 0x60, 0xaf, 0x41,
+    0xc2, 0x12, 0x6d, 0xea, 0x0b, 0x00, 0x18, 0xb9, 0xa5, 0x78, 0xdc, 0x07, 0x75, 0x02, 0x3d, 0x4b,
+    0xb6, 0x5f, 0x8c, 0xcf, 0xaa, 0x3f, 0x66, 0x9d, 0x2a, 0x7f, 0xb8, 0x62, 0xec, 0x6b, 0x97, 0x1c,
+    0x9d, 0x49, 0xc0, 0x9b, 0xe2, 0xa0, 0x50, 0xdb, 0xd4, 0x4c, 0x39, 0x73, 0x86, 0x8d, 0x58, 0x30,
+    0x6e, 0x85, 0xdf, 0xe5, 0xfe, 0x25, 0x3d, 0xcb, 0x0c, 0x8f, 0x2d, 0xb2, 0x55, 0xfa, 0xe2, 0xbd,
+    0x06, 0x83, 0x4b, 0xe9, 0xc1, 0x89, 0x1e, 0xab, 0x4a, 0xdb, 0x16, 0x28, 0xbc, 0xa5, 0x9f, 0x5a,
+    0xa0, 0x54, 0xdf, 0x58, 0xd7, 0xc5, 0x62, 0xcc, 0xbd, 0xfe, 0x25, 0xe3, 0xbc, 0x5a, 0xfe, 0x01,
+    0x35, 0xba, 0xae, 0x88, 0x03, 0x90, 0x24, 0x3e, 0xe7, 0x3a, 0x66, 0x1b, 0x0c, 0x06, 0x83, 0x21,
+    0xc4, 0x41, 0x0d, 0xd8, 0xe3, 0x34, 0xd5, 0xc0, 0xc4, 0xbd, 0xb2, 0x3f, 0xe4, 0xb7, 0xa8, 0xda,
+    0xe3, 0xd5, 0x80, 0x4a, 0xb7, 0x79, 0xa3, 0xbc, 0xe3, 0x7b, 0x6f, 0x8a, 0xb3, 0x0a, 0x07, 0x6a,
+    0x38, 0x57, 0x27, 0x8b, 0x1a, 0x70, 0x30, 0x93, 0xbd, 0x35, 0x35, 0xa0, 0xa1, 0x99, 0x7b, 0x84,
+    0xf0, 0x1b, 0x78, 0x86, 0x69, 0x15, 0x35, 0xf7, 0x68, 0x41, 0xbe, 0x6f, 0x5f, 0x20, 0xa3, 0xb2,
+    0xa6, 0x40, 0x03, 0x29, 0x4e, 0xb7, 0x16, 0xf9, 0x66, 0x6e, 0xee, 0xaf, 0x71, 0x96, 0xa3, 0x7f,
+    0xc9, 0x23, 0x82, 0xa5, 0xe7, 0xb8, 0xdd, 0xea, 0x91, 0x26, 0x1d, 0xa7, 0x8d, 0x89, 0x7a, 0xac,
+    0xff, 0x7f, 0xf5, 0xc3, 0xc1, 0x57, 0x9b, 0xde, 0x70, 0x7c, 0xce, 0xba, 0xc1, 0x20, 0xfe, 0xab,
+    0x7d, 0xb1, 0x56, 0xae, 0x14, 0x4b, 0x31, 0x5d, 0xe3, 0x47, 0xcf, 0x76, 0x8d, 0xef, 0x2d, 0x1c,
+    0xc1, 0xe4, 0x6e, 0x19, 0xbe, 0x53, 0x34, 0xd7, 0x1e, 0x78, 0x88, 0xaa, 0xf6, 0x05, 0x7c, 0xb4,
+    0x05, 0x4e, 0xdc, 0x47, 0x25, 0x00, 0x78, 0x09, 0xf9, 0x08, 0x44, 0xc9, 0x9b, 0x80, 0x8a, 0x2d,
+    0xf0, 0x69, 0x6a, 0x3e, 0x6d, 0x6a, 0xed, 0x83, 0x41, 0x97, 0x9a, 0x39, 0x8d, 0x85, 0x5b, 0x27,
+    0xda, 0x40, 0x99, 0x26, 0x09, 0x07, 0x14, 0x89, 0x32, 0xad, 0x4a, 0x7f, 0xed, 0x13, 0x17, 0x26,
+    0x4b, 0xc7, 0xb7, 0x56, 0xa3, 0x8f, 0x9f, 0xbd, 0x5c, 0x61, 0x57, 0xa0, 0x97, 0xbf, 0xcd, 0xc7,
+    0x64, 0x03, 0x80, 0x1b, 0x0c, 0x81, 0xff, 0x23, 0x02, 0x9a, 0x03, 0xdf, 0xe5, 0xf3, 0xfb, 0xeb,
+    0x1f, 0x28, 0x7a, 0xb6, 0x79, 0x82, 0xd3, 0xd3, 0xbf, 0x44, 0xd7, 0xac, 0x05, 0xe0, 0x4d, 0xc3,
+    0x06, 0x8b, 0x9c, 0x95, 0xb4, 0x08, 0x53, 0xdd, 0x35, 0x4f, 0x54, 0xc6, 0x79, 0xd8, 0x0a, 0xf7,
+    0x86, 0x9a, 0x11, 0x50, 0x41, 0x5c, 0xce, 0xb3, 0x40, 0xe3, 0x82, 0x22, 0x3e, 0xfe, 0x12, 0x30,
+    0xdf, 0xeb, 0x7f, 0x43, 0x40, 0x35, 0xa4, 0xde, 0xcc, 0xdf, 0xf7, 0x57, 0x8a, 0x28, 0x78, 0xba,
+    0xc5, 0xbd, 0x3c, 0x0a, 0x88, 0x2a, 0xa0, 0xb6, 0x00, 0x00, 0x0b, 0x92, 0xcb, 0x0f, 0x56, 0x9f,
+    0x98, 0x76, 0x4d, 0x39, 0x11, 0x09, 0x54, 0x93, 0x1d, 0xe2, 0x52, 0x83, 0x36, 0xc0, 0xb8, 0x31,
+    0x8f, 0x02, 0x25, 0xfa, 0x6e, 0x44, 0xfc, 0x1a, 0x00, 0x38, 0x71, 0x1a, 0x03, 0xe2, 0xd6, 0x86,
+    0xd6, 0x77, 0x7b, 0x6c, 0x02, 0xda, 0x68, 0x62, 0xac, 0x94, 0xd4, 0x06, 0x00, 0x85, 0xf0, 0x40,
+    0x14, 0x5b, 0xa2, 0xcc, 0x16, 0xab, 0x85, 0xbb, 0x39, 0xba, 0xdf, 0x0b, 0x01, 0x18, 0xf1, 0x10,
+    0x79, 0x12, 0xd0, 0xdb, 0x80, 0xda, 0x35, 0xaf, 0x9c, 0x51, 0xb3, 0x92, 0x17, 0x60, 0xb2, 0x2c,
+    0x53, 0x17, 0xc2, 0x7d, 0xcd, 0x09, 0x33, 0x0a, 0x4b, 0x8f, 0xb4, 0xc6, 0xae, 0x2a, 0x66, 0x1a,
+    0x12, 0x93, 0xbb, 0x40, 0x21, 0xb9, 0xc0, 0x9d, 0xf0, 0x52, 0xa7, 0x5b, 0xa4, 0x03, 0x00, 0xbb,
+    0x9c, 0x40, 0xa1, 0x37, 0x3f, 0x3b, 0x9d, 0xbc, 0xa9, 0xc1, 0xd3, 0xd6, 0x80, 0xfc, 0xe3, 0xea,
+    0x43, 0x6c, 0x2f, 0x97, 0x57, 0x81, 0xeb, 0x27, 0xca, 0x36, 0xb6, 0xad, 0x00, 0xc0, 0xc2, 0xa4,
+    0xe0, 0x77, 0x14, 0x3d, 0xd0, 0x09, 0x32, 0xa3, 0xbe, 0xa8, 0x13, 0xee, 0xa0, 0x80, 0xe6, 0x03,
+    0x52, 0xa6, 0x4a, 0x41, 0xef, 0x71, 0x8d, 0x3a, 0xae, 0xbb, 0x03, 0x14, 0xe8, 0x71, 0x7c, 0xea,
+    0xe3, 0x11, 0xa0, 0xf8, 0x01, 0xc9, 0x9a, 0x54, 0x6f, 0x00, 0x0f, 0x20, 0x4d, 0xc8, 0x87, 0x1a,
+    0x0c, 0x86, 0xbd, 0x4a, 0x9f, 0x2b, 0xb0, 0xd5, 0xd1, 0xfd, 0x7e, 0x7f, 0x3d, 0xb5, 0xf4, 0x4f,
+    0xc1, 0x79, 0x57, 0x81, 0x37, 0x0d, 0x7d, 0xb0, 0x4e, 0x9b, 0x95, 0x3e, 0x17, 0x1f, 0x4a, 0x93,
+    0xfa, 0xf7, 0x51, 0x58, 0xa3, 0x5e, 0xba, 0x89, 0x1a, 0xb8, 0xd7, 0x60, 0x30, 0x14, 0xa8, 0x3e,
+    0xe2, 0x52, 0x5e, 0x05, 0xbc, 0xeb, 0x6c, 0x09, 0xf8, 0x4e, 0x96, 0xfa, 0xb8, 0xb3, 0x6f, 0xa9,
+    0xd2, 0xdd, 0xd7, 0x98, 0x30, 0xa3, 0xc3, 0xd3, 0xd5, 0x80, 0x28, 0xf8, 0x97, 0xcd, 0x67, 0x15,
+    0x38, 0xd3, 0x2e, 0xbd, 0xfc, 0x4f, 0x41, 0x79, 0xc9, 0x7c, 0xe6, 0x1e, 0x21, 0xc1, 0xa7, 0xae,
+    0xd9, 0xe4, 0x2d, 0x4d, 0x28, 0x1e, 0x2a, 0x3f, 0xd1, 0xaf, 0x82, 0x92, 0x5d, 0x07, 0xb8, 0x94,
+    0xfb, 0x95, 0x1c, 0x17, 0xc8, 0x3e, 0xdb, 0x73, 0xb7, 0xfb, 0x57, 0x9a, 0x70, 0xe8, 0xd8, 0xad,
+    0x03, 0x5a, 0x98, 0x30, 0xe2, 0xe9, 0x08, 0x38, 0x08, 0x74, 0xce, 0x6f, 0x23, 0x38, 0xd6, 0x21,
+    0xb3, 0xd2, 0xfe, 0xa2, 0xce, 0xcf, 0x27, 0x46, 0x14, 0x59, 0x6a, 0xdb, 0x02, 0x80, 0xac, 0x39,
+    0xf8, 0x40, 0x74, 0x78, 0x87, 0x00, 0x65, 0x91, 0x06, 0xba, 0xc1, 0x74, 0xdc, 0xc1, 0x2b, 0x69,
+    0x0b, 0x64, 0xab, 0x62, 0x34, 0x47, 0x9b, 0x2b, 0xbc, 0x6d, 0x53, 0xf6, 0xe8, 0x1e, 0xc5, 0x46,
+    0x3e, 0x21, 0x01, 0xd7, 0x0e, 0xe0, 0x3d, 0xbf, 0xfc, 0x32, 0x70, 0xe8, 0x1f, 0xc6, 0xea, 0xfb,
+    0x0a, 0x39, 0x3f, 0xbf, 0x16, 0x95, 0x2c, 0x1b, 0xed, 0xf2, 0xbe, 0x8c, 0x29, 0x2c, 0x96, 0xb2,
+    0x5d, 0x3d, 0x84, 0xb1, 0xb2, 0x9c, 0x5d, 0xe6, 0x2d, 0xac, 0x4f, 0xcb, 0xf5, 0x4a, 0x07, 0x6d,
+    0x0a, 0x6c, 0xd4, 0x4c, 0x73, 0x5e, 0x5f, 0x87, 0x89, 0xb6, 0x96, 0xff, 0x01, 0xcc, 0x4f, 0x69,
+    0x04, 0xff, 0x65, 0x2e, 0xb7, 0xd1, 0x37, 0xbf, 0x0c, 0xec, 0xeb, 0x96, 0x53, 0x7b, 0x6f, 0x80,
+    0xd3, 0xd3, 0x3b, 0x32, 0xb1, 0xff, 0xae, 0x5d, 0x5e, 0xce, 0x2c, 0x8c, 0x13, 0xd3, 0xc8, 0x93,
+    0x2c, 0x25, 0xd7, 0x89, 0x2e, 0x21, 0x60, 0xb3, 0x6f, 0xa6, 0x03, 0xef, 0x75, 0xb2, 0xb6, 0x40,
+    0xfa, 0x74, 0xed, 0xa9, 0xf9, 0x28, 0xd7, 0x53, 0x9b, 0x2e, 0xd4, 0x0e, 0x67, 0x9f, 0x92, 0x80,
+    0x13, 0x63, 0xd8, 0xee, 0xd2, 0x84, 0x5a, 0xfe, 0xae, 0x85, 0x5b, 0x7e, 0xd3, 0x1c, 0x7c, 0x4c,
+    0x06, 0x76, 0xf5, 0x36, 0xd7, 0xdf, 0xed, 0x94, 0xb7, 0xf4, 0x02, 0x86, 0xdc, 0xda, 0xce, 0xea,
+    0xeb, 0x01, 0x22, 0xf0, 0xf9, 0xe8, 0xbf, 0xd0, 0xfe, 0xb7, 0xbe, 0x41, 0x1e, 0xc1, 0x43, 0xce,
+    0xbd, 0x62, 0x1d, 0x7e, 0x35, 0xf7, 0xe5, 0xda, 0x02, 0x96, 0x01, 0x36, 0x6e, 0xca, 0xf9, 0x3d,
+    0x98, 0x08, 0xa0, 0xdb, 0xb1, 0x19, 0xad, 0xaa, 0x04, 0x78, 0xbd, 0x30, 0xf4, 0x44, 0x31, 0x2c,
+    0xc9, 0x9f, 0x1e, 0xf0, 0x95, 0xfd, 0xf0, 0x45, 0x1b, 0x6b, 0x65, 0x59, 0x57, 0x22, 0xcf, 0xc1,
+    0xd0, 0x6e, 0x4d, 0xaa, 0x97, 0x99, 0x87, 0x7c, 0x6c, 0xef, 0xdd, 0x1c, 0x08, 0x17, 0x21, 0xc3,
+    0x72, 0x27, 0x2e, 0x06, 0x43, 0x52, 0xd6, 0x00, 0x52, 0x1a, 0x0e, 0x0f, 0x4b, 0x93, 0x47, 0xbb,
+    0x5d, 0x1d, 0x0c, 0xa8, 0xb4, 0x05, 0x62, 0x43, 0xec, 0x0a, 0x08, 0xb9, 0xbc, 0xb7, 0xf2, 0xcc,
+    0x9c, 0xd0, 0xa7, 0x1d, 0x0c, 0x01, 0xdb, 0xca, 0x8f, 0xf8, 0xf6, 0x56, 0xa6, 0x31, 0x7e, 0xff,
+    0xb4, 0x8a, 0x6f, 0xc6, 0xe7, 0x51, 0xce, 0x03, 0x59, 0x5a, 0x53, 0x3f, 0xd8, 0xda, 0xec, 0x5b,
+    0xaf, 0xfc, 0xb4, 0x9b, 0x70, 0x65, 0xa4, 0x15, 0x56, 0x71, 0xda, 0x89, 0x24, 0x53, 0xe2, 0x91,
+    0x89, 0x15, 0xb7, 0x39, 0x2e, 0x1a, 0x56, 0x71, 0xda, 0x89, 0x24, 0x2b, 0x90, 0xd9, 0xc0, 0x5e,
+    0xdc, 0x38, 0x70, 0x1a, 0xff, 0x04, 0x36, 0x37, 0x9c, 0xbc, 0x37, 0x3a, 0xc5, 0xfc, 0xf0, 0xf4,
+    0x27, 0x35, 0x96, 0xe0, 0x0f, 0xc3, 0x11, 0x86, 0xe1, 0x0f, 0x45, 0xed, 0x54, 0x1e, 0xf2, 0xf8,
+    0xeb, 0xe8, 0x6a, 0x7e, 0x19, 0x4f, 0xb0, 0x02, 0xe1, 0xe9, 0xd0, 0xd6, 0xc4, 0xd5, 0x7f, 0x95,
+    0xcf, 0x77, 0xaf, 0xf9, 0x23, 0x4d, 0x7f, 0x78, 0x2c, 0xf9, 0x70, 0xaa, 0x71, 0x92, 0x7f, 0x2e,
+    0x9a, 0x93, 0x94, 0xa2, 0x7a, 0x9e, 0x4f, 0x34, 0xb7, 0x26, 0x1f, 0xec, 0xa9, 0xcb, 0xeb, 0x3a,
+    0xfe, 0xae, 0x48, 0x50, 0x4d, 0x49, 0x2c, 0x27, 0x03, 0x5f, 0x53, 0x33, 0x04, 0x1b, 0xc5, 0xec,
+    0x40, 0xa0, 0x18, 0xd9, 0x49, 0xa4, 0x3f, 0xa7, 0xbc, 0xa2, 0xfc, 0x33, 0x5e, 0x00, 0x50, 0x2b,
+    0x47, 0x5e, 0x13, 0x88, 0xc5, 0x8c, 0x2f, 0x04, 0xec, 0xe6, 0xaf, 0xb2, 0x3f, 0x5e, 0xc7, 0xc4,
+    0x81, 0xc0, 0x06, 0x1b, 0x55, 0x3e, 0x08, 0x48, 0x26, 0x49, 0x2f, 0x9b, 0x45, 0x50, 0x5b, 0x48,
+    0x52, 0x19, 0xb9, 0xce, 0x27, 0xd7, 0xca, 0xc3, 0xfe, 0x26, 0xda, 0x8b, 0x9b, 0x00, 0x73, 0xf8,
+    0x83, 0x70, 0x5d, 0xfc, 0xfb, 0x6e, 0x89, 0x4a, 0x4f, 0xbf, 0xf0, 0x49, 0x10, 0x00, 0x44, 0x4a,
+    0xc2, 0xb2, 0x82, 0x26, 0xe1, 0x37, 0xb2, 0x92, 0x4e, 0x4d, 0xd1, 0x2c, 0x15, 0x45, 0x90, 0xbc,
+    0x9e, 0xbf, 0xe9, 0xfa, 0x18, 0x63, 0xca, 0xb1, 0x50, 0x0f, 0xa7, 0x04, 0xb4, 0x20, 0xeb, 0x2b,
+    0x27, 0x4f, 0x8a, 0x7d, 0x5f, 0xa2, 0xe4, 0x30, 0xc8, 0x8b, 0x4a, 0xb8, 0xd7, 0x59, 0x11, 0x23,
+    0x34, 0x8b, 0x0f, 0xc5, 0xe0, 0xb7, 0x99, 0x95, 0x9d, 0x01, 0x94, 0x4e, 0xe5, 0xbf, 0x44, 0x01,
+    0xb7, 0x5f, 0xb8, 0x1b, 0xf6, 0x04, 0x14, 0x53, 0x09, 0xd0, 0x2c, 0x83, 0xb3, 0x21, 0xe0, 0x7d,
+    0x6d, 0x18, 0xad, 0x3d, 0x01, 0x58, 0x4c, 0x11, 0xc4, 0xff, 0x85, 0x94, 0x77, 0xb7, 0x46, 0x6e,
+    0x02, 0x5c, 0x96, 0x4a, 0x27, 0x77, 0xe6, 0x26, 0xc0, 0xb0, 0x50, 0x3a, 0x77, 0xdc, 0xdf, 0x19,
+    0x01, 0x86, 0x9b, 0xf2, 0xd6, 0x0b, 0x40, 0x15, 0x11, 0x7f, 0x82, 0x2f, 0xa4, 0x05, 0xf6, 0x85,
+    0xad, 0x09, 0x52, 0x58, 0x5a, 0xa0, 0x45, 0xac, 0xdb, 0xf6, 0xbc, 0x24, 0x42, 0x08, 0x7d, 0xae,
+    0x49, 0xeb, 0x2c, 0xdf, 0x61, 0xb6, 0x18, 0x83, 0xfe, 0x93, 0x29, 0xb6, 0xb1, 0x08, 0xad, 0xcc,
+    0xfc, 0x1c, 0x40, 0xb2, 0xb4, 0xf2, 0xc4, 0x76, 0x21, 0xe4, 0x35, 0x99, 0x80, 0x01, 0x56, 0x2e,
+    0x7e, 0xdf, 0xd1, 0x4e, 0x1c, 0x92, 0x64, 0xb4, 0x52, 0x2c, 0xa0, 0xfd, 0x38, 0xac, 0xf5, 0x0b,
+    0x5e, 0x25, 0xbb, 0x5e, 0xe0, 0x2f, 0xb9, 0x09, 0x98, 0x49, 0x86, 0xbf, 0xe2, 0x13, 0x58, 0xef,
+    0xa3, 0xb0, 0xdc, 0x04, 0x4c, 0x62, 0xfa, 0x47, 0xd5, 0x7c, 0x4a, 0xf6, 0x8f, 0x65, 0xb8, 0x33,
+    0x02, 0x30, 0x93, 0x89, 0x72, 0x2d, 0x9e, 0x2d, 0x05, 0xc9, 0xbf, 0x49, 0xb1, 0x9b, 0xc8, 0x3f,
+    0xb8, 0x2a, 0xda, 0xe2, 0x0f, 0x00, 0x1d, 0x49, 0xf1, 0x9f, 0x6f, 0x64, 0x61, 0x57, 0x00, 0x8b,
+    0x79, 0x47, 0x0c, 0xe7, 0x0c, 0x3f, 0xf1, 0xb8, 0x0b, 0x80, 0xca, 0x59, 0x1c, 0x6e, 0xf3, 0xea,
+    0xa5, 0xef, 0xf1, 0x84, 0x87, 0x86, 0x00, 0x9b, 0xa5, 0xb0, 0x0a, 0x01, 0xed, 0x4d, 0x9c, 0x0b,
+    0x84, 0x5a, 0x95, 0x96, 0x95, 0xcb, 0x79, 0x5f, 0x9f, 0xad, 0x51, 0x82, 0x8b, 0xdf, 0x67, 0x3d,
+    0x7b, 0x02, 0x4a, 0x19, 0x1d, 0xb9, 0xfd, 0x82, 0x80, 0x62, 0x99, 0x14, 0x23, 0xb1, 0x9a, 0x46,
+    0x6b, 0x59, 0x67, 0x04, 0x54, 0x54, 0xc2, 0x22, 0x0d, 0xb7, 0xa4, 0x20, 0xf9, 0x52, 0x14, 0xd7,
+    0x2d, 0xe0, 0xa0, 0x15, 0x6c, 0x07, 0x00, 0xf3, 0x94, 0x5d, 0x27, 0x3e, 0x63, 0x7c, 0x20, 0x9a,
+    0x59, 0xe5, 0x6b, 0xf0, 0x42, 0x06, 0xdf, 0x03, 0x0c, 0x87, 0xf9, 0x93, 0x8d, 0x7e, 0xe7, 0x71,
+    0x92, 0x89, 0xc1, 0xd0, 0x10, 0xa0, 0x5d, 0x0c, 0xad, 0x10, 0xd0, 0x20, 0x43, 0x04, 0x5d, 0x0f,
+    0xb1, 0x98, 0x3b, 0x3e, 0x96, 0x05, 0xfb, 0x96, 0x23, 0xed, 0x09, 0x18, 0xc9, 0x7b, 0x9e, 0xce,
+    0x08, 0x18, 0xca, 0x5f, 0x64, 0xe1, 0x86, 0xfd, 0x9d, 0x11, 0x80, 0xa3, 0xf2, 0xcc, 0x4a, 0x0b,
+    0x52, 0x0a, 0xca, 0xb8, 0x2e, 0xb6, 0xe2, 0x3a, 0xcd, 0x8a, 0x03, 0xc5, 0x92, 0x94, 0x13, 0x8a,
+    0xef, 0xef, 0x7b, 0x93, 0x2b, 0x0b, 0x5c, 0xd3, 0xac, 0xcd, 0x1e, 0xcb, 0x8c, 0x17, 0x30, 0x8a,
+    0x19, 0x2f, 0xd8, 0x6a, 0x1e, 0x34, 0xb7, 0x84, 0x0d, 0x01, 0x9a, 0xe5, 0xf0, 0x32, 0x01, 0xd5,
+    0xee, 0x73, 0xa2, 0x48, 0xf7, 0x37, 0x67, 0x36, 0xc9, 0xf3, 0xcb, 0x5b, 0xad, 0xbd, 0x9a, 0x41,
+    0x92, 0x9c, 0x0e, 0x44, 0xb2, 0x77, 0xb5, 0xf0, 0x38, 0x63, 0xec, 0xf2, 0x60, 0xd1, 0x5e, 0x6d,
+    0x46, 0x51, 0x3e, 0xd3, 0xa2, 0xb2, 0x93, 0xf6, 0xb6, 0x17, 0x04, 0x2c, 0xa3, 0xd5, 0x6c, 0xb6,
+    0x58, 0xac, 0x56, 0x52, 0xd9, 0x26, 0x2d, 0x37, 0x01, 0xc3, 0x98, 0x2d, 0x0c, 0xe6, 0x6a, 0xa9,
+    0xc1, 0x03, 0xab, 0x78, 0x04, 0x80, 0xaf, 0x29, 0x1e, 0x15, 0x78, 0x14, 0x80, 0x4f, 0x8e, 0xba,
+    0x31, 0x48, 0x1b, 0xf2, 0x00, 0xe3, 0x02, 0xd5, 0x4a, 0x7a, 0x94, 0x3f, 0x95, 0x4d, 0xd3, 0x44,
+    0x96, 0x01, 0xc0, 0x20, 0xe5, 0x81, 0x0a, 0x01, 0xbe, 0xd9, 0x69, 0x9e, 0xb6, 0x04, 0x04, 0xc7,
+    0x58, 0x95, 0xe0, 0xc3, 0x1e, 0x39, 0x0f, 0x6a, 0xe6, 0xf1, 0xfd, 0xf3, 0x15, 0xd3, 0xf8, 0x6f,
+    0x20, 0x92, 0xcb, 0xc4, 0x3a, 0xaf, 0xa4, 0xda, 0x00, 0xd6, 0x6b, 0x16, 0xae, 0x03, 0x05, 0xa5,
+    0xa9, 0xe2, 0x4f, 0xc9, 0x40, 0x60, 0xbd, 0xc6, 0xa6, 0x4e, 0x76, 0x4a, 0x40, 0x40, 0x96, 0x58,
+    0xfd, 0xe0, 0x93, 0xaa, 0x7c, 0xc5, 0x5b, 0xcc, 0xf6, 0x02, 0x5e, 0xe7, 0x26, 0xe0, 0x8e, 0xd1,
+    0x1b, 0x08, 0x21, 0x55, 0x0b, 0xf7, 0x0d, 0xa5, 0x05, 0x45, 0xb2, 0xe9, 0xcc, 0x62, 0x2c, 0x8f,
+    0xda, 0x8c, 0xb4, 0xeb, 0x66, 0x29, 0xe1, 0xd6, 0x0a, 0x01, 0xea, 0x96, 0x18, 0x5a, 0x23, 0xf8,
+    0x78, 0x68, 0x44, 0x7e, 0xfe, 0x4a, 0x61, 0x77, 0x20, 0x5c, 0x10, 0xc0, 0xd8, 0xee, 0x7e, 0xbe,
+    0x5d, 0x62, 0x78, 0xd5, 0x0b, 0xf8, 0xd2, 0xa6, 0x06, 0x6c, 0x60, 0x66, 0x68, 0x31, 0xaf, 0xc6,
+    0xc7, 0xc5, 0xb4, 0x47, 0x18, 0xd7, 0x3d, 0xd2, 0x0f, 0x00, 0xb0, 0x41, 0x2c, 0xa2, 0xe9, 0x4b,
+    0x53, 0x31, 0xb9, 0x61, 0x93, 0xaf, 0x01, 0x33, 0x19, 0x0a, 0x6c, 0x62, 0x73, 0x60, 0x06, 0x7f,
+    0x57, 0xef, 0x50, 0x96, 0x36, 0x06, 0x1d, 0x98, 0x48, 0x66, 0x55, 0xb1, 0x11, 0xa7, 0x6e, 0x30,
+    0xda, 0x2f, 0x17, 0x01, 0x23, 0x35, 0x7b, 0xa6, 0xe5, 0x93, 0x80, 0x69, 0xf2, 0xd6, 0x68, 0xa7,
+    0x04, 0x01, 0x62, 0xcf, 0xa4, 0xea, 0x66, 0xbe, 0x0d, 0x8c, 0x64, 0xa2, 0x5a, 0xb3, 0x2a, 0x5b,
+    0x39, 0x10, 0x00, 0x0a, 0xc4, 0x92, 0x81, 0x40, 0x28, 0xef, 0xb8, 0x3d, 0x86, 0x20, 0xf2, 0x35,
+    0x1a, 0xbf, 0x00, 0x60, 0x00, 0x76, 0x27, 0xca, 0x7a, 0x7f, 0x2c, 0x9a, 0x01, 0xcd, 0x70, 0x04,
+    0xf8, 0x59, 0x1c, 0x69, 0x3e, 0xf9, 0x43, 0xa0, 0xf1, 0xab, 0x36, 0xf5, 0x33, 0x01, 0xcb, 0xb5,
+    0x3b, 0xf3, 0xb8, 0xac, 0x2d, 0x97, 0xde, 0x35, 0x97, 0xbe, 0x89, 0xef, 0xd0, 0x11, 0x4f, 0x08,
+    0x2f, 0x88, 0xf0, 0x82, 0x76, 0x52, 0x10, 0xe1, 0xf6, 0x73, 0x00, 0x70, 0x69, 0x13, 0x3a, 0x02,
+    0xdf, 0xe6, 0x14, 0xfd, 0x97, 0x52, 0xb0, 0x83, 0xe1, 0xc6, 0x1a, 0x00, 0xc8, 0x98, 0x27, 0xca,
+    0x19, 0x4b, 0x4c, 0xca, 0x93, 0x00, 0x21, 0xfb, 0xfd, 0x18, 0x8f, 0xfe, 0x40, 0x89, 0x56, 0x50,
+    0x2d, 0xdb, 0x61, 0x34, 0x83, 0xc7, 0x2b, 0x29, 0xe7, 0x81, 0x23, 0x68, 0x06, 0x8f, 0x57, 0xa1,
+    0x6e, 0x5e, 0xd2, 0x6a, 0x18, 0x2e, 0xb8, 0xac, 0xd0, 0xee, 0x50, 0x62, 0xc9, 0x80, 0xcd, 0xa4,
+    0xf2, 0x8c, 0xb6, 0x18, 0xec, 0x20, 0x60, 0x22, 0xf6, 0xb7, 0xe0, 0xba, 0x4f, 0x48, 0xc0, 0x19,
+    0xb4, 0x9f, 0x5c, 0xca, 0xab, 0xda, 0xac, 0x6d, 0x4a, 0x5a, 0xfa, 0x53, 0x1d, 0x88, 0x9b, 0x8f,
+    0xa9, 0x5f, 0xd5, 0xf7, 0x0e, 0xac, 0x37, 0x23, 0x0c, 0xa8, 0x86, 0x5f, 0xad, 0x9a, 0x12, 0x71,
+    0xb3, 0x31, 0x7d, 0x6d, 0x13, 0x3f, 0xcf, 0x72, 0xcd, 0x66, 0x29, 0x21, 0xf3, 0x37, 0xd5, 0x2d,
+    0x31, 0x1f, 0xca, 0x4b, 0xad, 0xe6, 0xf1, 0x1a, 0xf0, 0xbe, 0xb2, 0x22, 0x09, 0xc0, 0x30, 0xa6,
+    0xbb, 0x35, 0xe1, 0x2e, 0x00, 0xae, 0x29, 0x19, 0xee, 0x8d, 0x49, 0xc5, 0xc6, 0xfb, 0xdd, 0xe4,
+    0xca, 0x52, 0x29, 0xb6, 0x3b, 0x68, 0xd9, 0x0a, 0x70, 0x1d, 0xac, 0xda, 0xf5, 0x34, 0x6a, 0x13,
+    0x50, 0xb6, 0xc6, 0xca, 0x7f, 0x13, 0x70, 0x39, 0x28, 0x0c, 0xd9, 0xc5, 0xef, 0x45, 0x13, 0x78,
+    0x4b, 0x64, 0xf7, 0x66, 0x3c, 0x00, 0xd7, 0x30, 0xd5, 0x13, 0xdc, 0x40, 0x49, 0x16, 0x2b, 0x27,
+    0x79, 0x82, 0x73, 0xad, 0x72, 0x40, 0x8d, 0x5c, 0x03, 0x92, 0x20, 0x4b, 0x19, 0xbe, 0x01, 0x48,
+    0x92, 0xdb, 0x40, 0x85, 0x46, 0xe8, 0x8f, 0x0d, 0x39, 0x9a, 0x1a, 0x50, 0xa0, 0x5e, 0x53, 0x1c,
+    0x01, 0x60, 0x39, 0xe1, 0x53, 0xb7, 0x29, 0xe2, 0x14, 0x1b, 0xb0, 0xa0, 0x6c, 0xec, 0xb8, 0xb8,
+    0x0f, 0x30, 0xc9, 0x69, 0x00, 0x4d, 0x85, 0x35, 0x86, 0x43, 0x13, 0x1d, 0x9e, 0xf9, 0x0e, 0x9d,
+    0x9e, 0xb0, 0x06, 0x58, 0xdb, 0xce, 0xb8, 0x62, 0x4a, 0x3b, 0x3b, 0xf5, 0x65, 0x69, 0xaa, 0x54,
+    0x9a, 0x8b, 0x2a, 0x89, 0x34, 0x00, 0x96, 0x61, 0xad, 0x36, 0xc5, 0xe6, 0xdc, 0x3b, 0x35, 0x65,
+    0x28, 0x90, 0xa6, 0x9e, 0x12, 0x55, 0x7c, 0x62, 0xbd, 0xe5, 0x57, 0x32, 0xb3, 0x7e, 0x3f, 0xf0,
+    0xa1, 0xb2, 0x24, 0x2c, 0x8c, 0xf2, 0x4a, 0xb4, 0xb6, 0xea, 0x66, 0xa0, 0x67, 0xf8, 0xc5, 0x4b,
+    0xea, 0xaa, 0x44, 0x61, 0x2b, 0xdf, 0xdf, 0xcd, 0x46, 0x00, 0x30, 0x99, 0xef, 0xff, 0x40, 0x65,
+    0x6e, 0xa7, 0x35, 0xd9, 0x06, 0x30, 0x1c, 0xe2, 0x31, 0x17, 0xc7, 0x35, 0xc0, 0xe7, 0x2c, 0xe3,
+    0x8a, 0xc3, 0x61, 0x0d, 0x40, 0x8c, 0xd2, 0x97, 0xe4, 0xb3, 0x06, 0xd8, 0x22, 0x52, 0xf6, 0x28,
+    0xd6, 0xc9, 0x2b, 0x6e, 0x15, 0x8c, 0xe3, 0x75, 0xf1, 0x5e, 0xef, 0xaa, 0x9b, 0x9b, 0xd9, 0xa1,
+    0x8d, 0xbc, 0xdb, 0xa6, 0xeb, 0x21, 0x46, 0xcb, 0xce, 0xdb, 0x68, 0x3e, 0x58, 0x46, 0x9b, 0x90,
+    0x98, 0xcd, 0xdc, 0x95, 0x92, 0xe5, 0x21, 0x04, 0xa0, 0x5d, 0xc9, 0xca, 0x2a, 0x41, 0xff, 0x18,
+    0x2e, 0x87, 0xf0, 0x7c, 0x47, 0x3b, 0x26, 0x60, 0x0d, 0x73, 0x1a, 0xc2, 0x09, 0x01, 0xcb, 0x94,
+    0x5d, 0xb6, 0x9e, 0x92, 0x00, 0x4b, 0x4d, 0x00, 0xa8, 0x6a, 0x16, 0x7b, 0xfb, 0x68, 0xbb, 0x64,
+    0x0a, 0x8f, 0xcf, 0xfb, 0xb6, 0x53, 0x02, 0x0c, 0x07, 0x99, 0x3d, 0xa9, 0x82, 0xbb, 0x6f, 0xf3,
+    0x08, 0xaa, 0x9b, 0xa7, 0x15, 0xc9, 0xa1, 0xc5, 0x56, 0x71, 0x0b, 0xa5, 0x45, 0xda, 0x0c, 0xc6,
+    0xdb, 0x68, 0x21, 0xe5, 0xa0, 0xbd, 0x15, 0xbc, 0xe5, 0x2f, 0x8d, 0x7d, 0xd2, 0xca, 0x3a, 0x22,
+    0x20, 0x94, 0x76, 0x72, 0xa9, 0x96, 0x80, 0xb6, 0x8a, 0xa4, 0xff, 0x94, 0x04, 0x30, 0xa6, 0xab,
+    0xaf, 0x6f, 0xe7, 0x9b, 0xbc, 0x96, 0x6b, 0x99, 0xee, 0x26, 0x66, 0x8c, 0x2a, 0xea, 0xd9, 0xe8,
+    0x28, 0x9d, 0x12, 0x80, 0xe2, 0xa7, 0xe4, 0xa9, 0x0f, 0xcd, 0x36, 0x2d, 0x36, 0x6b, 0xd3, 0x01,
+    0xa0, 0x16, 0xc9, 0x99, 0xe2, 0xf0, 0x38, 0x79, 0x57, 0xad, 0x3e, 0xad, 0xa5, 0xd1, 0xef, 0x6f,
+    0xdc, 0xed, 0x88, 0x80, 0x44, 0x9b, 0xe1, 0x70, 0x3f, 0x5b, 0x02, 0xe4, 0x4d, 0x52, 0x9f, 0x9a,
+    0x80, 0xcf, 0xb3, 0x49, 0x92, 0x0f, 0x72, 0xf7, 0x2a, 0x85, 0x23, 0xc5, 0x93, 0xff, 0xe3, 0x9c,
+    0x00, 0xb8, 0x0d, 0xfc, 0x21, 0x3e, 0x27, 0x3d, 0xea, 0x0b, 0xad, 0xeb, 0xf9, 0x0f, 0xca, 0x1b,
+    0xaa, 0xca, 0x15, 0xe5, 0xbe, 0xb2, 0x15, 0xde, 0x3c, 0xca, 0x83, 0x85, 0x80, 0xdb, 0xea, 0xaa,
+    0xf1, 0xba, 0x66, 0x65, 0x78, 0xa1, 0x25, 0x20, 0x29, 0x2f, 0x02, 0xe4, 0x6d, 0x72, 0x9f, 0x9a,
+    0x80, 0xde, 0x35, 0xd6, 0xc7, 0xe7, 0xc4, 0xad, 0x70, 0xb4, 0x16, 0xa0, 0xc0, 0x8c, 0xcb, 0xc6,
+    0x07, 0x11, 0x1d, 0x83, 0xf2, 0x20, 0xe0, 0x8f, 0x85, 0x0d, 0x01, 0xf2, 0x46, 0xc9, 0x4f, 0x47,
+    0xc0, 0xdf, 0x0b, 0xb2, 0x22, 0x24, 0x2a, 0xa8, 0x39, 0xc9, 0xd5, 0x5e, 0x12, 0xfb, 0x43, 0xe1,
+    0xf6, 0x27, 0xb3, 0x71, 0xdf, 0x0d, 0x3a, 0x74, 0xfc, 0xf9, 0xf0, 0x9b, 0x7f, 0xcd, 0xc8, 0x04,
+    0x00, 0xf0, 0xfd, 0x28, 0x5a, 0x95, 0x4f, 0x6c, 0x95, 0xa6, 0x08, 0xa9, 0x3f, 0x8f, 0x60, 0xa8,
+    0xc3, 0x53, 0x91, 0xec, 0x5d, 0x79, 0x4d, 0x9c, 0x31, 0x66, 0x71, 0x21, 0x18, 0xde, 0x3e, 0x96,
+    0x9c, 0x71, 0xac, 0xbd, 0x64, 0xa0, 0xcb, 0x84, 0xc5, 0x18, 0x13, 0x37, 0x49, 0xd1, 0x3a, 0xae,
+    0x83, 0x0f, 0xdc, 0xcf, 0x89, 0xdb, 0xd4, 0x48, 0xb6, 0xde, 0x1a, 0x25, 0xc7, 0x4e, 0xbc, 0x89,
+    0x64, 0xef, 0x4a, 0xab, 0x6e, 0x1a, 0xaf, 0x01, 0xf0, 0x7e, 0xff, 0x64, 0x8a, 0xf1, 0xd6, 0xc1,
+    0x77, 0x85, 0x86, 0xf8, 0xb3, 0xec, 0xed, 0xa4, 0x4b, 0xf2, 0x75, 0x39, 0xd2, 0x0b, 0x28, 0x65,
+    0x96, 0x77, 0x14, 0xf4, 0x49, 0xe5, 0x1b, 0xc0, 0x55, 0x21, 0xd2, 0x2d, 0x23, 0x1b, 0x0a, 0x7f,
+    0x60, 0x0a, 0x80, 0xe9, 0xbc, 0x5f, 0x06, 0x00, 0x5c, 0xf6, 0xf3, 0x98, 0xa6, 0xf5, 0xed, 0x23,
+    0xc9, 0x04, 0x00, 0x45, 0xce, 0x69, 0xe5, 0x93, 0xfc, 0x12, 0xb0, 0x24, 0x53, 0x0c, 0x50, 0x0a,
+    0x6c, 0x16, 0x6e, 0x45, 0x57, 0x00, 0x91, 0x5c, 0x28, 0xb6, 0xfe, 0x4b, 0xa9, 0x0e, 0x00, 0xbe,
+    0xfb, 0xa5, 0xfe, 0x70, 0x92, 0x20, 0x40, 0xab, 0xe4, 0xd8, 0x89, 0x37, 0x91, 0x5c, 0x9a, 0x49,
+    0xf2, 0x77, 0xc0, 0xf3, 0x94, 0x1a, 0xc0, 0xe1, 0x9c, 0x00, 0xec, 0x96, 0xc5, 0xf4, 0xfe, 0xbc,
+    0xe3, 0x0a, 0x7c, 0xce, 0x45, 0x00, 0x70, 0x85, 0x9c, 0x02, 0xc0, 0x70, 0x8f, 0x8d, 0x00, 0xb8,
+    0x44, 0xf0, 0xb8, 0x3b, 0x80, 0x19, 0x12, 0x11, 0x02, 0x35, 0x69, 0xe9, 0x26, 0xe2, 0xf4, 0xb6,
+    0x32, 0x63, 0x64, 0x51, 0xaf, 0x06, 0x47, 0xf8, 0x44, 0x04, 0xf0, 0x52, 0xfb, 0xc2, 0xc5, 0xdf,
+    0x33, 0xf3, 0x92, 0x79, 0x7e, 0x35, 0x9f, 0xfa, 0x67, 0x78, 0xc3, 0x05, 0x88, 0x24, 0xaf, 0x76,
+    0x2d, 0x11, 0xd8, 0x25, 0x5e, 0x88, 0xf4, 0x5f, 0xd3, 0x34, 0x29, 0xd8, 0xb3, 0xf6, 0xf7, 0xc2,
+    0xe9, 0xb4, 0x55, 0x72, 0xec, 0xc4, 0x9b, 0x48, 0xf2, 0x6a, 0xe7, 0x00, 0x00, 0x18, 0xce, 0x8c,
+    0xe1, 0xa5, 0x3c, 0x4a, 0x36, 0xfe, 0x74, 0x7e, 0x9e, 0x04, 0xf4, 0xe4, 0x3d, 0x31, 0x26, 0xdf,
+    0xcf, 0xb9, 0x00, 0xba, 0xf3, 0x22, 0x80, 0xd2, 0x8c, 0xe1, 0x21, 0x00, 0x75, 0x99, 0xea, 0x06,
+    0x00, 0xc5, 0xe3, 0xb9, 0x00, 0x68, 0x69, 0xb1, 0x6a, 0x3b, 0x9d, 0x3e, 0xf2, 0x5c, 0x50, 0x55,
+    0xc9, 0x71, 0xf6, 0xba, 0xe5, 0x80, 0x00, 0x7b, 0xd7, 0x23, 0x37, 0x01, 0x89, 0x85, 0x00, 0x60,
+    0xad, 0xa4, 0xb6, 0x55, 0x25, 0x6b, 0x02, 0x91, 0xbc, 0x57, 0x14, 0x00, 0x7a, 0xd1, 0xe8, 0x01,
+    0x54, 0xb2, 0x8a, 0x01, 0xb7, 0xcb, 0x3e, 0x5e, 0x84, 0xbd, 0x92, 0x63, 0x27, 0xde, 0x44, 0x32,
+    0x4b, 0xf2, 0xad, 0x97, 0xa8, 0x13, 0x15, 0x79, 0x11, 0xe0, 0x79, 0x5f, 0x2c, 0x3e, 0x29, 0x63,
+    0x65, 0x35, 0x00, 0x85, 0x2c, 0x2c, 0x01, 0x0c, 0xe6, 0xac, 0xdf, 0x8d, 0x05, 0x80, 0x0f, 0xe4,
+    0xad, 0x26, 0x9a, 0x9b, 0xd9, 0x39, 0x28, 0x81, 0x9f, 0x68, 0x05, 0x11, 0x1f, 0x59, 0xbe, 0x78,
+    0x03, 0xd7, 0xd7, 0x02, 0x40, 0xf6, 0xbc, 0x27, 0x32, 0x25, 0xab, 0x1e, 0x00, 0xc0, 0x51, 0x58,
+    0x3f, 0x05, 0x80, 0xe8, 0x7b, 0x28, 0x0f, 0x00, 0xab, 0xee, 0x01, 0xc0, 0x7e, 0x78, 0x94, 0x02,
+    0x3a, 0x18, 0xee, 0x2e, 0x05, 0x00, 0xeb, 0x74, 0x54, 0xaf, 0x60, 0xaf, 0xe4, 0xd8, 0x89, 0x37,
+    0xc0, 0x37, 0xd2, 0x9e, 0x9e, 0xb1, 0xa8, 0xa1, 0xb6, 0xd7, 0x7e, 0x6c, 0x8c, 0xe5, 0xd2, 0x6a,
+    0x18, 0x5b, 0x18, 0xd7, 0xe3, 0x2d, 0x00, 0x18, 0x68, 0x38, 0x11, 0x05, 0xe0, 0x41, 0x24, 0x42,
+    0x80, 0x10, 0x44, 0xec, 0xf7, 0x68, 0x06, 0x84, 0x60, 0xbf, 0x28, 0x75, 0x70, 0x3a, 0xbe, 0xda,
+    0x5a, 0xfc, 0xf8, 0x87, 0x2a, 0x01, 0x13, 0xb8, 0x02, 0xaf, 0x92, 0xec, 0x0e, 0x54, 0x45, 0xa4,
+    0x90, 0x4f, 0x64, 0x31, 0x18, 0x1a, 0x03, 0x66, 0xd3, 0x04, 0xe4, 0xb1, 0xe0, 0x3e, 0x5e, 0x54,
+    0x87, 0x40, 0xe2, 0x9d, 0x12, 0x71, 0x3b, 0x53, 0x3a, 0xf0, 0x01, 0x00, 0x31, 0xa6, 0x4c, 0xb2,
+    0xc0, 0x07, 0xa8, 0x86, 0x73, 0x62, 0x7b, 0x82, 0x93, 0x26, 0xb1, 0x2d, 0xbc, 0x56, 0xc9, 0xb1,
+    0x13, 0x6f, 0x00, 0x79, 0xaf, 0x97, 0x35, 0xc9, 0x2d, 0xaf, 0xfd, 0xa7, 0xfb, 0xa3, 0x03, 0x30,
+    0x56, 0xa3, 0x7d, 0x31, 0x00, 0x03, 0x20, 0x22, 0x47, 0xf6, 0x23, 0x04, 0x68, 0x99, 0x79, 0x2c,
+    0x02, 0x21, 0xf0, 0x6c, 0x02, 0x39, 0xa0, 0x68, 0xce, 0xbe, 0xc0, 0x46, 0x0f, 0x7a, 0x99, 0x1d,
+    0x4a, 0x62, 0x7e, 0x90, 0x22, 0xfd, 0xe5, 0x70, 0xa8, 0x06, 0xe7, 0x87, 0x96, 0xf6, 0x28, 0xda,
+    0xe3, 0x84, 0x13, 0xb1, 0xa3, 0xf4, 0xd1, 0x90, 0x83, 0x8d, 0xd5, 0xad, 0x57, 0xb3, 0xed, 0xfe,
+    0x8a, 0xc8, 0x66, 0x6d, 0xca, 0x1f, 0xd2, 0xce, 0xf6, 0xe6, 0x54, 0xf8, 0x03, 0x90, 0x9f, 0x77,
+    0x07, 0x7e, 0x9a, 0xa7, 0xcb, 0xbb, 0xdf, 0xcb, 0x82, 0x64, 0xdc, 0x6b, 0x3f, 0x04, 0x8f, 0xdd,
+    0x7c, 0x3b, 0x6a, 0x9c, 0x3b, 0x80, 0x70, 0xc3, 0x51, 0x0c, 0x35, 0x18, 0x0c, 0x55, 0x73, 0xbf,
+    0xce, 0x2f, 0xe7, 0xdd, 0xfa, 0x01, 0x4d, 0x2b, 0x66, 0x89, 0x38, 0xcc, 0x08, 0xb4, 0xc2, 0x8b,
+    0xc5, 0x0f, 0xe7, 0xec, 0x67, 0x2b, 0x34, 0xf2, 0x4e, 0x90, 0xe9, 0xb4, 0xee, 0x03, 0x76, 0xde,
+    0xd6, 0x68, 0x82, 0xf3, 0x0d, 0x43, 0x71, 0xd2, 0x60, 0x30, 0x6c, 0xd1, 0xc8, 0x27, 0xf2, 0xb4,
+    0xea, 0x98, 0xc4, 0x6e, 0x25, 0x0b, 0x76, 0x4d, 0xf0, 0x77, 0xdc, 0x24, 0xea, 0x9c, 0xa8, 0xb9,
+    0xae, 0x4d, 0x72, 0x7e, 0x1a, 0x49, 0xaa, 0x2c, 0xcc, 0xb8, 0xf9, 0x8b, 0x66, 0xa7, 0x55, 0x72,
+    0xec, 0xc5, 0x1b, 0x15, 0xe7, 0xde, 0x28, 0xd2, 0x6e, 0xda, 0x81, 0xca, 0x0b, 0xd6, 0x39, 0x12,
+    0x30, 0x35, 0xee, 0xec, 0x6a, 0x0c, 0x02, 0xde, 0xc2, 0x36, 0xb1, 0x5b, 0xc5, 0x11, 0x63, 0xa9,
+    0xaa, 0x21, 0x88, 0x40, 0xd2, 0xb9, 0x5a, 0x45, 0x95, 0x16, 0x00, 0xd4, 0x9f, 0x05, 0x6b, 0xff,
+    0x8e, 0x8e, 0x45, 0xd1, 0x68, 0xd4, 0x11, 0x19, 0xf2, 0x9e, 0x65, 0x49, 0x8d, 0xb6, 0xc5, 0x27,
+    0x6f, 0x1f, 0x8b, 0xd6, 0x8e, 0xe2, 0xb1, 0xda, 0x1d, 0x29, 0xf9, 0xef, 0x7e, 0x39, 0xf9, 0xb2,
+    0x12, 0xd1, 0xa8, 0x25, 0x14, 0xeb, 0x57, 0xdd, 0x45, 0xd3, 0x90, 0xe6, 0xa1, 0xeb, 0xe3, 0x12,
+    0x10, 0x85, 0x97, 0x5c, 0xa0, 0xc9, 0xb4, 0x19, 0x40, 0xec, 0xf9, 0xa8, 0x65, 0x23, 0x76, 0xb7,
+    0xad, 0x89, 0x59, 0x10, 0x4a, 0x93, 0xb2, 0x3f, 0x4b, 0xb8, 0xa9, 0x66, 0x3d, 0x9f, 0x1e, 0x52,
+    0x0b, 0x40, 0xd6, 0x71, 0x84, 0x84, 0x20, 0x02, 0x88, 0x30, 0xb4, 0x0a, 0x51, 0x5a, 0x40, 0xe0,
+    0x26, 0x8f, 0x15, 0xd3, 0x0c, 0x5f, 0x95, 0x71, 0x48, 0xc0, 0x0f, 0xa8, 0xd0, 0x1b, 0x00, 0x3c,
+    0xe5, 0xed, 0x8f, 0xb5, 0x06, 0xcc, 0x1e, 0x43, 0xbf, 0xf3, 0x1a, 0xf6, 0x21, 0xf3, 0x67, 0x26,
+    0x77, 0xb2, 0xf8, 0x28, 0x00, 0x70, 0x99, 0x8a, 0xa8, 0x6b, 0x00, 0xd0, 0x45, 0x28, 0x39, 0x3d,
+    0xb1, 0x13, 0xd8, 0x85, 0x17, 0xfa, 0x02, 0x80, 0xb7, 0x93, 0xcd, 0x97, 0x4f, 0xa7, 0xab, 0x7b,
+    0x74, 0x03, 0x00, 0x6e, 0xa0, 0x25, 0x00, 0xb8, 0x8c, 0x97, 0x33, 0xee, 0xed, 0xc2, 0xa0, 0x6e,
+    0x7e, 0x31, 0xf2, 0xaf, 0xa9, 0xec, 0x47, 0xbb, 0x66, 0x89, 0xe7, 0x80, 0xfd, 0xe8, 0x5e, 0x4f,
+    0x21, 0x60, 0x55, 0xf9, 0xf3, 0xef, 0xce, 0x89, 0x28, 0xb4, 0xd1, 0xdd, 0x11, 0x01, 0x51, 0xdb,
+    0x10, 0xf6, 0x4e, 0x61, 0xcf, 0x57, 0xf7, 0xca, 0x0f, 0xd2, 0x1a, 0x30, 0x3b, 0xbc, 0x17, 0x96,
+    0xdd, 0x69, 0x79, 0x7e, 0xfb, 0x89, 0x2b, 0x6b, 0x31, 0xf7, 0xc3, 0x92, 0x1e, 0xb5, 0xb6, 0xbd,
+    0x0e, 0xa1, 0x22, 0xbb, 0xfc, 0xd0, 0xd5, 0xd7, 0xb7, 0xf3, 0x1e, 0xd7, 0xeb, 0x6b, 0x81, 0xcb,
+    0x9b, 0xf1, 0xc5, 0xa8, 0xa2, 0x9e, 0x8d, 0x22, 0xec, 0xcd, 0xdd, 0xea, 0x95, 0x9d, 0xab, 0xfa,
+    0xfa, 0xd4, 0xfe, 0xda, 0xcf, 0x72, 0xce, 0x4e, 0x53, 0x1d, 0x15, 0x1a, 0x14, 0xd0, 0x74, 0x7f,
+    0x88, 0xc6, 0x0c, 0xf6, 0x19, 0x86, 0xaf, 0xa8, 0x12, 0xe0, 0xbb, 0x9f, 0xc0, 0x61, 0x53, 0x57,
+    0xd7, 0x2b, 0xd2, 0x3a, 0xae, 0x31, 0x5d, 0xd2, 0x7b, 0x64, 0x59, 0xfb, 0x26, 0x34, 0xf8, 0x58,
+    0x73, 0xa3, 0x21, 0x3c, 0x21, 0x2b, 0x61, 0xe7, 0x15, 0xf9, 0xc4, 0x47, 0xd3, 0xd9, 0x9b, 0x59,
+    0x33, 0x97, 0x23, 0x94, 0xcc, 0x98, 0x0a, 0xf6, 0xae, 0x30, 0x00, 0xa0, 0xbb, 0xdc, 0x43, 0x5d,
+    0x60, 0x6f, 0xfb, 0x7b, 0xc0, 0xef, 0x90, 0xe4, 0xd4, 0x4d, 0x73, 0xa0, 0xe4, 0xd8, 0x8a, 0x37,
+    0xaa, 0xab, 0xb1, 0x53, 0x96, 0x53, 0xc6, 0xdb, 0xfa, 0x01, 0x7e, 0x51, 0x24, 0x49, 0xeb, 0x1c,
+    0x65, 0x78, 0xed, 0x96, 0x40, 0x5a, 0x15, 0xc1, 0xde, 0x35, 0x85, 0x62, 0x96, 0xfd, 0x30, 0xe5,
+    0x1d, 0x5f, 0x5e, 0x36, 0xb2, 0x2f, 0x00, 0xb4, 0x90, 0x3d, 0x21, 0xbb, 0x89, 0x91, 0xa4, 0x86,
+    0xb3, 0xae, 0x1a, 0x1f, 0xec, 0x7b, 0x23, 0x0c, 0xe6, 0xcc, 0x47, 0xfc, 0x33, 0xc7, 0xed, 0x2b,
+    0x7d, 0xa4, 0x7a, 0xbe, 0x5d, 0x85, 0xb4, 0x56, 0xc3, 0x0e, 0x3f, 0x34, 0xc5, 0x6f, 0x69, 0x26,
+    0xcd, 0x45, 0x1c, 0xaa, 0xb7, 0x21, 0xc1, 0x74, 0x67, 0x65, 0xed, 0x5f, 0x01, 0xe0, 0x7e, 0xe3,
+    0x8f, 0xae, 0xe4, 0x3c, 0xdc, 0xdf, 0x69, 0xae, 0xdd, 0x45, 0x6f, 0x0d, 0xda, 0x16, 0x9d, 0x91,
+    0x73, 0x73, 0x5d, 0x93, 0x05, 0x36, 0xb6, 0x0f, 0x69, 0x4d, 0x96, 0xc4, 0x98, 0x92, 0xbe, 0x6f,
+    0xaa, 0xc6, 0x41, 0x98, 0xc3, 0x81, 0xc3, 0x8a, 0x60, 0x6f, 0x39, 0x04, 0x51, 0xf3, 0x23, 0xa4,
+    0xbf, 0x08, 0xdc, 0xe4, 0xb1, 0x62, 0x2d, 0x00, 0x1c, 0x98, 0x69, 0xf8, 0xba, 0x8c, 0x83, 0x1a,
+    0xa0, 0x0a, 0x35, 0xe7, 0xf1, 0x88, 0x1a, 0xd0, 0xdb, 0x73, 0x07, 0xef, 0xbd, 0x84, 0x5c, 0xae,
+    0x41, 0x3e, 0xa5, 0x2c, 0x47, 0xd9, 0x8f, 0x50, 0xaf, 0xf6, 0xd8, 0xed, 0x94, 0xf7, 0x54, 0x70,
+    0x3c, 0x37, 0xe8, 0x35, 0x41, 0xed, 0x35, 0x9c, 0xc2, 0xd8, 0x7d, 0x7d, 0x91, 0x9f, 0x1a, 0xfe,
+    0x09, 0x63, 0xd7, 0x2b, 0xe8, 0x53, 0xd9, 0xed, 0xff, 0x44, 0x40, 0xf1, 0xdd, 0x3d, 0x2a, 0x79,
+    0x06, 0xb6, 0x3b, 0xfc, 0x62, 0xf6, 0xd2, 0x47, 0x5f, 0x6b, 0xee, 0xb7, 0x3c, 0xf0, 0xc7, 0x16,
+    0x7f, 0x3c, 0x01, 0x6b, 0xac, 0xf5, 0x2f, 0x9b, 0x1c, 0xb8, 0xc2, 0xff, 0x0b, 0x49, 0xcc, 0xd0,
+    0x56, 0xcc, 0xd8, 0x9b, 0x87, 0x5e, 0x7d, 0x8c, 0x8b, 0xad, 0xc3, 0x32, 0xc6, 0xfe, 0xd0, 0x75,
+    0xf7, 0x1f, 0x4d, 0xc0, 0xe9, 0x0e, 0x13, 0xea, 0x04, 0xba, 0xfc, 0x7f, 0x6a, 0x40, 0x42, 0x9b,
+    0xf5, 0x51, 0x69, 0xd9, 0x37, 0x56, 0xd7, 0x0d, 0x7f, 0xbc, 0xcb, 0xdf, 0x9b, 0xe5, 0xb5, 0xa3,
+    0xdb, 0x1f, 0x5e, 0x05, 0x76, 0xb7, 0x2a, 0xec, 0xea, 0xc8, 0x15, 0xfe, 0x83, 0x70, 0x80, 0xc3,
+    0x9e, 0x21, 0x31, 0xec, 0x09, 0x6a, 0x52, 0x49, 0x24, 0x3d, 0xcf, 0xf2, 0xa1, 0xef, 0x40, 0x5a,
+    0xcb, 0x3c, 0xc7, 0xdf, 0x3f, 0x96, 0xe4, 0x96, 0x67, 0xe9, 0x83, 0xf2, 0xdd, 0x9f, 0x5a, 0xee,
+    0x6c, 0x7d, 0x9e, 0x97, 0x46, 0xe8, 0x78, 0x16, 0x11, 0x94, 0x23, 0xff, 0x7a, 0x94, 0x6f, 0x1a,
+    0xdb, 0x48, 0x33, 0x95, 0xda, 0xad, 0x9f, 0x8b, 0x2d, 0xbe, 0x98, 0x66, 0x0d, 0x01, 0xd2, 0xe9,
+    0x0b, 0x30, 0xeb, 0xe6, 0x46, 0x27, 0xa1, 0x5d, 0x05, 0xfe, 0xae, 0x0c, 0x6c, 0x90, 0xc3, 0x7e,
+    0x87, 0xf3, 0x9a, 0x41, 0x4b, 0x80, 0xb4, 0x91, 0xe8, 0x49, 0x8a, 0x1f, 0x1e, 0x15, 0x04, 0x90,
+    0x4c, 0x51, 0x42, 0x7e, 0x7a, 0x1d, 0x48, 0x49, 0xda, 0xd3, 0x43, 0x18, 0x92, 0x5e, 0xff, 0xfe,
+    0xbb, 0x12, 0xd0, 0x8c, 0xe9, 0x22, 0xca, 0xe5, 0x17, 0xed, 0x0f, 0x61, 0x75, 0xb1, 0xc4, 0x0b,
+    0x59, 0xa4, 0x2a, 0x39, 0xba, 0xa0, 0x01, 0x12, 0x01, 0xf0, 0x6e, 0xf1, 0x50, 0x8e, 0x83, 0x2f,
+    0xb2, 0x47, 0xfa, 0x3d, 0xa3, 0x7f, 0x56, 0xf1, 0xae, 0x17, 0x9e, 0xe7, 0x6f, 0x45, 0xfe, 0xb5,
+    0x71, 0x5e, 0xfc, 0x24, 0xe4, 0xcb, 0xcc, 0x56, 0x37, 0xdb, 0x6c, 0x9c, 0x95, 0x2a, 0x8d, 0x75,
+    0x3b, 0xcb, 0xbf, 0x57, 0x9b, 0x2e, 0xfd, 0x1a, 0xd8, 0x37, 0x72, 0xd4, 0xdf, 0x04, 0xe3, 0xa2,
+    0x97, 0xbc, 0x2b, 0x8e, 0xb9, 0x22, 0x68, 0x38, 0x53, 0xf6, 0x6f, 0x4b, 0xc0, 0x08, 0x46, 0x02,
+    0xc0, 0x0a, 0xcd, 0x6f, 0x6b, 0x55, 0xbd, 0x9f, 0x23, 0xc5, 0xfe, 0xe0, 0x4d, 0x9e, 0xb5, 0x25,
+    0x60, 0x81, 0xdc, 0x64, 0xba, 0x88, 0xdd, 0x2b, 0x0d, 0xed, 0x77, 0x24, 0x64, 0x9c, 0x1a, 0xf1,
+    0x37, 0x9e, 0xe9, 0xf7, 0x4d, 0x61, 0x03, 0xc0, 0x3f, 0x5d, 0x84, 0x01, 0x02, 0x40, 0xc9, 0x9b,
+    0x56, 0x25, 0x1a, 0xbe, 0x9f, 0xa0, 0x47, 0x25, 0x60, 0xbe, 0x4d, 0x38, 0xfa, 0xb3, 0x30, 0x16,
+    0x48, 0x5f, 0x83, 0xe1, 0x40, 0xbf, 0x02, 0xe7, 0xe4, 0xdf, 0x8d, 0xf6, 0xff, 0xa1, 0xec, 0x87,
+    0xe1, 0x78, 0x8e, 0x50, 0x9d, 0x99, 0x81, 0x88, 0x94, 0x77, 0x10, 0x84, 0xc7, 0x7e, 0xed, 0x6c,
+    0xe4, 0x70, 0x9e, 0xb4, 0xad, 0x01, 0xb3, 0x9f, 0xea, 0x27, 0xc3, 0xfe, 0x9a, 0x38, 0xc0, 0x77,
+    0x1b, 0x30, 0x55, 0x0a, 0xd9, 0x33, 0xac, 0xe3, 0x16, 0xcd, 0x28, 0x71, 0xb1, 0xbc, 0xd5, 0xb6,
+    0x4c, 0xc0, 0x18, 0x9e, 0x7d, 0xe6, 0x08, 0xe8, 0xce, 0x8b, 0xab, 0x95, 0xd5, 0x0b, 0x0b, 0x78,
+    0x58, 0x5d, 0x70, 0xe0, 0xdf, 0x35, 0x43, 0xde, 0x04, 0x51, 0x26, 0xa0, 0x9a, 0x95, 0x53, 0x82,
+    0x0c, 0xcf, 0x16, 0x01, 0x6e, 0x71, 0x34, 0xcb, 0xfb, 0x87, 0x8f, 0xe5, 0x45, 0xf5, 0x67, 0x31,
+    0x48, 0xa6, 0x7c, 0xe2, 0x6a, 0x4b, 0x00, 0xfa, 0xdd, 0x10, 0x9e, 0xd1, 0x33, 0x24, 0x88, 0x98,
+    0xc3, 0xe0, 0x7a, 0x54, 0x9a, 0x76, 0xf9, 0x18, 0xd5, 0x1f, 0x68, 0x5d, 0x61, 0x9a, 0xec, 0xe7,
+    0xbf, 0x4c, 0x7c, 0xe6, 0x9a, 0x00, 0x4a, 0x92, 0xd2, 0xb6, 0xd5, 0xc8, 0xb6, 0x19, 0x0b, 0x04,
+    0xf6, 0xc9, 0x90, 0x8d, 0xa3, 0x5c, 0x03, 0x2a, 0x5b, 0x38, 0xbd, 0x84, 0xcb, 0x33, 0x46, 0x40,
+    0x88, 0xc3, 0xc5, 0x86, 0x00, 0x80, 0x85, 0x72, 0x70, 0x89, 0x4c, 0xc0, 0xbb, 0xca, 0x62, 0xba,
+    0x67, 0xa7, 0x09, 0xe0, 0x3d, 0xac, 0x36, 0x3a, 0x73, 0x94, 0x61, 0xf7, 0x23, 0xd6, 0xc5, 0x71,
+    0xe1, 0x59, 0x53, 0x84, 0x7c, 0x86, 0xb4, 0x37, 0x2f, 0x73, 0x56, 0xc4, 0x08, 0xbb, 0xba, 0xe1,
+    0x89, 0x9c, 0x67, 0x8b, 0x80, 0xa0, 0x78, 0x00, 0x8b, 0x6e, 0x3e, 0x9f, 0x6a, 0x88, 0xa8, 0x01,
+    0xd6, 0xdb, 0x5f, 0xcf, 0x74, 0x5a, 0xc4, 0x6a, 0xbf, 0x89, 0xa1, 0x01, 0xd6, 0x67, 0x8b, 0x80,
+    0x84, 0xbc, 0x9d, 0x9a, 0x0c, 0xd8, 0xfd, 0x3c, 0x5f, 0x11, 0xa4, 0x3d, 0x7b, 0x46, 0x30, 0x0f,
+    0x5c, 0x46, 0xc9, 0x11, 0x81, 0x6a, 0xd2, 0xab, 0x59, 0x47, 0x5c, 0x79, 0xbe, 0x9a, 0x49, 0x1e,
+    0x92, 0xd8, 0x73, 0x51, 0x03, 0xd0, 0x69, 0x49, 0x54, 0x86, 0xea, 0xfb, 0x19, 0x63, 0x36, 0xb7,
+    0xb8, 0xfb, 0x7c, 0x1a, 0x4c, 0x65, 0x2c, 0xf0, 0x2c, 0xc1, 0x05, 0x3a, 0x74, 0xe8, 0xd0, 0xa1,
+    0x43, 0x87, 0x0e, 0x1d, 0x3a, 0x74, 0xe8, 0xd0, 0xa1, 0x43, 0x87, 0x0e, 0x1d, 0x3a, 0x74, 0xe8,
+    0xd0, 0xa1, 0x43, 0x87, 0x0e, 0x1d, 0x3a, 0x74, 0xe8, 0xd0, 0xa1, 0x43, 0x87, 0x0e, 0x1d, 0x3a,
+    0x74, 0xe8, 0xd0, 0xa1, 0x43, 0x87, 0x0e, 0x1d, 0x3a, 0x74, 0xe8, 0xd0, 0xa1, 0x43, 0x87, 0x0e,
+    0x1d, 0x3a, 0x74, 0xe8, 0xd0, 0xa1, 0x43, 0x87, 0x0e, 0x1d, 0x3a, 0x74, 0xe8, 0xd0, 0xa1, 0x43,
+    0x87, 0x0e, 0x1d, 0x3a, 0x74, 0xe8, 0xd0, 0xa1, 0x43, 0x87, 0x0e, 0x1d, 0x3a, 0x74, 0xe8, 0xd0,
+    0xa1, 0x43, 0x87, 0x0e, 0x1d, 0x3a, 0x74, 0xe8, 0xd0, 0xa1, 0x43, 0x87, 0x0e, 0x1d, 0x3a, 0x74,
+    0xe8, 0xd0, 0xa1, 0x43, 0x87, 0x0e, 0x1d, 0x3a, 0x74, 0xe8, 0xd0, 0xa1, 0x43, 0x87, 0x0e, 0x1d,
+    0x3a, 0x74, 0xe8, 0xd0, 0xa1, 0x43, 0xc7, 0x5f, 0x0e, 0xff, 0x05, 0x39, 0x0c, 0x29, 0xfb, 0xca,
+    0x08, 0x83, 0x73, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+const int              g_textAtlasSourceSize = sizeof(g_textAtlasSource);
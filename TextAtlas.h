@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Printable ASCII (32..126) rendered from DejaVu Sans at 24 pixels into an
+ * 8-bit coverage atlas. Glyph boxes are the inked pixels in the atlas; the
+ * offsets place a box relative to the pen at the top of the line, and the
+ * advance moves the pen on to the next character.
+ */
+enum
+{
+    text_first_char = 32,
+    text_glyph_count = 95,
+};
+
+struct TextGlyph
+{
+    uint16_t            x;
+    uint16_t            y;
+    uint8_t             width;
+    uint8_t             height;
+    int8_t              offsetX;
+    int8_t              offsetY;
+    float               advance;
+};
+
+extern const float      g_textAtlasLineHeight;     /* ascent + descent at the atlas size */
+extern const int        g_textAtlasWidth;
+extern const int        g_textAtlasHeight;
+extern const TextGlyph  g_textGlyphs[text_glyph_count];
+extern const uint8_t    g_textAtlasSource[];        /* the atlas as a grayscale png */
+extern const int        g_textAtlasSourceSize;
@@ -0,0 +1,62 @@
+#include "TextFormat.h"
+#include <cassert>
+
+static const uint64_t   g_pow10[] = { 1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull,
+                                      1000000ull, 10000000ull, 100000000ull, 1000000000ull };
+
+char* appendString(char* dst, const char* str)
+{
+    while(*str)
+        *dst ++ = *str ++;
+    return dst;
+}
+
+char* appendUIntPadded(char* dst, uint64_t value, int width)
+{
+    // digits come out in reverse, so build them at the end of a scratch buffer
+    char buf[text_uint_max];
+    char* p = buf + sizeof(buf);
+    do {
+        *(-- p) = (char)('0' + value % 10);
+        value /= 10;
+        width --;
+    } while(value);
+    while(width -- > 0)
+        *dst ++ = '0';
+    while(p < buf + sizeof(buf))
+        *dst ++ = *p ++;
+    return dst;
+}
+
+char* appendUInt(char* dst, uint64_t value)
+{
+    return appendUIntPadded(dst, value, 1);
+}
+
+char* appendInt(char* dst, int64_t value)
+{
+    if(value < 0) {
+        *dst ++ = '-';
+        return appendUInt(dst, 0 - (uint64_t)value);
+    }
+    return appendUInt(dst, (uint64_t)value);
+}
+
+char* appendRatio(char* dst, uint64_t num, uint64_t den, int decimals)
+{
+    assert(den != 0 && decimals >= 0 && decimals <= 9);
+    uint64_t whole = num / den;
+    uint64_t rem = num % den;
+    uint64_t scale = g_pow10[decimals];
+    // rem < den, so this only overflows for denominators beyond 2^64 / 2e9
+    uint64_t frac = (rem * scale * 2 + den) / (den * 2);
+    if(frac >= scale) {
+        whole ++;
+        frac -= scale;
+    }
+    dst = appendUInt(dst, whole);
+    if(decimals == 0)
+        return dst;
+    *dst ++ = '.';
+    return appendUIntPadded(dst, frac, decimals);
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Allocation-free number formatting for the per-frame text paths. Every
+ * function writes at dst, does not terminate the string and returns the
+ * position after the last character written; callers size their buffers with
+ * the maxima below. Only integer arithmetic is used, so results are exact and
+ * do not depend on the current locale.
+ */
+enum
+{
+    text_uint_max = 20,                     /* digits of UINT64_MAX */
+    text_fixed_max = text_uint_max + 1 + 9, /* plus point and up to 9 decimals */
+};
+
+char* appendString(char* dst, const char* str);
+char* appendUInt(char* dst, uint64_t value);
+char* appendInt(char* dst, int64_t value);
+// value zero padded to at least width digits
+char* appendUIntPadded(char* dst, uint64_t value, int width);
+// num / den rounded to the given number of decimals (0..9); den must not be 0
+char* appendRatio(char* dst, uint64_t num, uint64_t den, int decimals);
@@ -0,0 +1,161 @@
+#include "TextLayout.h"
+#include "TextAtlas.h"
+#include <string.h>
+
+// FNV-1a over the text and the size
+static uint32_t runHash(const char* text, uint32_t length, float size)
+{
+    uint32_t hash = 2166136261u;
+    for(uint32_t i = 0; i < length; i ++) {
+        hash ^= (uint8_t)text[i];
+        hash *= 16777619u;
+    }
+    uint32_t bits;
+    memcpy(&bits, &size, sizeof(bits));
+    for(int i = 0; i < 4; i ++, bits >>= 8) {
+        hash ^= bits & 0xff;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+TextLayoutCache::TextLayoutCache()
+{
+    clear();
+}
+
+void TextLayoutCache::clear()
+{
+    m_arenaUsed = 0;
+    for(int i = 0; i < table_size; i ++)
+        m_runs[i].text = nullptr;
+    m_runCount = 0;
+}
+
+void* TextLayoutCache::allocate(uint32_t bytes)
+{
+    // quads hold floats, keep every block 4 byte aligned
+    bytes = (bytes + 3) & ~3u;
+    if(m_arenaUsed + bytes > arena_size)
+        return nullptr;
+    void* p = m_arena + m_arenaUsed;
+    m_arenaUsed += bytes;
+    return p;
+}
+
+bool TextLayoutCache::build(TextRun& run, const char* text, uint32_t length, float size)
+{
+    uint32_t quadCount = 0;
+    for(uint32_t i = 0; i < length; i ++) {
+        uint32_t c = (uint8_t)text[i] - text_first_char;
+        if(c < text_glyph_count && g_textGlyphs[c].width > 0)
+            quadCount ++;
+    }
+    char* copy = (char*)allocate(length + 1);
+    TextGlyphQuad* quads = (TextGlyphQuad*)allocate(quadCount * sizeof(TextGlyphQuad));
+    if(!copy || (quadCount > 0 && !quads))
+        return false;
+    memcpy(copy, text, length);
+    copy[length] = 0;
+
+    float scale = size / g_textAtlasLineHeight;
+    float pen = 0.f;
+    TextGlyphQuad* quad = quads;
+    for(uint32_t i = 0; i < length; i ++) {
+        uint32_t c = (uint8_t)text[i] - text_first_char;
+        if(c >= text_glyph_count)
+            continue;
+        const TextGlyph& glyph = g_textGlyphs[c];
+        if(glyph.width > 0) {
+            quad->x0 = pen + glyph.offsetX * scale;
+            quad->y0 = glyph.offsetY * scale;
+            quad->x1 = quad->x0 + glyph.width * scale;
+            quad->y1 = quad->y0 + glyph.height * scale;
+            quad->u0 = glyph.x;
+            quad->v0 = glyph.y;
+            quad->u1 = (float)(glyph.x + glyph.width);
+            quad->v1 = (float)(glyph.y + glyph.height);
+            quad ++;
+        }
+        pen += glyph.advance * scale;
+    }
+
+    run.text = copy;
+    run.length = length;
+    run.size = size;
+    run.width = pen;
+    run.quads = quads;
+    run.quadCount = quadCount;
+    return true;
+}
+
+const TextRun* TextLayoutCache::layout(const char* text, float size)
+{
+    uint32_t length = (uint32_t)strlen(text);
+    uint32_t hash = runHash(text, length, size);
+    uint32_t slot = hash & (table_size - 1);
+    for(;;) {
+        TextRun& run = m_runs[slot];
+        if(!run.text)
+            break;
+        if(run.hash == hash && run.length == length && run.size == size && memcmp(run.text, text, length) == 0)
+            return &run;
+        slot = (slot + 1) & (table_size - 1);
+    }
+    // at three quarters full probing gets long; start over rather than evict
+    if(m_runCount >= table_size * 3 / 4) {
+        clear();
+        slot = hash & (table_size - 1);
+    }
+    TextRun& run = m_runs[slot];
+    if(!build(run, text, length, size)) {
+        clear();
+        slot = hash & (table_size - 1);
+        if(!build(m_runs[slot], text, length, size))
+            return nullptr;     /* longer than the whole arena */
+    }
+    m_runs[slot].hash = hash;
+    m_runCount ++;
+    return &m_runs[slot];
+}
+
+static inline void setVertex(TextVertex& vertex, float x, float y, float u, float v, const float color[4])
+{
+    vertex.position[0] = x;
+    vertex.position[1] = y;
+    memcpy(vertex.color, color, sizeof(vertex.color));
+    vertex.tex[0] = u;
+    vertex.tex[1] = v;
+}
+
+uint32_t placeRun(const TextRun& run, float x, float y, const float color[4], TextVertex* vertices, uint32_t maxQuads)
+{
+    uint32_t quadCount = run.quadCount < maxQuads ? run.quadCount : maxQuads;
+    TextVertex* vertex = vertices;
+    for(uint32_t i = 0; i < quadCount; i ++, vertex += 4) {
+        const TextGlyphQuad& quad = run.quads[i];
+        // top left, top right, bottom left, bottom right, as the number quads
+        setVertex(vertex[0], x + quad.x0, y + quad.y0, quad.u0, quad.v0, color);
+        setVertex(vertex[1], x + quad.x1, y + quad.y0, quad.u1, quad.v0, color);
+        setVertex(vertex[2], x + quad.x0, y + quad.y1, quad.u0, quad.v1, color);
+        setVertex(vertex[3], x + quad.x1, y + quad.y1, quad.u1, quad.v1, color);
+    }
+    return quadCount;
+}
+
+void TextBatch::add(const char* text, float x, float y, float size, const float color[4])
+{
+    const TextRun* run = m_cache.layout(text, size);
+    if(!run)
+        return;
+    size_t first = m_vertices.size();
+    m_vertices.resize(first + run->quadCount * 4);
+    if(run->quadCount > 0)
+        placeRun(*run, x, y, color, &m_vertices[first], run->quadCount);
+}
+
+float TextBatch::measure(const char* text, float size)
+{
+    const TextRun* run = m_cache.layout(text, size);
+    return run ? run->width : 0.f;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+// one glyph of a laid out string, in pixels from the top left of the line and atlas texels
+struct TextGlyphQuad
+{
+    float               x0;
+    float               y0;
+    float               x1;
+    float               y1;
+    float               u0;
+    float               v0;
+    float               u1;
+    float               v1;
+};
+
+struct TextRun
+{
+    const char*         text;               /* copy in the arena */
+    uint32_t            length;
+    uint32_t            hash;
+    float               size;               /* line height in pixels */
+    float               width;              /* advance of the whole string */
+    const TextGlyphQuad* quads;
+    uint32_t            quadCount;          /* spaces and characters outside the atlas have none */
+};
+
+/*
+ * Glyph runs of the strings drawn recently, keyed by text and size. Runs and
+ * their text live in a fixed arena and an open addressing table; a label that
+ * is drawn every frame is laid out once and then found with one hash and one
+ * compare. When either fills up everything is dropped at once and the
+ * strings still in use are laid out again, so nothing is ever freed singly.
+ * Plain C++ without D3D types, it builds and runs anywhere.
+ */
+class TextLayoutCache
+{
+public:
+    enum
+    {
+        arena_size = 16384,
+        table_bits = 7,
+        table_size = 1 << table_bits,
+    };
+
+    TextLayoutCache();
+    const TextRun* layout(const char* text, float size);
+    void clear();
+    uint32_t runCount() const { return m_runCount; }
+
+private:
+    void* allocate(uint32_t bytes);
+    bool build(TextRun& run, const char* text, uint32_t length, float size);
+
+private:
+    uint8_t             m_arena[arena_size];
+    uint32_t            m_arenaUsed;
+    TextRun             m_runs[table_size];     /* text == nullptr marks a free slot */
+    uint32_t            m_runCount;
+};
+
+struct TextVertex
+{
+    float               position[2];        /* pixels */
+    float               color[4];
+    float               tex[2];             /* atlas texels */
+};
+
+// four vertices per glyph of run with the line's top left at x, y, at most maxQuads glyphs; returns the glyphs written
+uint32_t placeRun(const TextRun& run, float x, float y, const float color[4], TextVertex* vertices, uint32_t maxQuads);
+
+/*
+ * Strings to draw this frame, any mix of positions, sizes and colors, turned
+ * into one vertex array so the renderer needs a single draw for all of them.
+ * The vertex storage keeps its capacity between frames.
+ */
+class TextBatch
+{
+public:
+    void clear() { m_vertices.clear(); }
+    // x, y is the top left of the line in pixels, size its height
+    void add(const char* text, float x, float y, float size, const float color[4]);
+    // pixel width of text at size, without drawing it
+    float measure(const char* text, float size);
+    const TextVertex* vertices() const { return m_vertices.empty() ? nullptr : &m_vertices.front(); }
+    uint32_t quadCount() const { return (uint32_t)m_vertices.size() / 4; }
+
+private:
+    TextLayoutCache             m_cache;
+    std::vector<TextVertex>     m_vertices;
+};
@@ -0,0 +1,163 @@
+#include "BlockCompress.h"
+#include "OverlayGeometry.h"
+#include "TestCheck.h"
+#include <math.h>
+#include <string.h>
+
+// squared error of every pixel of a gray img against its decoding, and the largest single difference
+static double squaredError(const image& img, const std::vector<byte>& blocks, int& maxError)
+{
+    image decoded;
+    CHECK(decodeBC4(&blocks.front(), img.get_width(), img.get_height(), decoded));
+    double sum = 0.0;
+    maxError = 0;
+    for(int y = 0; y < img.get_height(); y ++) {
+        for(int x = 0; x < img.get_width(); x ++) {
+            int d = (int)img.get_data(x, y)[0] - (int)*decoded.get_data(x, y);
+            sum += d * d;
+            maxError = abs(d) > maxError ? abs(d) : maxError;
+        }
+    }
+    return sum;
+}
+
+static double psnr(double squared, int pixels)
+{
+    return squared > 0.0 ? 10.0 * log10(255.0 * 255.0 * pixels / squared) : 99.0;
+}
+
+// the plain encoder the search has to beat: the block's extremes as endpoints, eight levels
+static double extremesError(const image& img)
+{
+    double sum = 0.0;
+    for(int by = 0; by < img.get_height(); by += 4) {
+        for(int bx = 0; bx < img.get_width(); bx += 4) {
+            int lo = 255, hi = 0;
+            for(int y = by; y < by + 4 && y < img.get_height(); y ++) {
+                for(int x = bx; x < bx + 4 && x < img.get_width(); x ++) {
+                    int v = *img.get_data(x, y);
+                    lo = v < lo ? v : lo;
+                    hi = v > hi ? v : hi;
+                }
+            }
+            int palette[8] = { hi, lo };
+            for(int i = 2; i < 8; i ++)
+                palette[i] = ((8 - i) * hi + (i - 1) * lo + 3) / 7;
+            for(int y = by; y < by + 4 && y < img.get_height(); y ++) {
+                for(int x = bx; x < bx + 4 && x < img.get_width(); x ++) {
+                    int v = *img.get_data(x, y), best = 256;
+                    for(int i = 0; i < 8; i ++)
+                        best = abs(v - palette[i]) < best ? abs(v - palette[i]) : best;
+                    sum += best * best;
+                }
+            }
+        }
+    }
+    return sum;
+}
+
+// flat blocks and blocks of two values come back exactly
+static void testExactBlocks()
+{
+    image img;
+    CHECK(img.create(image::fmt_gray, 16, 4));
+    for(int x = 0; x < 16; x ++) {
+        for(int y = 0; y < 4; y ++)
+            *img.get_data(x, y) = x < 4 ? 0 : (x < 8 ? 255 : (x < 12 ? 77 : ((x + y) & 1 ? 200 : 13)));
+    }
+    std::vector<byte> blocks;
+    CHECK(encodeBC4(img, 0, blocks) && blocks.size() == 4 * bc4_block_bytes);
+    int maxError = 0;
+    CHECK(squaredError(img, blocks, maxError) == 0.0 && maxError == 0);
+}
+
+// an antialiased edge between empty and full coverage keeps 0 and 255 exact, which the
+// eight level mode cannot while also holding the ramp between them
+static void testCoverageEdge()
+{
+    image img;
+    CHECK(img.create(image::fmt_gray, 4, 4));
+    static const byte row[4] = { 0, 60, 190, 255 };
+    for(int y = 0; y < 4; y ++)
+        memcpy(img.get_data(0, y), row, 4);
+    std::vector<byte> blocks;
+    CHECK(encodeBC4(img, 0, blocks));
+    image decoded;
+    CHECK(decodeBC4(&blocks.front(), 4, 4, decoded));
+    CHECK(*decoded.get_data(0, 0) == 0 && *decoded.get_data(3, 3) == 255);
+    CHECK(blocks[0] <= blocks[1]);
+    int maxError = 0;
+    CHECK(squaredError(img, blocks, maxError) <= extremesError(img) && maxError <= 4);
+}
+
+// a size off the block grid repeats the last row and column, and a channel of rgba encodes as gray
+static void testEdgesAndChannels()
+{
+    image rgba;
+    CHECK(rgba.create(image::fmt_rgba, 7, 5));
+    for(int y = 0; y < 5; y ++) {
+        for(int x = 0; x < 7; x ++) {
+            byte* p = rgba.get_data(x, y);
+            p[0] = (byte)(x * 30);
+            p[1] = 0;
+            p[2] = 0;
+            p[3] = (byte)(y * 50);
+        }
+    }
+    std::vector<byte> blocks;
+    CHECK(!encodeBC4(rgba, 4, blocks));
+    CHECK(encodeBC4(rgba, 3, blocks) && blocks.size() == 2 * 2 * bc4_block_bytes);
+    CHECK(bc4Pitch(7) == 2 * bc4_block_bytes);
+    image decoded;
+    CHECK(decodeBC4(&blocks.front(), 7, 5, decoded) && decoded.get_width() == 8 && decoded.get_height() == 8);
+    // the padding decodes as the last row and column, the ramp in the alpha channel within a level
+    bool padded = true;
+    int worst = 0;
+    for(int y = 0; y < 8; y ++) {
+        for(int x = 0; x < 8; x ++) {
+            byte value = *decoded.get_data(x, y);
+            padded = padded && value == *decoded.get_data(x < 7 ? x : 6, y < 5 ? y : 4);
+            int d = abs(value - (y < 5 ? y : 4) * 50);
+            worst = d > worst ? d : worst;
+        }
+    }
+    CHECK(padded && worst <= 8);
+}
+
+// the overlay's atlases: distance fields whose quality the shaders' threshold depends on
+static void checkAtlas(const char* name, const image& atlas, double& pixels, double& ns)
+{
+    std::vector<byte> blocks;
+    CHECK(encodeBC4(atlas, 0, blocks));
+    int maxError = 0;
+    double error = squaredError(atlas, blocks, maxError);
+    double baseline = extremesError(atlas);
+    int count = atlas.get_width() * atlas.get_height();
+    CHECK(error <= baseline);
+    CHECK(psnr(error, count) >= 40.0);
+
+    const int rounds = 20;
+    double start = benchNs();
+    for(int r = 0; r < rounds; r ++)
+        encodeBC4(atlas, 0, blocks);
+    double elapsed = (benchNs() - start) / rounds;
+    pixels += count;
+    ns += elapsed;
+    printf("%s %dx%d: %.2f dB (extremes only %.2f dB), max error %d, %zu bytes for %d, %.1f Mpixel/s\n",
+        name, atlas.get_width(), atlas.get_height(), psnr(error, count), psnr(baseline, count), maxError,
+        blocks.size(), atlas.get_size(), count * 1000.0 / elapsed);
+}
+
+int main()
+{
+    testExactBlocks();
+    testCoverageEdge();
+    testEdgesAndChannels();
+
+    const OverlayGeometry& geometry = OverlayGeometry::instance();
+    double pixels = 0.0, ns = 0.0;
+    checkAtlas("number atlas", geometry.numberAtlas(), pixels, ns);
+    checkAtlas("text atlas", geometry.textAtlas(), pixels, ns);
+    printf("encode %.1f Mpixel/s\n", pixels * 1000.0 / ns);
+    return testResult("BlockCompressBench");
+}
@@ -0,0 +1,152 @@
+#include "ControlChannel.h"
+#include "TestCheck.h"
+#include <chrono>
+#include <future>
+#include <string>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+static int connectTo(const char* path)
+{
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    if(fd >= 0 && connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0) {
+        close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+// sends a request and reads lines until its one reply has arrived
+static std::string request(int fd, const char* line)
+{
+    std::string text = std::string(line) + "\n";
+    if(write(fd, text.data(), text.size()) != (ssize_t)text.size())
+        return "";
+    std::string reply;
+    char c;
+    while(read(fd, &c, 1) == 1 && c != '\n')
+        reply += c;
+    return reply;
+}
+
+// stop() has to return while the thread is blocked in a read of an idle client; the future
+// would wait for a hung stop() when destroyed, so a hang ends the process right here
+static void stopWithin(int seconds)
+{
+    std::future<void> done = std::async(std::launch::async, [] { ControlServer::instance().stop(); });
+    if(done.wait_for(std::chrono::seconds(seconds)) != std::future_status::ready) {
+        printf("stop() hangs with a client connected\n");
+        fflush(stdout);
+        _exit(1);
+    }
+}
+
+static void testConsume()
+{
+    ControlServer& server = ControlServer::instance();
+    ControlCommand cmd;
+    while(server.popCommand(cmd))
+        ;
+    std::string pending, replies;
+    server.consume(pending, "pi", 2, replies);
+    CHECK(replies.empty());
+    server.consume(pending, "ng\n\r\n  \ncapture stop\nbogus\n", 27, replies);
+    CHECK(replies == "ok pong\nok\nerror unknown command\n");
+    CHECK(server.popCommand(cmd) && cmd.type == cc_capture_stop);
+    CHECK(!server.popCommand(cmd));
+}
+
+static void testBenchmarkArgs()
+{
+    BenchmarkRequest req;
+    char label[CONTROL_ARG_SIZE];
+    const char* error = nullptr;
+    CHECK(ControlProtocol::parseBenchmark("60s delay 5 name warm run", req, label, sizeof(label), error));
+    CHECK(req.length == 60 && !req.byFrames && req.delaySec == 5 && strcmp(label, "warm run") == 0);
+    CHECK(ControlProtocol::parseBenchmark("1000000f", req, label, sizeof(label), error) && req.byFrames);
+    CHECK(ControlProtocol::parseBenchmark("3600s delay 3600", req, label, sizeof(label), error));
+    // out of range, and numbers that would overflow an int, are refused rather than clamped
+    CHECK(!ControlProtocol::parseBenchmark("3601s", req, label, sizeof(label), error) && strstr(error, "3600"));
+    CHECK(!ControlProtocol::parseBenchmark("1000001f", req, label, sizeof(label), error) && strstr(error, "3600"));
+    CHECK(!ControlProtocol::parseBenchmark("99999999999s", req, label, sizeof(label), error) && strstr(error, "3600"));
+    CHECK(!ControlProtocol::parseBenchmark("10s delay 3601", req, label, sizeof(label), error));
+    CHECK(!ControlProtocol::parseBenchmark("10s delay 99999999999", req, label, sizeof(label), error));
+    CHECK(!ControlProtocol::parseBenchmark("0s", req, label, sizeof(label), error));
+    CHECK(!ControlProtocol::parseBenchmark("10x", req, label, sizeof(label), error) && strstr(error, "usage"));
+    CHECK(!ControlProtocol::parseBenchmark("10sx", req, label, sizeof(label), error));
+}
+
+static void testSocket(const char* path)
+{
+    ControlServer& server = ControlServer::instance();
+    CHECK(server.start(path));
+    int fd = connectTo(path);
+    CHECK(fd >= 0);
+    if(fd < 0)
+        return;
+    CHECK(request(fd, "ping") == "ok pong");
+    CHECK(request(fd, "overlay graph") == "ok");
+    CHECK(request(fd, "overlay sideways").compare(0, 6, "error ") == 0);
+    ControlCommand cmd;
+    CHECK(server.popCommand(cmd) && cmd.type == cc_overlay_mode && cmd.value == om_graph);
+    CHECK(!server.popCommand(cmd));
+
+    // the client stays connected and silent
+    stopWithin(5);
+    char c;
+    CHECK(read(fd, &c, 1) == 0);
+    close(fd);
+    CHECK(access(path, F_OK) != 0);
+
+    // and starts again after a stop
+    CHECK(server.start(path));
+    fd = connectTo(path);
+    CHECK(fd >= 0 && request(fd, "ping") == "ok pong");
+    stopWithin(5);
+    if(fd >= 0)
+        close(fd);
+}
+
+// answered by the server thread from what the render thread last published, oldest first
+static void testTelemetry()
+{
+    ControlServer& server = ControlServer::instance();
+    std::string pending, replies;
+    server.consume(pending, "telemetry\n", 10, replies);
+    CHECK(replies == "ok 0\n");
+    TelemetrySample samples[TELEMETRY_SAMPLES];
+    for(int i = 0; i < TELEMETRY_SAMPLES; i ++) {
+        TelemetrySample sample = { 60 + i, 17 + i, 16000u + i, 17000u + i, 18000u + i };
+        samples[i] = sample;
+    }
+    server.publishTelemetry(samples, 2);
+    replies.clear();
+    server.consume(pending, "telemetry\n", 10, replies);
+    CHECK(replies == "ok 2 60,17,16000,17000,18000 61,18,16001,17001,18001\n");
+    server.publishTelemetry(samples, TELEMETRY_SAMPLES);
+    replies.clear();
+    server.consume(pending, "telemetry\n", 10, replies);
+    CHECK(replies.find("ok 60 60,17,16000,17000,18000 61,18,") == 0);
+    CHECK(replies.find(" 119,76,16059,17059,18059\n") == replies.size() - 26);
+    // nothing is queued for the render thread
+    ControlCommand cmd;
+    CHECK(!server.popCommand(cmd));
+}
+
+int main()
+{
+    char path[64];
+    snprintf(path, sizeof(path), "/tmp/d3d11hook-test-%d", (int)getpid());
+    testConsume();
+    testBenchmarkArgs();
+    testTelemetry();
+    testSocket(path);
+    return testResult("ControlChannelTest");
+}
@@ -0,0 +1,248 @@
+#include "DisplayTimeline.h"
+#include "TestCheck.h"
+#include <string.h>
+#include <vector>
+
+static const uint64_t   g_period = 166667;      /* 60 Hz in 100 ns ticks */
+static const uint64_t   g_origin = 1000000000;  /* ticks of vblank 0 */
+
+// drives a timeline with a scripted sequence of presents and statistics, collecting what it settles
+struct Script
+{
+    DisplayTimeline     timeline;
+    std::vector<FrameRecord> frames;
+    uint64_t            presented;
+
+    Script(): presented(0) {}
+
+    // the vblank that showed presentId, at refresh, statistics taken syncLag vblanks later
+    static DisplayStatsSample shown(uint32_t presentId, uint32_t refresh, uint32_t syncLag)
+    {
+        DisplayStatsSample sample;
+        sample.presentCount = presentId;
+        sample.presentRefreshCount = refresh;
+        sample.syncRefreshCount = refresh + syncLag;
+        sample.syncTime = vblankTime(refresh + syncLag);
+        return sample;
+    }
+    static uint64_t vblankTime(uint32_t refresh)
+    {
+        return g_origin + (uint64_t)refresh * g_period;
+    }
+    void present(uint32_t presentId, const DisplayStatsSample* sample)
+    {
+        FrameRecord rec;
+        memset(&rec, 0, sizeof(rec));
+        rec.presentStart = ++ presented;   /* submission order */
+        timeline.onPresent(rec, presentId, sample);
+        FrameRecord settled;
+        while(timeline.pop(settled))
+            frames.push_back(settled);
+    }
+    void flush()
+    {
+        timeline.flush();
+        FrameRecord settled;
+        while(timeline.pop(settled))
+            frames.push_back(settled);
+    }
+    // frames come out once each, in the order they were presented
+    bool inOrder() const
+    {
+        for(size_t i = 0; i < frames.size(); i ++) {
+            if(frames[i].presentStart != i + 1)
+                return false;
+        }
+        return true;
+    }
+    bool exact(const FrameRecord& frame, uint32_t refresh) const
+    {
+        uint64_t expected = vblankTime(refresh);
+        uint64_t error = frame.displayTime > expected ? frame.displayTime - expected : expected - frame.displayTime;
+        return !(frame.events & (fe_dropped | fe_display_unknown)) && frame.displayRefresh == refresh && error <= 1;
+    }
+};
+
+// one Present per vblank, every frame shown on the vblank after it; the statistics after
+// Present k report frame k - 1
+static void testSteady()
+{
+    Script script;
+    script.present(1, nullptr);
+    for(uint32_t k = 2; k <= 200; k ++) {
+        DisplayStatsSample sample = Script::shown(k - 1, 100 + k - 1, 0);
+        script.present(k, &sample);
+    }
+    CHECK(script.frames.size() == 199);
+    CHECK(script.inOrder());
+    bool allExact = true;
+    for(uint32_t id = 1; id <= 199; id ++)
+        allExact = allExact && script.exact(script.frames[id - 1], 100 + id);
+    CHECK(allExact);
+    CHECK_NEAR(script.timeline.refreshMs(10000000), 16.6667, 0.001);
+    CHECK(script.timeline.droppedCount() == 0);
+    script.flush();
+    CHECK(script.frames.size() == 200 && (script.frames[199].events & fe_display_unknown));
+}
+
+// statistics taken a vblank after the frame went up: placed back by the measured interval,
+// which the first sample does not have yet
+static void testSyncLag()
+{
+    Script script;
+    script.present(1, nullptr);
+    for(uint32_t k = 2; k <= 50; k ++) {
+        DisplayStatsSample sample = Script::shown(k - 1, 100 + k - 1, 1);
+        script.present(k, &sample);
+    }
+    CHECK(script.frames.size() == 49);
+    CHECK(script.frames[0].events & fe_display_unknown);
+    bool allExact = true;
+    for(uint32_t id = 2; id <= 49; id ++)
+        allExact = allExact && script.exact(script.frames[id - 1], 100 + id);
+    CHECK(allExact);
+}
+
+// uncapped at two Presents per vblank: each vblank shows the newer frame, the older one is dropped
+static void testDropped()
+{
+    Script script;
+    for(uint32_t k = 1; k <= 100; k ++) {
+        // the last vblank before Present k, and the frame it showed
+        uint32_t vblank = (k - 1) / 2;
+        DisplayStatsSample sample = Script::shown(2 * vblank, 100 + vblank, 0);
+        script.present(k, vblank ? &sample : nullptr);
+    }
+    CHECK(script.inOrder());
+    CHECK(script.frames.size() == 98);
+    // before the first sample there is no baseline to tell frame 1 was dropped
+    CHECK(script.frames[0].events & fe_display_unknown);
+    bool allRight = true;
+    for(uint32_t id = 2; id <= 98; id ++) {
+        const FrameRecord& frame = script.frames[id - 1];
+        allRight = allRight && ((id & 1) ? (frame.events & fe_dropped) && frame.displayTime == 0 : script.exact(frame, 100 + id / 2));
+    }
+    CHECK(allRight);
+    CHECK(script.timeline.droppedCount() == 48);
+}
+
+// sync interval 2 with statistics that advance on every other Present only: two frames per
+// sample, two vblanks apart
+static void testSyncIntervalTwo()
+{
+    Script script;
+    script.present(1, nullptr);
+    for(uint32_t k = 2; k <= 101; k ++) {
+        uint32_t latest = (k % 2 == 0 || k < 4) ? k - 1 : k - 2;
+        DisplayStatsSample sample = Script::shown(latest, 100 + 2 * latest, 0);
+        script.present(k, &sample);
+    }
+    CHECK(script.inOrder());
+    // the last sample, after Present 100, covers frame 99
+    CHECK(script.frames.size() == 99);
+    bool allExact = true;
+    for(uint32_t id = 1; id <= 99; id ++)
+        allExact = allExact && script.exact(script.frames[id - 1], 100 + 2 * id);
+    CHECK(allExact);
+}
+
+// a disjoint interval breaks the chain: the frame it hid is unknown, the timeline picks up at the next sample
+static void testDisjoint()
+{
+    Script script;
+    script.present(1, nullptr);
+    for(uint32_t k = 2; k <= 60; k ++) {
+        DisplayStatsSample sample = Script::shown(k - 1, 100 + k - 1, 0);
+        script.present(k, k == 30 ? nullptr : &sample);
+    }
+    CHECK(script.inOrder());
+    CHECK(script.frames.size() == 59);
+    int unknown = 0;
+    bool othersExact = true;
+    for(uint32_t id = 1; id <= 59; id ++) {
+        const FrameRecord& frame = script.frames[id - 1];
+        if(frame.events & fe_display_unknown)
+            unknown += id == 29 ? 1 : 100;
+        else
+            othersExact = othersExact && script.exact(frame, 100 + id);
+    }
+    CHECK(unknown == 1);
+    CHECK(othersExact);
+}
+
+// present ids and refresh counts wrap; id 0 reads as unavailable and only that frame is lost
+static void testWrap()
+{
+    Script script;
+    uint32_t first = 0xfffffff0u, refresh0 = 0xfffffff8u;
+    script.present(first, nullptr);
+    for(uint32_t i = 1; i <= 40; i ++) {
+        DisplayStatsSample sample = Script::shown(first + i - 1, refresh0 + i - 1, 0);
+        sample.syncTime = g_origin + (uint64_t)(i - 1) * g_period;
+        script.present(first + i, &sample);
+    }
+    CHECK(script.inOrder());
+    CHECK(script.frames.size() == 40);
+    int unknown = 0;
+    bool othersPlaced = true;
+    for(uint32_t i = 0; i < 40; i ++) {
+        const FrameRecord& frame = script.frames[i];
+        if(frame.events & fe_display_unknown) {
+            unknown += frame.presentId == 0 ? 1 : 100;
+            continue;
+        }
+        othersPlaced = othersPlaced && frame.displayRefresh == refresh0 + i && frame.displayTime == g_origin + (uint64_t)i * g_period;
+    }
+    CHECK(unknown == 1);
+    CHECK(othersPlaced);
+}
+
+// statistics that stop advancing: with pop() after every Present nothing is lost and the queue
+// gives up on the oldest frames, which come out unknown and in order
+static void testStalled()
+{
+    Script script;
+    script.present(1, nullptr);
+    for(uint32_t k = 2; k <= 10; k ++) {
+        DisplayStatsSample sample = Script::shown(k - 1, 100 + k - 1, 0);
+        script.present(k, &sample);
+    }
+    DisplayStatsSample stuck = Script::shown(9, 109, 0);
+    for(uint32_t k = 11; k <= 60; k ++)
+        script.present(k, &stuck);
+    CHECK(script.inOrder());
+    CHECK(script.frames.size() == 60 - DisplayTimeline::pending_size + 1);
+    bool stalledUnknown = true;
+    for(size_t i = 10; i < script.frames.size(); i ++)
+        stalledUnknown = stalledUnknown && (script.frames[i].events & fe_display_unknown);
+    CHECK(stalledUnknown);
+    CHECK(script.exact(script.frames[8], 109));
+    script.flush();
+    CHECK(script.frames.size() == 60 && script.inOrder());
+}
+
+// no statistics at all, as for a windowed blt model swapchain: every frame is unknown at once
+static void testUnavailable()
+{
+    Script script;
+    for(int k = 0; k < 20; k ++)
+        script.present(0, nullptr);
+    CHECK(script.frames.size() == 20 && script.inOrder());
+    bool allUnknown = true;
+    for(size_t i = 0; i < script.frames.size(); i ++)
+        allUnknown = allUnknown && script.frames[i].events == fe_display_unknown && script.frames[i].displayTime == 0;
+    CHECK(allUnknown);
+}
+
+int main()
+{
+    testSteady();
+    testSyncLag();
+    testDropped();
+    testSyncIntervalTwo();
+    testDisjoint();
+    testWrap();
+    testStalled();
+    testUnavailable();
+    return testResult("DisplayTimelineTest");
+}
@@ -0,0 +1,249 @@
+// the analyzer is a single file with its own main; its functions are tested in place
+#define main frameAnalyzerMain
+#include "FrameAnalyzer/FrameAnalyzer.cpp"
+#undef main
+#include "TestCheck.h"
+
+/*
+ * FrameAnalyzer's statistics on synthetic captures whose frame times are
+ * drawn independently from a log-normal around 16.7 ms, so the truth is
+ * known: a shift of the whole distribution must come out significant with
+ * an interval around it, runs from the same distribution must not, the
+ * Poisson bootstrap intervals of a percentile must cover the percentile of
+ * the distribution about as often as their confidence says and always the
+ * percentile of the frames, and a stretch of slow frames must line up the
+ * timelines of two runs.
+ */
+
+static const uint64_t   g_freq = 10000000;
+static const double     g_medianMs = 16.7;
+static const double     g_sigma = 0.1;
+static const double     g_z95 = 1.6448536;
+static const double     g_z99 = 2.3263479;
+
+// a version 4 capture of the given frame times in the working directory
+static std::string writeCapture(const char* name, const std::vector<double>& frameMs)
+{
+    std::string path = std::string("FrameAnalyzerTest_") + name + ".ftc";
+    std::vector<FrameRecord> records(frameMs.size() + 1);
+    memset(&records[0], 0, sizeof(FrameRecord) * records.size());
+    uint64_t tick = g_freq;
+    for(size_t i = 0; i < records.size(); i ++) {
+        if(i)
+            tick += (uint64_t)(frameMs[i - 1] * (double)g_freq / 1000.0 + 0.5);
+        records[i].presentStart = tick;
+        records[i].presentEnd = tick + g_freq / 1000;
+        records[i].syncInterval = 1;
+        records[i].presentId = (uint32_t)i + 1;
+    }
+    CaptureFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CAPTURE_MAGIC, sizeof(header.magic));
+    header.version = CAPTURE_VERSION;
+    header.recordSize = sizeof(FrameRecord);
+    header.tickFrequency = g_freq;
+    header.frameCount = records.size();
+    FILE* f = fopen(path.c_str(), "wb");
+    CHECK(f != nullptr);
+    if(f) {
+        CHECK(fwrite(&header, sizeof(header), 1, f) == 1);
+        CHECK(fwrite(&records[0], sizeof(FrameRecord), records.size(), f) == records.size());
+        fclose(f);
+    }
+    return path;
+}
+
+static std::vector<double> logNormalFrames(uint64_t seed, size_t count, double scale)
+{
+    Rng rng(seed);
+    std::vector<double> frameMs(count);
+    for(size_t i = 0; i < count; i ++)
+        frameMs[i] = g_medianMs * scale * exp(g_sigma * rng.normal());
+    return frameMs;
+}
+
+// the options FrameAnalyzer --bootstrap 1000 would run with
+static Options defaultOptions()
+{
+    const char* argv[] = { "FrameAnalyzer", "--bootstrap", "1000", "a.ftc", "b.ftc" };
+    Options opt;
+    std::vector<const char*> paths;
+    CHECK(parseOptions(5, (char**)argv, opt, paths));
+    return opt;
+}
+
+static const std::vector<double>& bucketValues()
+{
+    static std::vector<double> values;
+    if(values.empty()) {
+        values.resize(g_bucketCount);
+        for(int b = 0; b < g_bucketCount; b ++)
+            values[b] = bucketValue(b);
+    }
+    return values;
+}
+
+// what main does with one run before printing, without alignment
+static bool analyse(const std::string& path, int index, const Options& opt, CaptureRun& run, std::vector<double>& replicates)
+{
+    if(!loadRun(path.c_str(), run))
+        return false;
+    buildTimeline(run, opt.windowSec);
+    selectRange(run, opt, 0);
+    buildHistogram(run, opt.threads);
+    bootstrapRun(run, index, opt, &bucketValues()[0], replicates);
+    remove(path.c_str());
+    return run.frames > 1;
+}
+
+// a 2% slower run: Mann-Whitney sees it, and the intervals of the change exclude 0 and hold the 2%
+static void testShiftDetected()
+{
+    Options opt = defaultOptions();
+    CaptureRun base, slower;
+    std::vector<double> baseReplicates, slowerReplicates;
+    CHECK(analyse(writeCapture("base", logNormalFrames(1, 20000, 1.0)), 0, opt, base, baseReplicates));
+    CHECK(analyse(writeCapture("slower", logNormalFrames(2, 20000, 1.02)), 1, opt, slower, slowerReplicates));
+    MannWhitney mw = mannWhitney(base, slower);
+    printf("2%% shift: p = %.3g, P(faster) = %.3f\n", mw.pValue, mw.probBFaster);
+    CHECK(mw.pValue < 1e-6);
+    CHECK(mw.probBFaster < 0.5);
+    // the mean, p50 and p95; the tail percentiles of 20000 frames are too loose to resolve 2%
+    for(int m = 0; m < 3; m ++) {
+        double lo, hi;
+        deltaInterval(baseReplicates, slowerReplicates, m, opt, lo, hi);
+        printf("2%% shift: %s [%+.2f%%, %+.2f%%]\n", g_metricNames[m], lo, hi);
+        CHECK(lo > 0.0);
+        CHECK(lo < 2.0 && hi > 2.0);
+    }
+}
+
+// the same capture twice is no change at all, and of ten pairs of runs drawn from one distribution
+// hardly any may be flagged, 0.5 being expected at 5%
+static void testIdenticalRuns()
+{
+    Options opt = defaultOptions();
+    std::vector<double> frames = logNormalFrames(3, 20000, 1.0);
+    CaptureRun a, b;
+    std::vector<double> aReplicates, bReplicates;
+    CHECK(analyse(writeCapture("same_a", frames), 0, opt, a, aReplicates));
+    CHECK(analyse(writeCapture("same_b", frames), 1, opt, b, bReplicates));
+    MannWhitney mw = mannWhitney(a, b);
+    CHECK(mw.z == 0.0 && mw.pValue == 1.0);
+    CHECK_NEAR(mw.probBFaster, 0.5, 1e-12);
+    for(int m = 0; m < g_metricCount; m ++) {
+        double lo, hi;
+        deltaInterval(aReplicates, bReplicates, m, opt, lo, hi);
+        CHECK(lo <= 0.0 && hi >= 0.0);
+    }
+
+    int flaggedByTest = 0, flaggedByInterval = 0;
+    for(int pair = 0; pair < 10; pair ++) {
+        CaptureRun first, second;
+        std::vector<double> firstReplicates, secondReplicates;
+        CHECK(analyse(writeCapture("pair_a", logNormalFrames(100 + pair * 2, 5000, 1.0)), 0, opt, first, firstReplicates));
+        CHECK(analyse(writeCapture("pair_b", logNormalFrames(101 + pair * 2, 5000, 1.0)), 1, opt, second, secondReplicates));
+        if(mannWhitney(first, second).pValue < 0.05)
+            flaggedByTest ++;
+        double lo, hi;
+        deltaInterval(firstReplicates, secondReplicates, 0, opt, lo, hi);
+        if(lo > 0.0 || hi < 0.0)
+            flaggedByInterval ++;
+    }
+    printf("same distribution: %d of 10 pairs flagged by Mann-Whitney, %d by the interval of the mean\n",
+        flaggedByTest, flaggedByInterval);
+    CHECK(flaggedByTest <= 2);
+    CHECK(flaggedByInterval <= 2);
+}
+
+// the replicates of the mean spread as the standard error of the mean of independent frames does;
+// replicates that share their random streams spread less
+static void testBootstrapSpread()
+{
+    Options opt = defaultOptions();
+    std::vector<double> frames = logNormalFrames(4, 5000, 1.0);
+    double sum = 0.0, squares = 0.0;
+    for(size_t i = 0; i < frames.size(); i ++) {
+        sum += frames[i];
+        squares += frames[i] * frames[i];
+    }
+    double mean = sum / (double)frames.size();
+    double standardError = sqrt((squares / (double)frames.size() - mean * mean) / (double)frames.size());
+    CaptureRun run;
+    std::vector<double> replicates;
+    CHECK(analyse(writeCapture("spread", frames), 0, opt, run, replicates));
+    double replicateSum = 0.0, replicateSquares = 0.0;
+    for(int r = 0; r < opt.replicates; r ++) {
+        double v = replicates[(size_t)r * g_metricCount];
+        replicateSum += v;
+        replicateSquares += v * v;
+    }
+    double replicateMean = replicateSum / opt.replicates;
+    double spread = sqrt(replicateSquares / opt.replicates - replicateMean * replicateMean);
+    printf("bootstrap: standard error of the mean %.4f ms, replicates spread %.4f ms\n", standardError, spread);
+    CHECK(fabs(spread / standardError - 1.0) < 0.15);
+    CHECK_NEAR(replicateMean, mean, 3.0 * standardError);
+}
+
+// 95% intervals of p95 and p99 over 40 runs: each covers the percentile of its frames, and about 38
+// cover the distribution's; fewer than 34 has a chance of about 0.5%
+static void testPercentileCoverage()
+{
+    Options opt = defaultOptions();
+    static const int runs = 40;
+    const double truth[2] = { g_medianMs * exp(g_sigma * g_z95), g_medianMs * exp(g_sigma * g_z99) };
+    int covered[2] = { 0, 0 };
+    for(int i = 0; i < runs; i ++) {
+        std::vector<double> frames = logNormalFrames(1000 + i, 5000, 1.0);
+        CaptureRun run;
+        std::vector<double> replicates;
+        CHECK(analyse(writeCapture("coverage", frames), i, opt, run, replicates));
+        std::sort(frames.begin(), frames.end());
+        for(int q = 0; q < 2; q ++) {
+            double lo, hi;
+            metricInterval(replicates, 2 + q, opt, lo, hi);
+            double exact = frames[(size_t)(ceil(g_percentiles[1 + q] / 100.0 * (double)frames.size())) - 1];
+            CHECK(lo <= exact && exact <= hi);
+            if(lo <= truth[q] && truth[q] <= hi)
+                covered[q] ++;
+        }
+    }
+    printf("coverage: p95 %d of %d, p99 %d of %d\n", covered[0], runs, covered[1], runs);
+    CHECK(covered[0] >= 34);
+    CHECK(covered[1] >= 34);
+}
+
+// one minute at 60 fps with five seconds at 30 fps, from 20 s in one run and 23 s in the other
+static void testAlignment()
+{
+    Options opt = defaultOptions();
+    CaptureRun runs[2];
+    for(int r = 0; r < 2; r ++) {
+        Rng rng(7 + r);
+        std::vector<double> frameMs;
+        double t = 0.0;
+        double slowFrom = r ? 23000.0 : 20000.0;
+        while(t < 60000.0) {
+            double ms = (t >= slowFrom && t < slowFrom + 5000.0 ? 33.3 : 16.7) + 0.5 * rng.normal();
+            frameMs.push_back(ms);
+            t += ms;
+        }
+        std::string path = writeCapture(r ? "late" : "early", frameMs);
+        CHECK(loadRun(path.c_str(), runs[r]));
+        buildTimeline(runs[r], opt.windowSec);
+        remove(path.c_str());
+    }
+    CHECK(bestLag(runs[0].windowFps, runs[1].windowFps) == 3);
+    CHECK(bestLag(runs[1].windowFps, runs[0].windowFps) == -3);
+    CHECK(bestLag(runs[0].windowFps, runs[0].windowFps) == 0);
+}
+
+int main()
+{
+    testShiftDetected();
+    testIdenticalRuns();
+    testBootstrapSpread();
+    testPercentileCoverage();
+    testAlignment();
+    return testResult("FrameAnalyzerTest");
+}
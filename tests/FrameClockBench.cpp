@@ -0,0 +1,154 @@
+#include "FrameClock.h"
+#include "TestCheck.h"
+#include <time.h>
+
+/*
+ * FrameClock against clock_gettime(CLOCK_MONOTONIC), for the OS backend and,
+ * where the CPU has an invariant TSC, the TSC backend: intervals and
+ * fromOsTimestamp over a few seconds of real time, the same intervals
+ * converted after long simulated uptimes, conversions of tick counts up to
+ * the 64-bit limit against exact 128-bit arithmetic, and the cost of now().
+ */
+
+static const uint64_t   g_second = 1000000000ull;
+static const double     g_intervalSeconds = 2.5;
+static const int        g_nowCalls = 10000000;
+
+static uint64_t monotonicNs()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * g_second + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t absDiff(uint64_t a, uint64_t b)
+{
+    return a > b ? a - b : b - a;
+}
+
+// the clock's ticks and CLOCK_MONOTONIC read together, best of a few tries to dodge preemption
+static void samplePair(const FrameClock& clock, uint64_t& ticks, uint64_t& ns)
+{
+    uint64_t best = ~0ull;
+    for(int i = 0; i < 5; i ++) {
+        uint64_t n0 = monotonicNs();
+        uint64_t t = clock.now();
+        uint64_t n1 = monotonicNs();
+        if(n1 - n0 < best) {
+            best = n1 - n0;
+            ticks = t;
+            ns = n0 + (n1 - n0) / 2;
+        }
+    }
+}
+
+// exact ticks * 1e9 / frequency, and the other way round
+static uint64_t exactNs(uint64_t ticks, uint64_t frequency)
+{
+    return (uint64_t)((unsigned __int128)ticks * g_second / frequency);
+}
+
+static uint64_t exactTicks(uint64_t ns, uint64_t frequency)
+{
+    return (uint64_t)((unsigned __int128)ns * frequency / g_second);
+}
+
+// an interval of real time measured by both clocks, and a CLOCK_MONOTONIC timestamp taken at its
+// start carried into the clock's ticks at its end; the TSC is calibrated in 20 ms, which holds its
+// rate to some 10 ppm
+static void checkInterval(const FrameClock& clock)
+{
+    uint64_t t0 = 0, n0 = 0, t1 = 0, n1 = 0;
+    samplePair(clock, t0, n0);
+    timespec ts = { (time_t)g_intervalSeconds, (long)((g_intervalSeconds - (int)g_intervalSeconds) * 1e9) };
+    nanosleep(&ts, NULL);
+    samplePair(clock, t1, n1);
+    uint64_t realNs = n1 - n0;
+    uint64_t clockNs = clock.toNs(t1 - t0);
+    uint64_t tolerance = clock.backend() == FrameClock::cb_tsc ? realNs / 20000 + 20000 : 1000;
+    printf("%s: %.3f s of CLOCK_MONOTONIC measured as %.3f s, %lld ns apart\n", clock.backendName(),
+        (double)realNs / g_second, (double)clockNs / g_second, (long long)(clockNs - realNs));
+    CHECK(absDiff(clockNs, realNs) <= tolerance);
+
+    uint64_t fromOs = clock.fromOsTimestamp(n0);
+    printf("%s: a timestamp %.3f s old carried over %lld ns from where it was read\n", clock.backendName(),
+        (double)realNs / g_second, (long long)(clock.toNs(fromOs) - clock.toNs(t0)));
+    CHECK(absDiff(clock.toNs(fromOs), clock.toNs(t0)) <= tolerance);
+    // the OS backend passes timestamps through, the TSC one does not carry them into the future
+    if(clock.backend() == FrameClock::cb_tsc)
+        CHECK(clock.fromOsTimestamp(monotonicNs() + g_second) <= clock.now());
+
+    // the same interval a day, a month, a year and twenty years into the process; only the
+    // conversion's 32-bit fraction may add to the error, one tick per 2^32
+    static const uint64_t uptimeDays[] = { 1, 30, 365, 7300 };
+    for(int i = 0; i < 4; i ++) {
+        uint64_t base = exactTicks(uptimeDays[i] * 86400 * g_second, clock.frequency());
+        uint64_t ns = clock.toNs(base + (t1 - t0)) - clock.toNs(base);
+        CHECK(absDiff(ns, clockNs) <= 1 + (base + (t1 - t0)) / (1ull << 32));
+        CHECK(absDiff(ns, realNs) <= tolerance + 1 + (base + (t1 - t0)) / (1ull << 32));
+        CHECK(absDiff(clock.toNs(base), uptimeDays[i] * 86400 * g_second) <= 1 + base / (1ull << 32) + g_second / clock.frequency());
+    }
+}
+
+// conversions up to the largest tick count whose nanoseconds still fit in 64 bits, against 128-bit
+// arithmetic: off by at most the fraction's truncation, never wrapped
+static void checkLargeValues(const FrameClock& clock)
+{
+    uint64_t frequency = clock.frequency();
+    for(int bits = 20; bits < 64; bits ++) {
+        uint64_t ticks = (1ull << bits) + (1ull << bits) / 3;
+        if(exactNs(ticks, frequency) >> 63)
+            break;
+        uint64_t ns = clock.toNs(ticks);
+        CHECK(absDiff(ns, exactNs(ticks, frequency)) <= 1 + ticks / (1ull << 32));
+        CHECK(absDiff(clock.toUs(ticks), exactNs(ticks, frequency) / 1000) <= 1 + ticks / (1ull << 32));
+        uint64_t back = clock.fromNs(ns);
+        CHECK(absDiff(back, exactTicks(ns, frequency)) <= 1 + ticks / (1ull << 32));
+    }
+    // the product is 96 bits wide before the shift
+    static const uint64_t values[] = { ~0ull, ~0ull >> 1, 0xfedcba9876543210ull, 1ull << 63 };
+    static const uint64_t mults[] = { 0xffffffffull, 1ull << 32, 0x1234567ull, 1 };
+    for(int v = 0; v < 4; v ++) {
+        for(int m = 0; m < 4; m ++)
+            CHECK(FrameClock::mulShift32(values[v], mults[m]) == (uint64_t)(((unsigned __int128)values[v] * mults[m]) >> 32));
+    }
+}
+
+static void benchNow(const FrameClock& clock)
+{
+    uint64_t sum = 0;
+    double start = benchNs();
+    for(int i = 0; i < g_nowCalls; i ++)
+        sum += clock.now();
+    double ns = (benchNs() - start) / g_nowCalls;
+    start = benchNs();
+    for(int i = 0; i < g_nowCalls; i ++)
+        sum += monotonicNs();
+    double osNs = (benchNs() - start) / g_nowCalls;
+    printf("%s: now() %.1f ns a call, clock_gettime %.1f ns (%llu)\n", clock.backendName(), ns, osNs,
+        (unsigned long long)(sum & 1));
+}
+
+int main()
+{
+    FrameClock& clock = FrameClock::instance();
+    FrameClock::Backend initial = clock.backend();
+
+    CHECK(clock.selectBackend(FrameClock::cb_os));
+    CHECK(clock.frequency() == g_second);
+    CHECK(clock.toNs(123456789012345ull) == 123456789012345ull);
+    checkInterval(clock);
+    checkLargeValues(clock);
+    benchNow(clock);
+
+    if(clock.selectBackend(FrameClock::cb_tsc)) {
+        printf("tsc: %.6f GHz\n", (double)clock.frequency() / g_second);
+        checkInterval(clock);
+        checkLargeValues(clock);
+        benchNow(clock);
+    } else {
+        printf("tsc: not invariant on this CPU, only the OS backend was checked\n");
+    }
+    clock.selectBackend(initial);
+    return testResult("FrameClockBench");
+}
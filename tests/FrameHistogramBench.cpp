@@ -0,0 +1,100 @@
+#include "FrameHistogram.h"
+#include "CaptureFormat.h"
+#include "TestCheck.h"
+#include <algorithm>
+#include <vector>
+
+// frame times of a 60 fps game: mostly 14-20 ms, one frame in a hundred 30-130 ms, in ns
+static void makeFrames(std::vector<uint64_t>& frames, size_t count)
+{
+    uint32_t seed = 42;
+    frames.resize(count);
+    for(size_t i = 0; i < count; i ++) {
+        seed = seed * 1664525u + 1013904223u;
+        uint64_t r = seed >> 8;
+        frames[i] = (i % 100 == 99) ? 30000000 + r * 6 : 14000000 + r % 6000000;
+    }
+}
+
+// every percentile within the bucket width, 0.1% of the value, of the exact one
+static void checkAccuracy(const FrameHistogram& histogram, std::vector<uint64_t> frames)
+{
+    std::sort(frames.begin(), frames.end());
+    static const double pcts[] = { 1.0, 50.0, 90.0, 99.0, 99.9, 99.99 };
+    for(size_t i = 0; i < sizeof(pcts) / sizeof(pcts[0]); i ++) {
+        size_t rank = (size_t)ceil(pcts[i] / 100.0 * (double)frames.size());
+        uint64_t exact = frames[rank ? rank - 1 : 0];
+        uint64_t value = histogram.percentile(pcts[i]);
+        CHECK(fabs((double)value - (double)exact) <= (double)exact * 0.001);
+    }
+    CHECK(histogram.maxValue() >= frames.back() && histogram.maxValue() - frames.back() <= frames.back() / 1000);
+}
+
+static void checkRoundTrip(const FrameHistogram& histogram)
+{
+    FILE* f = tmpfile();
+    CHECK(f && histogram.write(f));
+    if(!f)
+        return;
+    std::vector<uint8_t> data((size_t)ftell(f) + 16, 0xcd);
+    rewind(f);
+    CHECK(fread(&data[16], 1, data.size() - 16, f) == data.size() - 16);
+    fclose(f);
+    FrameHistogram* pCopy = new FrameHistogram;
+    size_t trailer = 0;
+    CHECK(pCopy->readTrailer(&data[0], data.size(), trailer) && trailer == data.size() - 16);
+    CHECK(pCopy->count() == histogram.count());
+    CHECK(pCopy->percentile(99.9) == histogram.percentile(99.9));
+    delete pCopy;
+}
+
+int main()
+{
+    const size_t count = 10000000;
+    std::vector<uint64_t> frames;
+    makeFrames(frames, count);
+    FrameHistogram* pHistogram = new FrameHistogram;
+
+    double start = benchNs();
+    for(size_t i = 0; i < count; i ++)
+        pHistogram->record(frames[i]);
+    double recordNs = (benchNs() - start) / (double)count;
+    CHECK(pHistogram->count() == count);
+
+    // as the hook records, from 10 MHz ticks
+    FrameHistogram* pTicks = new FrameHistogram;
+    start = benchNs();
+    for(size_t i = 0; i < count; i ++)
+        pTicks->recordTicks(frames[i] / 100, 10000000);
+    double recordTicksNs = (benchNs() - start) / (double)count;
+    CHECK(pTicks->percentile(50.0) / 1000 == pHistogram->percentile(50.0) / 1000);
+
+    const int queries = 2000;
+    uint64_t sink = 0;
+    double queryNs[3];
+    static const double pcts[] = { 50.0, 99.0, 99.9 };
+    for(int q = 0; q < 3; q ++) {
+        start = benchNs();
+        for(int i = 0; i < queries; i ++)
+            sink += pHistogram->percentile(pcts[q]);
+        queryNs[q] = (benchNs() - start) / queries;
+    }
+    start = benchNs();
+    for(int i = 0; i < queries; i ++)
+        sink += pHistogram->count();
+    double countNs = (benchNs() - start) / queries;
+    start = benchNs();
+    for(int i = 0; i < 100; i ++)
+        pTicks->merge(*pHistogram);
+    double mergeUs = (benchNs() - start) / 100 / 1000.0;
+
+    checkAccuracy(*pHistogram, frames);
+    checkRoundTrip(*pHistogram);
+
+    printf("record %.2f ns, recordTicks %.2f ns, count %.1f us, p50 %.1f us, p99 %.1f us, p99.9 %.1f us, merge %.1f us (%llu)\n",
+        recordNs, recordTicksNs, countNs / 1000.0, queryNs[0] / 1000.0, queryNs[1] / 1000.0, queryNs[2] / 1000.0, mergeUs,
+        (unsigned long long)(sink & 1));
+    delete pTicks;
+    delete pHistogram;
+    return testResult("FrameHistogramBench");
+}
@@ -0,0 +1,146 @@
+#include "FramePacer.h"
+#include "TestCheck.h"
+
+// a clock that only moves when the pacer or the test moves it; sleeps overshoot by a fixed
+// amount plus a deterministic jitter, spins advance by a fixed step
+class SimClock : public PacingClock
+{
+public:
+    SimClock(uint64_t frequency, uint64_t oversleep, uint64_t jitter, uint64_t spinStep):
+        m_frequency(frequency), m_now(1000000), m_oversleep(oversleep), m_jitter(jitter), m_spinStep(spinStep),
+        m_seed(12345), m_sleeps(0), m_spins(0)
+    {
+    }
+    uint64_t frequency() const { return m_frequency; }
+    uint64_t now() { return m_now; }
+    void sleep(uint64_t ticks)
+    {
+        m_seed = m_seed * 1664525u + 1013904223u;
+        m_now += ticks + m_oversleep + (m_jitter ? (m_seed >> 8) % m_jitter : 0);
+        m_sleeps ++;
+    }
+    void spin()
+    {
+        m_now += m_spinStep;
+        m_spins ++;
+    }
+    void work(uint64_t ticks) { m_now += ticks; }
+
+    uint64_t            m_frequency;
+    uint64_t            m_now;
+    uint64_t            m_oversleep;
+    uint64_t            m_jitter;
+    uint64_t            m_spinStep;
+    uint32_t            m_seed;
+    uint64_t            m_sleeps;
+    uint64_t            m_spins;
+};
+
+static const uint64_t   g_freq = 10000000;      /* 100 ns ticks, like QueryPerformanceCounter */
+
+// 144 does not divide the frequency, the remainder accumulator has to keep the rate exact
+static void testExactRate()
+{
+    SimClock clock(g_freq, 5000, 3000, 10);
+    FramePacer pacer(clock);
+    pacer.setTargetFps(144);
+    pacer.wait();
+    uint64_t first = clock.now();
+    const uint64_t frames = 144 * 60;
+    uint64_t maxLateness = 0;
+    uint64_t overslept = 0;
+    for(uint64_t i = 1; i <= frames; i ++) {
+        clock.work(20000 + (i % 7) * 1000);
+        pacer.wait();
+        // frame i is released at its slot first + floor(i * freq / fps), never before
+        uint64_t slot = first + i * g_freq / 144;
+        CHECK(clock.now() >= slot);
+        if(clock.now() - slot > maxLateness)
+            maxLateness = clock.now() - slot;
+        // a release later than one spin step means the sleep itself ran past the slot
+        if(clock.now() - slot >= clock.m_spinStep)
+            overslept ++;
+    }
+    // mean plus four deviations leaves the odd sleep of the jitter's tail a few microseconds late
+    CHECK(overslept <= frames / 1000);
+    CHECK(maxLateness < 100);
+    CHECK_NEAR((double)(clock.now() - first) / (double)g_freq, 60.0, 1e-5);
+    PacerReport report;
+    CHECK(pacer.takeReport(report));
+    CHECK(report.resyncs == 0);
+    CHECK(report.maxLatenessUs < 10.0);
+    // the slack learned the 0.5-0.8 ms oversleep plus its deviation, so every sleep ends before the slot
+    CHECK(report.sleepSlackUs > 500.0 && report.sleepSlackUs < 2000.0);
+}
+
+// a precise timer needs little spinning, the slack drops to its floor of 50 us
+static void testSlackFollowsTimer()
+{
+    SimClock clock(g_freq, 0, 0, 10);
+    FramePacer pacer(clock);
+    pacer.setTargetFps(60);
+    for(int i = 0; i < 600; i ++) {
+        clock.work(10000);
+        pacer.wait();
+    }
+    PacerReport report;
+    CHECK(pacer.takeReport(report));
+    CHECK_NEAR(report.sleepSlackUs, 50.0, 0.5);
+    uint64_t spins = clock.m_spins;
+    clock.work(10000);
+    pacer.wait();
+    // 50 us at 1 us per spin
+    CHECK(clock.m_spins - spins <= 50);
+}
+
+// a stall of more than a frame restarts the schedule instead of releasing the missed frames at once
+static void testResync()
+{
+    SimClock clock(g_freq, 1000, 0, 10);
+    FramePacer pacer(clock);
+    pacer.setTargetFps(100);
+    for(int i = 0; i < 10; i ++)
+        pacer.wait();
+    clock.work(g_freq / 2);
+    uint64_t stalled = clock.now();
+    pacer.wait();
+    CHECK(clock.now() == stalled);
+    pacer.wait();
+    CHECK(clock.now() >= stalled + g_freq / 100);
+    for(int i = 0; i < 100; i ++)
+        pacer.wait();
+    PacerReport report;
+    CHECK(pacer.takeReport(report));
+    CHECK(report.resyncs == 1);
+}
+
+// frames slower than the cap are not held, and a disabled pacer never touches the clock
+static void testSlowFramesAndOff()
+{
+    SimClock clock(g_freq, 1000, 0, 10);
+    FramePacer pacer(clock);
+    pacer.setTargetFps(100);
+    pacer.wait();
+    clock.work(g_freq / 100 + 500);
+    uint64_t before = clock.now();
+    pacer.wait();
+    CHECK(clock.now() == before);
+
+    pacer.setTargetFps(0);
+    uint64_t sleeps = clock.m_sleeps, spins = clock.m_spins;
+    before = clock.now();
+    for(int i = 0; i < 10; i ++)
+        pacer.wait();
+    CHECK(clock.now() == before && clock.m_sleeps == sleeps && clock.m_spins == spins);
+    PacerReport report;
+    CHECK(!pacer.takeReport(report));
+}
+
+int main()
+{
+    testExactRate();
+    testSlackFollowsTimer();
+    testResync();
+    testSlowFramesAndOff();
+    return testResult("FramePacerTest");
+}
@@ -0,0 +1,188 @@
+#include "LatencyPredictor.h"
+#include "TestCheck.h"
+#include "RecordedTrace.h"
+
+static const uint64_t   g_freq = 10000000;      /* 100 ns ticks */
+static const uint64_t   g_ms = g_freq / 1000;
+
+// a vsynced swapchain with one frame in flight: Present returns once the previous frame has
+// been shown, one refresh after the previous return at the earliest
+struct SimSwapChain
+{
+    uint64_t            refresh;
+    uint64_t            now;
+    uint64_t            lastReturn;
+    uint64_t            missed;             /* refreshes without a new frame */
+    uint64_t            blocked;            /* all the time spent in Present */
+
+    explicit SimSwapChain(uint64_t refreshTicks): refresh(refreshTicks), now(0), lastReturn(0), missed(0), blocked(0) {}
+
+    // one frame: the sleep, the work, then Present; returns the time blocked in Present
+    uint64_t present(uint64_t sleep, uint64_t work)
+    {
+        now += sleep + work;
+        uint64_t presentCall = now;
+        uint64_t slot = lastReturn + refresh;
+        if(now < slot)
+            now = slot;
+        else if(lastReturn)
+            missed += (now - lastReturn) / refresh - 1 + ((now - lastReturn) % refresh ? 1 : 0);
+        lastReturn = now;
+        blocked += now - presentCall;
+        return now - presentCall;
+    }
+
+    // a frame with the predictor's sleep, which it is fed
+    void frame(LatencyPredictor& predictor, uint64_t work)
+    {
+        uint64_t previous = lastReturn;
+        uint64_t blockedTicks = present(predictor.sleepTicks(), work);
+        predictor.addFrame(work, blockedTicks, previous ? now - previous : refresh);
+    }
+};
+
+static void testWarmup()
+{
+    LatencyPredictor predictor(g_freq);
+    for(int i = 0; i < 7; i ++) {
+        predictor.addFrame(2 * g_ms, 10 * g_ms, 16 * g_ms);
+        CHECK(predictor.sleepTicks() == 0);
+    }
+    predictor.addFrame(2 * g_ms, 10 * g_ms, 16 * g_ms);
+    CHECK(predictor.sleepTicks() > 0);
+    predictor.reset();
+    CHECK(predictor.sleepTicks() == 0);
+    predictor.addFrame(2 * g_ms, 10 * g_ms, 16 * g_ms);
+    CHECK(predictor.sleepTicks() == 0);
+}
+
+// steady work: the blocking moves in front of the frame down to the 1 ms margin, without a missed refresh
+static void testConverges()
+{
+    LatencyPredictor predictor(g_freq);
+    SimSwapChain chain(g_freq / 60);
+    for(int i = 0; i < 300; i ++)
+        chain.frame(predictor, 5 * g_ms);
+    uint64_t limit = chain.refresh - 5 * g_ms - g_ms;
+    CHECK(predictor.sleepTicks() <= limit);
+    CHECK(predictor.sleepTicks() + g_ms / 10 >= limit);
+    uint64_t before = chain.missed;
+    uint64_t blocked = 0;
+    for(int i = 0; i < 60; i ++) {
+        uint64_t start = chain.now;
+        chain.frame(predictor, 5 * g_ms);
+        blocked += chain.now - (start + predictor.sleepTicks() + 5 * g_ms);
+    }
+    CHECK(chain.missed == before);
+    CHECK(chain.missed == 0);
+    // about the margin left per frame
+    CHECK(blocked / 60 <= g_ms + g_ms / 10);
+}
+
+// the sleep is capped by the interval minus the 90th percentile of work, so spikes more
+// frequent than one frame in ten do not cost refreshes
+static void testWorkSpikes()
+{
+    LatencyPredictor predictor(g_freq);
+    SimSwapChain chain(g_freq / 60);
+    uint32_t seed = 7;
+    uint64_t warmupMissed = 0;
+    for(int i = 0; i < 2000; i ++) {
+        seed = seed * 1664525u + 1013904223u;
+        // 4-6 ms, and 8 ms on every 6th frame
+        uint64_t work = (i % 6 == 5) ? 8 * g_ms : 4 * g_ms + (seed >> 8) % (2 * g_ms);
+        chain.frame(predictor, work);
+        // until the window is full its percentile can rank the spikes above the 90th
+        if(i == 64)
+            warmupMissed = chain.missed;
+    }
+    CHECK(predictor.sleepTicks() <= chain.refresh - 8 * g_ms - g_ms);
+    CHECK(predictor.sleepTicks() > 6 * g_ms);
+    CHECK(chain.missed == warmupMissed);
+}
+
+// a CPU bound game never blocks in Present and is never put to sleep
+static void testCpuBound()
+{
+    LatencyPredictor predictor(g_freq);
+    SimSwapChain chain(g_freq / 60);
+    for(int i = 0; i < 200; i ++)
+        chain.frame(predictor, 20 * g_ms);
+    CHECK(predictor.sleepTicks() == 0);
+}
+
+// after the work grows the predictor gives the sleep back at once instead of missing refreshes
+static void testWorkGrows()
+{
+    LatencyPredictor predictor(g_freq);
+    SimSwapChain chain(g_freq / 60);
+    for(int i = 0; i < 300; i ++)
+        chain.frame(predictor, 3 * g_ms);
+    uint64_t before = predictor.sleepTicks();
+    uint64_t missed = chain.missed;
+    for(int i = 0; i < 64; i ++)
+        chain.frame(predictor, 10 * g_ms);
+    CHECK(predictor.sleepTicks() < before);
+    CHECK(predictor.sleepTicks() <= chain.refresh - 10 * g_ms - g_ms);
+    // the frames until the 90th percentile sees the new work may slip, later ones do not
+    missed = chain.missed - missed;
+    CHECK(missed <= 8);
+    uint64_t settled = chain.missed;
+    for(int i = 0; i < 100; i ++)
+        chain.frame(predictor, 10 * g_ms);
+    CHECK(chain.missed == settled);
+}
+
+// the work of the vsynced frames in data/recorded_60hz.ftc, the time from one Present returning to the
+// next being called, replayed with and without the predictor: most of the blocking moves in front
+// of the frame, at the cost of a refresh on the few frames whose work is above the window's 90th
+// percentile by more than the margin
+static void testRecordedTrace(const std::string& dataDir)
+{
+    CaptureFileHeader header;
+    std::vector<FrameRecord> records;
+    CHECK(readRecordedTrace(dataDir + "/recorded_60hz.ftc", header, records));
+    if(records.empty())
+        return;
+    std::vector<uint64_t> work;
+    for(size_t i = 1; i < records.size() && records[i].syncInterval == 1; i ++)
+        work.push_back((records[i].presentStart - records[i - 1].presentEnd) * g_freq / header.tickFrequency);
+    CHECK(work.size() > 600);
+
+    LatencyPredictor predictor(g_freq);
+    SimSwapChain paced(g_freq / 60);
+    SimSwapChain unpaced(g_freq / 60);
+    const size_t warmup = 64;
+    uint64_t pacedMissed = 0, unpacedMissed = 0, pacedBlocked = 0, unpacedBlocked = 0;
+    for(size_t i = 0; i < work.size(); i ++) {
+        if(i == warmup) {
+            pacedMissed = paced.missed;
+            unpacedMissed = unpaced.missed;
+            pacedBlocked = paced.blocked;
+            unpacedBlocked = unpaced.blocked;
+        }
+        paced.frame(predictor, work[i]);
+        unpaced.present(0, work[i]);
+    }
+    uint64_t frames = work.size() - warmup;
+    pacedMissed = paced.missed - pacedMissed;
+    unpacedMissed = unpaced.missed - unpacedMissed;
+    pacedBlocked = (paced.blocked - pacedBlocked) / frames;
+    unpacedBlocked = (unpaced.blocked - unpacedBlocked) / frames;
+    printf("recorded trace: %llu frames, blocked %.2f ms a frame paced and %.2f ms unpaced, %llu and %llu refreshes missed\n",
+        (unsigned long long)frames, (double)pacedBlocked / g_ms, (double)unpacedBlocked / g_ms,
+        (unsigned long long)pacedMissed, (unsigned long long)unpacedMissed);
+    CHECK(pacedBlocked * 4 < unpacedBlocked);
+    CHECK(pacedMissed <= unpacedMissed + frames / 20);
+}
+
+int main(int argc, char** argv)
+{
+    testWarmup();
+    testConverges();
+    testWorkSpikes();
+    testCpuBound();
+    testWorkGrows();
+    testRecordedTrace(argc > 1 ? argv[1] : "data");
+    return testResult("LatencyPredictorTest");
+}
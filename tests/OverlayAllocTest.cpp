@@ -0,0 +1,206 @@
+#include "DrawNumber.h"
+#include "Config.h"
+#include "FrameArena.h"
+#include "OverlayWidgets.h"
+#include "TextLayout.h"
+#include "TestCheck.h"
+#include "MockDevice.h"
+#include <new>
+#include <stdlib.h>
+
+// every operator new of the process, the overlay's frames must not add to it once warmed up
+static int g_allocations = 0;
+
+void* operator new(size_t size)
+{
+    g_allocations ++;
+    void* p = malloc(size ? size : 1);
+    if(!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    free(p);
+}
+
+// Config.cpp reads and watches files with Win32; the defaults the overlay draws with are enough here
+OverlayConfig::OverlayConfig()
+{
+    overlayX = 15.f;
+    overlayY = 15.f;
+    overlayColor[0] = overlayColor[3] = 1.f;
+    overlayColor[1] = overlayColor[2] = 0.f;
+    overlayBias = 0.f;
+    overlayCompose = true;
+    overlayDeferred = false;
+    fpsLimit = 0;
+    latencyMode = false;
+    captureCsv = false;
+}
+
+static const char* const g_labels[] = { "fps", "max ms", "p99 ms" };
+static const int        g_rows = sizeof(g_labels) / sizeof(g_labels[0]);
+static const uint32_t   g_samples = 256;
+static const float      g_width = 1920.f;
+static const float      g_height = 1080.f;
+static const int        g_warmupFrames = 8;
+static const int        g_frames = 300;
+
+// what the hook draws changes every frame: new numbers, one more frame time
+struct FrameData
+{
+    int                 numbers[g_rows];
+    uint32_t            samplesUs[g_samples];
+    uint64_t            sampleCount;
+
+    FrameData(): sampleCount(0) { memset(samplesUs, 0, sizeof(samplesUs)); }
+    void next(int frame)
+    {
+        numbers[0] = 55 + frame % 10;
+        numbers[1] = 100 + frame * 37 % 900;
+        numbers[2] = frame % 2 ? 17 : 21;
+        samplesUs[sampleCount % g_samples] = 16000 + frame * 131 % 4000;
+        sampleCount ++;
+    }
+};
+
+// one device for the whole run, with the game's viewport bound as Present finds it; the overlay's
+// per-device cache keeps a reference until after main returns, so it is never destroyed
+static MockDevice& device()
+{
+    static MockDevice* pDevice = nullptr;
+    if(!pDevice) {
+        pDevice = new MockDevice;
+        D3D11_VIEWPORT viewport = { 0.f, 0.f, g_width, g_height, 0.f, 1.f };
+        pDevice->immediate.bound.viewports[0] = viewport;
+        pDevice->immediate.bound.viewportCount = 1;
+    }
+    return *pDevice;
+}
+
+// frame(f) for the warm-up frames, which may create and allocate, then for the measured frames, which
+// may neither; draws are counted on context, at least drawsPerFrame each frame
+template<class Frame>
+static void checkSteady(const char* name, MockDevice& device, MockContext& context, int drawsPerFrame, Frame frame)
+{
+    int f = 0;
+    for(; f < g_warmupFrames; f ++) {
+        FrameArena::current().beginFrame();
+        frame(f);
+    }
+    int allocations = g_allocations;
+    int creates = device.creates;
+    int draws = context.draws;
+    double start = benchNs();
+    for(; f < g_warmupFrames + g_frames; f ++) {
+        FrameArena::current().beginFrame();
+        frame(f);
+    }
+    double frameNs = (benchNs() - start) / g_frames;
+    allocations = g_allocations - allocations;
+    creates = device.creates - creates;
+    draws = context.draws - draws;
+    CHECK(allocations == 0);
+    CHECK(creates == 0);
+    CHECK(draws >= drawsPerFrame * g_frames);
+    printf("%s: %d frames, %d allocations, %d device objects created, %d draws, %.1f us a frame\n",
+        name, g_frames, allocations, creates, draws, frameNs / 1000.0);
+}
+
+// the numbers and the labels as separate draws, and the frame graph
+static void testImmediateFrames()
+{
+    MockSwapChain swapChain(&device());
+    const DrawNumberTool& tool = DrawNumberTool::instance();
+    OverlayConfig cfg;
+    FrameData data;
+    QuadBuffers numberBuffers, textBuffers;
+    TextBatch batch;
+    FrameGraphRing ring;
+    checkSteady("immediate", device(), device().immediate, 3, [&](int f) {
+        data.next(f);
+        tool.drawNumbers(&swapChain, numberBuffers, data.numbers, g_rows, cfg.overlayX, cfg.overlayY, g_width, g_height, cfg);
+        tool.layoutLabels(batch, g_labels, g_rows, cfg.overlayX, cfg.overlayY, cfg);
+        tool.drawText(&swapChain, batch, textBuffers, g_width, g_height);
+        tool.drawGraph(&swapChain, ring, data.samplesUs, g_samples, data.sampleCount, cfg.overlayX, 300.f, g_width, g_height, cfg);
+    });
+}
+
+// the numbers through the HUD target, redrawn into it whenever they change, which is every frame here
+static void testComposedFrames()
+{
+    MockSwapChain swapChain(&device());
+    const DrawNumberTool& tool = DrawNumberTool::instance();
+    OverlayConfig cfg;
+    FrameData data;
+    HudComposite hud;
+    QuadBuffers textBuffers;
+    TextBatch batch;
+    FrameGraphRing ring;
+    checkSteady("composed", device(), device().immediate, 4, [&](int f) {
+        data.next(f);
+        tool.composeNumbers(&swapChain, hud, data.numbers, g_rows, cfg.overlayX, cfg.overlayY, g_width, g_height, cfg);
+        tool.layoutLabels(batch, g_labels, g_rows, cfg.overlayX, cfg.overlayY, cfg);
+        tool.drawText(&swapChain, batch, textBuffers, g_width, g_height);
+        tool.drawGraph(&swapChain, ring, data.samplesUs, g_samples, data.sampleCount, cfg.overlayX, 300.f, g_width, g_height, cfg);
+    });
+}
+
+// the rows as widgets, only the changed ones uploaded
+static void testWidgetFrames()
+{
+    MockSwapChain swapChain(&device());
+    const DrawNumberTool& tool = DrawNumberTool::instance();
+    OverlayConfig cfg;
+    FrameData data;
+    WidgetTree tree;
+    WidgetBuffers buffers;
+    checkSteady("widgets", device(), device().immediate, 1, [&](int f) {
+        data.next(f);
+        tool.layoutWidgets(tree, data.numbers, g_labels, g_rows, cfg.overlayX, cfg.overlayY, cfg);
+        tool.drawWidgets(&swapChain, tree, buffers, g_width, g_height);
+    });
+}
+
+// the same draws recorded into a deferred context with its own constant buffers
+static void testDeferredFrames()
+{
+    MockContext deferred;
+    const DrawNumberTool& tool = DrawNumberTool::instance();
+    OverlayConfig cfg;
+    FrameData data;
+    DeferredConstants constants;
+    QuadBuffers numberBuffers, textBuffers;
+    TextBatch batch;
+    FrameGraphRing ring;
+    checkSteady("deferred", device(), deferred, 3, [&](int f) {
+        data.next(f);
+        tool.renderNumbers(&device(), &deferred, &constants, numberBuffers, data.numbers, g_rows, cfg.overlayX, cfg.overlayY,
+            g_width, g_height, cfg);
+        tool.layoutLabels(batch, g_labels, g_rows, cfg.overlayX, cfg.overlayY, cfg);
+        tool.renderText(&device(), &deferred, &constants, batch, textBuffers, g_width, g_height);
+        tool.renderGraph(&device(), &deferred, &constants, ring, data.samplesUs, g_samples, data.sampleCount, cfg.overlayX, 300.f,
+            g_width, g_height, cfg);
+    });
+}
+
+int main()
+{
+    testImmediateFrames();
+    testComposedFrames();
+    testWidgetFrames();
+    testDeferredFrames();
+    return testResult("OverlayAllocTest");
+}
@@ -0,0 +1,356 @@
+#include "OverlayGeometry.h"
+#include "SoftwareRenderer.h"
+#include "BlockCompress.h"
+#include "FrameArena.h"
+#include "OverlayWidgets.h"
+#include "TextLayout.h"
+#include "TestCheck.h"
+#include <string>
+#include <string.h>
+
+/*
+ * Each overlay mode rendered by SoftwareRenderer and compared with its PNG in
+ * the golden directory given as the first argument, within g_tolerance per
+ * channel. An image that differs is written next to the test as
+ * <mode>.actual.png; --update as the second argument writes the goldens
+ * instead, after a change that is meant to alter the output. Then the cost
+ * of the vertex generation and layout behind each frame.
+ */
+
+static const char* const g_labels[] = { "fps", "p50 ms", "p95 ms", "p99 ms" };
+static const int        g_rows = sizeof(g_labels) / sizeof(g_labels[0]);
+static const int        g_numbers[g_rows] = { 144, 6, 9, 1234567890 };
+static const float      g_color[4] = { 1.f, 0.85f, 0.1f, 0.9f };
+static const float      g_bias = 0.f;
+static const float      g_x = 15.f;
+static const float      g_y = 15.f;
+static const uint32_t   g_capacity = 120;
+static const uint64_t   g_sampleCount = 1000;
+static const int        g_width = 320;
+static const int        g_height = 176;
+static const int        g_tolerance = 2;
+
+static uint32_t         g_samplesUs[g_capacity];
+
+// counts what the geometry sends, for timing it without the rasterizer
+struct NullRenderer : OverlayRenderer
+{
+    uint32_t            quads;
+    uint32_t            points;
+
+    NullRenderer(): quads(0), points(0) {}
+    void drawQuads(OverlayAtlas, const DrawNumberVertex*, uint32_t quadCount) { quads += quadCount; }
+    void drawLineStrip(const float*, uint32_t pointCount, const float*) { points += pointCount; }
+};
+
+static void fill(image& img, byte r, byte g, byte b, byte a)
+{
+    for(int y = 0; y < img.get_height(); y ++) {
+        for(int x = 0; x < img.get_width(); x ++) {
+            byte* p = img.get_data(x, y);
+            p[0] = r;
+            p[1] = g;
+            p[2] = b;
+            p[3] = a;
+        }
+    }
+}
+
+// the game's frame under the overlay: a dark opaque gradient, so blending shows
+static void background(image& img)
+{
+    img.create(image::fmt_rgba, g_width, g_height);
+    for(int y = 0; y < g_height; y ++) {
+        for(int x = 0; x < g_width; x ++) {
+            byte* p = img.get_data(x, y);
+            p[0] = (byte)(16 + x * 64 / g_width);
+            p[1] = (byte)(32 + y * 64 / g_height);
+            p[2] = 64;
+            p[3] = 255;
+        }
+    }
+}
+
+static bool readFile(const std::string& path, std::vector<byte>& data)
+{
+    FILE* f = fopen(path.c_str(), "rb");
+    if(!f)
+        return false;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data.resize(size > 0 ? size : 0);
+    bool read = size > 0 && fread(&data.front(), 1, size, f) == (size_t)size;
+    fclose(f);
+    return read;
+}
+
+static bool writePng(const std::string& path, const image& img)
+{
+    std::vector<byte> png;
+    if(!imageio::write_png_image(img, png))
+        return false;
+    FILE* f = fopen(path.c_str(), "wb");
+    if(!f)
+        return false;
+    bool written = fwrite(&png.front(), 1, png.size(), f) == png.size();
+    fclose(f);
+    return written;
+}
+
+// the numbers, labels and graph of one frame, in the order the Present hook draws them
+static void drawFrame(OverlayRenderer& renderer, TextBatch& batch, uint64_t sampleCount)
+{
+    const OverlayGeometry& geometry = OverlayGeometry::instance();
+    geometry.drawNumbers(renderer, g_numbers, g_rows, g_x, g_y, g_bias, g_color);
+    geometry.layoutLabels(batch, g_labels, g_rows, g_x, g_y, g_bias, g_color);
+    geometry.drawText(renderer, batch);
+    geometry.drawGraph(renderer, g_samplesUs, g_capacity, sampleCount, g_x, g_y + geometry.numberHeight() * g_rows, g_color);
+}
+
+// the HUD target of overlay_compose, cleared to transparent black, blended over dst as ComposePS
+// and the ONE / INV_SRC_ALPHA blend state do at the same size
+static void composite(const image& hud, image& dst)
+{
+    for(int y = 0; y < hud.get_height(); y ++) {
+        for(int x = 0; x < hud.get_width(); x ++) {
+            const byte* s = hud.get_data(x, y);
+            byte* d = dst.get_data(x, y);
+            for(int c = 0; c < 4; c ++)
+                d[c] = (byte)(s[c] + (d[c] * (255 - s[3]) + 127) / 255);
+        }
+    }
+}
+
+typedef void (*RenderMode)(image& target);
+
+static void renderNumbers(image& target)
+{
+    const OverlayGeometry& geometry = OverlayGeometry::instance();
+    SoftwareRenderer renderer(target, geometry.numberAtlas(), geometry.textAtlas());
+    geometry.drawNumbers(renderer, g_numbers, g_rows, g_x, g_y, g_bias, g_color);
+}
+
+static void renderHud(image& target)
+{
+    const OverlayGeometry& geometry = OverlayGeometry::instance();
+    SoftwareRenderer renderer(target, geometry.numberAtlas(), geometry.textAtlas());
+    TextBatch batch;
+    drawFrame(renderer, batch, g_sampleCount);
+}
+
+static void renderComposed(image& target)
+{
+    const OverlayGeometry& geometry = OverlayGeometry::instance();
+    image hud;
+    hud.create(image::fmt_rgba, g_width, g_height);
+    fill(hud, 0, 0, 0, 0);
+    SoftwareRenderer renderer(hud, geometry.numberAtlas(), geometry.textAtlas());
+    geometry.drawNumbers(renderer, g_numbers, g_rows, g_x, g_y, g_bias, g_color);
+    composite(hud, target);
+}
+
+static void renderWidgets(image& target)
+{
+    const OverlayGeometry& geometry = OverlayGeometry::instance();
+    SoftwareRenderer renderer(target, geometry.numberAtlas(), geometry.textAtlas());
+    WidgetTree tree;
+    geometry.layoutWidgets(tree, g_numbers, g_labels, g_rows, g_x, g_y, g_bias, g_color);
+    geometry.drawWidgets(renderer, tree);
+}
+
+// what a device sampling the BC4 atlases shows
+static void renderCompressed(image& target)
+{
+    const OverlayGeometry& geometry = OverlayGeometry::instance();
+    std::vector<byte> numberBlocks, textBlocks;
+    image numbers, text;
+    CHECK(encodeBC4(geometry.numberAtlas(), 0, numberBlocks) && encodeBC4(geometry.textAtlas(), 0, textBlocks));
+    CHECK(decodeBC4(&numberBlocks.front(), geometry.numberAtlas().get_width(), geometry.numberAtlas().get_height(), numbers));
+    CHECK(decodeBC4(&textBlocks.front(), geometry.textAtlas().get_width(), geometry.textAtlas().get_height(), text));
+    SoftwareRenderer renderer(target, numbers, text);
+    TextBatch batch;
+    drawFrame(renderer, batch, g_sampleCount);
+}
+
+struct Mode
+{
+    const char*         name;
+    RenderMode          render;
+};
+
+static const Mode g_modes[] =
+{
+    { "numbers", renderNumbers },
+    { "hud", renderHud },
+    { "composed", renderComposed },
+    { "widgets", renderWidgets },
+    { "hud_bc4", renderCompressed },
+};
+
+// renders mode over the background, compares it with its golden or writes that, and times the rendering
+static void checkMode(const Mode& mode, const std::string& goldenDir, bool update)
+{
+    image actual;
+    background(actual);
+    FrameArena::current().beginFrame();
+    mode.render(actual);
+
+    std::string goldenPath = goldenDir + "/" + mode.name + ".png";
+    if(update) {
+        CHECK(writePng(goldenPath, actual));
+        printf("%s: wrote %s\n", mode.name, goldenPath.c_str());
+    }
+    else {
+        std::vector<byte> png;
+        image golden;
+        bool loaded = readFile(goldenPath, png) && imageio::read_png_image(golden, &png.front(), (int)png.size());
+        CHECK(loaded);
+        int differences = loaded ? countDifferences(actual, golden, g_tolerance) : -1;
+        CHECK(differences == 0);
+        if(differences != 0) {
+            std::string actualPath = std::string(mode.name) + ".actual.png";
+            writePng(actualPath, actual);
+            printf("%s: %d pixels differ from %s by more than %d, wrote %s\n", mode.name, differences, goldenPath.c_str(),
+                g_tolerance, actualPath.c_str());
+        }
+    }
+
+    const int rounds = 50;
+    image target;
+    background(target);
+    double start = benchNs();
+    for(int r = 0; r < rounds; r ++) {
+        FrameArena::current().beginFrame();
+        mode.render(target);
+    }
+    printf("%s: %dx%d in %.1f us\n", mode.name, g_width, g_height, (benchNs() - start) / rounds / 1000.0);
+}
+
+// a PNG written by imageio reads back as it was, in both formats the overlay uses
+static void testPngRoundTrip()
+{
+    image rgba, gray, back;
+    background(rgba);
+    renderHud(rgba);
+    CHECK(gray.create(image::fmt_gray, 5, 3));
+    for(int i = 0; i < 15; i ++)
+        gray.get_data(0, 0)[i] = (byte)(i * 17);
+    const image* images[] = { &rgba, &gray };
+    for(int i = 0; i < 2; i ++) {
+        std::vector<byte> png;
+        CHECK(imageio::write_png_image(*images[i], png));
+        CHECK(!png.empty() && imageio::read_png_image(back, &png.front(), (int)png.size()));
+        CHECK(countDifferences(*images[i], back, 0) == 0);
+    }
+}
+
+// the widgets draw exactly what the rows and labels draw, and a hidden row is gone
+static void testWidgetsMatchRows()
+{
+    const OverlayGeometry& geometry = OverlayGeometry::instance();
+    image rows, widgets;
+    CHECK(rows.create(image::fmt_rgba, g_width, g_height) && widgets.create(image::fmt_rgba, g_width, g_height));
+    fill(rows, 0, 0, 0, 0);
+    fill(widgets, 0, 0, 0, 0);
+    FrameArena::current().beginFrame();
+    {
+        SoftwareRenderer renderer(rows, geometry.numberAtlas(), geometry.textAtlas());
+        TextBatch batch;
+        geometry.drawNumbers(renderer, g_numbers, g_rows, g_x, g_y, g_bias, g_color);
+        geometry.layoutLabels(batch, g_labels, g_rows, g_x, g_y, g_bias, g_color);
+        geometry.drawText(renderer, batch);
+    }
+    WidgetTree tree;
+    {
+        SoftwareRenderer renderer(widgets, geometry.numberAtlas(), geometry.textAtlas());
+        geometry.layoutWidgets(tree, g_numbers, g_labels, g_rows, g_x, g_y, g_bias, g_color);
+        geometry.drawWidgets(renderer, tree);
+    }
+    CHECK(countDifferences(rows, widgets, 0) == 0);
+    tree.setVisible(2, false);
+    fill(widgets, 0, 0, 0, 0);
+    {
+        SoftwareRenderer renderer(widgets, geometry.numberAtlas(), geometry.textAtlas());
+        geometry.drawWidgets(renderer, tree);
+    }
+    CHECK(countDifferences(rows, widgets, 0) > 0);
+}
+
+// what the CPU spends on the overlay each frame before anything is drawn
+static void benchGeometry()
+{
+    const OverlayGeometry& geometry = OverlayGeometry::instance();
+    const int rounds = 100000;
+    int numbers[g_rows];
+    memcpy(numbers, g_numbers, sizeof(numbers));
+    uint32_t vertexCount = 0;
+    double start = benchNs();
+    for(int r = 0; r < rounds; r ++) {
+        FrameArena::current().beginFrame();
+        numbers[0] = r;
+        geometry.createRows(numbers, g_rows, g_x, g_y, g_bias, g_color, vertexCount);
+    }
+    double rowsNs = (benchNs() - start) / rounds;
+
+    TextBatch batch;
+    start = benchNs();
+    for(int r = 0; r < rounds; r ++)
+        geometry.layoutLabels(batch, g_labels, g_rows, g_x, g_y, g_bias, g_color);
+    double labelsNs = (benchNs() - start) / rounds;
+
+    WidgetTree tree;
+    start = benchNs();
+    for(int r = 0; r < rounds; r ++) {
+        FrameArena::current().beginFrame();
+        numbers[0] = r / 60;
+        geometry.layoutWidgets(tree, numbers, g_labels, g_rows, g_x, g_y, g_bias, g_color);
+        tree.layout();
+    }
+    double widgetsNs = (benchNs() - start) / rounds;
+
+    NullRenderer null;
+    start = benchNs();
+    for(int r = 0; r < rounds; r ++) {
+        FrameArena::current().beginFrame();
+        geometry.drawWidgets(null, tree);
+    }
+    double tessellateNs = (benchNs() - start) / rounds;
+
+    GraphPlacement placement;
+    geometry.placeGraph(g_capacity, g_sampleCount, g_x, g_y, placement);
+    float points[2 * g_capacity];
+    start = benchNs();
+    for(int r = 0; r < rounds; r ++) {
+        g_samplesUs[r % g_capacity] ^= 1;
+        geometry.graphPoints(g_samplesUs, g_capacity, placement, points);
+    }
+    double graphNs = (benchNs() - start) / rounds;
+
+    printf("createRows %d rows (%u quads) %.0f ns, layoutLabels %.0f ns (%u quads), layoutWidgets %.0f ns, "
+        "tessellating %d widgets %.0f ns (%u quads), graphPoints %u points %.0f ns\n",
+        g_rows, vertexCount / 4, rowsNs, labelsNs, batch.quadCount(), widgetsNs, tree.count(), tessellateNs, null.quads / rounds,
+        placement.count, graphNs);
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc < 2) {
+        printf("usage: OverlayGoldenTest <golden directory> [--update]\n");
+        return 1;
+    }
+    std::string goldenDir = argv[1];
+    bool update = argc > 2 && strcmp(argv[2], "--update") == 0;
+
+    const OverlayGeometry& geometry = OverlayGeometry::instance();
+    CHECK(geometry.loadError() == nullptr);
+    for(uint32_t i = 0; i < g_capacity; i ++)
+        g_samplesUs[i] = 6000 + (i * 7919) % 40000;
+
+    testPngRoundTrip();
+    testWidgetsMatchRows();
+    for(size_t i = 0; i < sizeof(g_modes) / sizeof(g_modes[0]); i ++)
+        checkMode(g_modes[i], goldenDir, update);
+    benchGeometry();
+    return testResult("OverlayGoldenTest");
+}
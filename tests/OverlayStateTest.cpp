@@ -0,0 +1,216 @@
+#include "OverlayState.h"
+#include "TestCheck.h"
+#include "MockDevice.h"
+#include <string.h>
+
+// a set of pipeline objects, one for the game and one for the overlay
+struct Objects
+{
+    Fake<ID3D11VertexShader>        vs;
+    Fake<ID3D11PixelShader>         ps;
+    Fake<ID3D11ShaderResourceView>  views[2];
+    Fake<ID3D11Buffer>              constants;
+    Fake<ID3D11SamplerState>        sampler;
+    Fake<ID3D11InputLayout>         layout;
+    Fake<ID3D11Buffer>              vb;
+    Fake<ID3D11Buffer>              ib;
+    Fake<ID3D11BlendState>          blend;
+    Fake<ID3D11DepthStencilState>   depth;
+    Fake<ID3D11RasterizerState>     raster;
+    Fake<ID3D11RenderTargetView>    target;
+    Fake<ID3D11DepthStencilView>    depthTarget;
+};
+
+static const D3D11_VIEWPORT g_overlayViewport = { 0.f, 0.f, 1920.f, 1080.f, 0.f, 1.f };
+
+// the game's pipeline: everything bound, a depth buffer, two viewports for split screen
+static void bindGame(MockContext& context, Objects& game)
+{
+    Bindings& b = context.bound;
+    b.vs = &game.vs;
+    b.ps = &game.ps;
+    b.vsResource = &game.views[0];
+    b.psResources[0] = &game.views[0];
+    b.psResources[1] = &game.views[1];
+    b.vsConstants = &game.constants;
+    b.psSampler = &game.sampler;
+    b.layout = &game.layout;
+    b.vb = &game.vb;
+    b.vbStride = 48;
+    b.vbOffset = 96;
+    b.ib = &game.ib;
+    b.ibFormat = DXGI_FORMAT_R16_UINT;
+    b.ibOffset = 12;
+    b.topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+    b.blend = &game.blend;
+    b.blendFactor[0] = 0.5f;
+    b.sampleMask = 0x0f;
+    b.depth = &game.depth;
+    b.stencilRef = 3;
+    b.raster = &game.raster;
+    b.targets[0] = &game.target;
+    b.depthTarget = &game.depthTarget;
+    D3D11_VIEWPORT left = { 0.f, 0.f, 960.f, 1080.f, 0.f, 1.f };
+    D3D11_VIEWPORT right = { 960.f, 0.f, 960.f, 1080.f, 0.f, 1.f };
+    b.viewports[0] = left;
+    b.viewports[1] = right;
+    b.viewportCount = 2;
+}
+
+// the slots of one overlay draw, as DrawNumberTool sets them
+static void drawOverlay(OverlayStateGuard& guard, Objects& overlay)
+{
+    guard.setVertexShader(&overlay.vs);
+    guard.setPixelShader(&overlay.ps);
+    guard.setVSResource(&overlay.views[0]);
+    guard.setPSResource(&overlay.views[0]);
+    guard.setPSResource(&overlay.views[1], 1);
+    guard.setVSConstants(&overlay.constants);
+    guard.setPSSampler(&overlay.sampler);
+    guard.setInputLayout(&overlay.layout);
+    guard.setVertexBuffer(&overlay.vb, 32);
+    guard.setIndexBuffer(&overlay.ib, DXGI_FORMAT_R16_UINT);
+    guard.setTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+    guard.setBlendState(&overlay.blend);
+    guard.setDepthStencilState(&overlay.depth);
+    guard.setRasterizerState(&overlay.raster);
+    guard.setRenderTarget(&overlay.target);
+    guard.setViewport(g_overlayViewport);
+}
+
+static const int g_slots = 16;
+
+// every slot differs from the game's: one Get and one Set each, one Set each to restore, and the game's
+// pipeline comes back exactly with every reference the Gets took released
+static void testFirstDraw()
+{
+    MockContext context;
+    Objects game, overlay;
+    bindGame(context, game);
+    Bindings before = context.bound;
+    {
+        OverlayStateGuard guard(&context);
+        drawOverlay(guard, overlay);
+        CHECK(context.gets == g_slots);
+        CHECK(context.sets == g_slots);
+        // one per object bound, the render target and the depth buffer each hold one
+        CHECK(g_outstanding == 15);
+        // the game's blend factor and stencil reference are kept
+        CHECK(context.bound.blendFactor[0] == 0.5f && context.bound.stencilRef == 3);
+        CHECK(context.bound.sampleMask == 0xffffffff && context.bound.depthTarget == nullptr && context.bound.viewportCount == 1);
+    }
+    CHECK(context.gets == g_slots);
+    CHECK(context.sets == 2 * g_slots);
+    CHECK(context.bound == before);
+    CHECK(g_outstanding == 0);
+}
+
+// more draws under one guard only reach the context for slots whose value changes
+static void testRepeatedDraws()
+{
+    MockContext context;
+    Objects game, overlay, other;
+    bindGame(context, game);
+    Bindings before = context.bound;
+    OverlayStateGuard guard(&context);
+    drawOverlay(guard, overlay);
+    int gets = context.gets, sets = context.sets;
+    drawOverlay(guard, overlay);
+    CHECK(context.gets == gets && context.sets == sets);
+    // a draw with another shader and vertex buffer stride
+    guard.setPixelShader(&other.ps);
+    guard.setVertexBuffer(&overlay.vb, 16);
+    guard.setTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+    CHECK(context.gets == gets && context.sets == sets + 2);
+    guard.restore();
+    CHECK(context.bound == before);
+    CHECK(g_outstanding == 0);
+    // a second restore, like the destructor's, has nothing left to do
+    sets = context.sets;
+    guard.restore();
+    CHECK(context.sets == sets);
+}
+
+// slots the overlay sets to what the game already had cost a Get and nothing else, before and after
+static void testMatchingGameState()
+{
+    MockContext context;
+    Objects overlay;
+    Bindings& b = context.bound;
+    b.vs = &overlay.vs;
+    b.topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP;
+    b.blend = &overlay.blend;
+    b.sampleMask = 0xffffffff;
+    b.targets[0] = &overlay.target;
+    b.viewports[0] = g_overlayViewport;
+    b.viewportCount = 1;
+    Bindings before = b;
+    {
+        OverlayStateGuard guard(&context);
+        guard.setVertexShader(&overlay.vs);
+        guard.setTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+        guard.setBlendState(&overlay.blend);
+        guard.setRenderTarget(&overlay.target);
+        guard.setViewport(g_overlayViewport);
+        CHECK(context.gets == 5 && context.sets == 0);
+    }
+    CHECK(context.sets == 0);
+    CHECK(context.bound == before);
+    CHECK(g_outstanding == 0);
+}
+
+// the same target but with the game's depth buffer or a second target bound still needs a Set,
+// and a blend state that matches with another sample mask too
+static void testPartialMatches()
+{
+    MockContext context;
+    Objects game, overlay;
+    context.bound.targets[0] = &overlay.target;
+    context.bound.targets[1] = &game.target;
+    context.bound.blend = &overlay.blend;
+    context.bound.sampleMask = 0x1;
+    Bindings before = context.bound;
+    {
+        OverlayStateGuard guard(&context);
+        guard.setRenderTarget(&overlay.target);
+        guard.setBlendState(&overlay.blend);
+        CHECK(context.sets == 2);
+        CHECK(context.bound.targets[1] == nullptr && context.bound.sampleMask == 0xffffffff);
+        guard.setRenderTarget(&overlay.target);
+        guard.setBlendState(&overlay.blend);
+        CHECK(context.sets == 2);
+    }
+    CHECK(context.sets == 4);
+    CHECK(context.bound == before);
+    CHECK(g_outstanding == 0);
+}
+
+// an overlay slot set back to the game's value before restore is not written again
+static void testSetBack()
+{
+    MockContext context;
+    Objects game, overlay;
+    bindGame(context, game);
+    Bindings before = context.bound;
+    {
+        OverlayStateGuard guard(&context);
+        guard.setPixelShader(&overlay.ps);
+        guard.setPixelShader(&game.ps);
+        guard.setVertexBuffer(&overlay.vb, 32);
+        CHECK(context.sets == 3);
+    }
+    // only the vertex buffer differed at the end
+    CHECK(context.sets == 4);
+    CHECK(context.bound == before);
+    CHECK(g_outstanding == 0);
+}
+
+int main()
+{
+    testFirstDraw();
+    testRepeatedDraws();
+    testMatchingGameState();
+    testPartialMatches();
+    testSetBack();
+    return testResult("OverlayStateTest");
+}
@@ -0,0 +1,229 @@
+#include "QuantileEstimator.h"
+#include "TestCheck.h"
+#include "RecordedTrace.h"
+#include <algorithm>
+#include <math.h>
+#include <vector>
+
+// deterministic uniform in [0, 1)
+class Random
+{
+public:
+    explicit Random(uint32_t seed): m_seed(seed) {}
+    double next()
+    {
+        m_seed = m_seed * 1664525u + 1013904223u;
+        return (double)(m_seed >> 8) / (double)(1u << 24);
+    }
+
+private:
+    uint32_t            m_seed;
+};
+
+// fraction of the samples below value, the rank the estimate actually has in the data
+static double rankOf(const std::vector<double>& sorted, double value)
+{
+    return (double)(std::lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin()) / (double)sorted.size();
+}
+
+// the estimate of each of p50, p95 and p99 lies within rankError of its rank and within valueError
+// (relative) of the exact quantile
+static void checkStream(const char* name, const std::vector<double>& samples, double rankError, double valueError)
+{
+    static const double ps[] = { 0.5, 0.95, 0.99 };
+    std::vector<double> sorted(samples);
+    std::sort(sorted.begin(), sorted.end());
+    for(int q = 0; q < 3; q ++) {
+        P2Quantile estimator(ps[q]);
+        for(size_t i = 0; i < samples.size(); i ++)
+            estimator.add(samples[i]);
+        double exact = sorted[(size_t)(ps[q] * (double)(sorted.size() - 1))];
+        double estimate = estimator.value();
+        double rank = rankOf(sorted, estimate);
+        bool ok = fabs(rank - ps[q]) <= rankError && fabs(estimate - exact) <= exact * valueError;
+        if(!ok)
+            printf("%s p%g: estimate %.4f exact %.4f rank %.4f\n", name, ps[q] * 100.0, estimate, exact, rank);
+        CHECK(ok);
+        CHECK(estimator.count() == samples.size());
+    }
+}
+
+// fewer than five samples are kept and answered exactly
+static void testSmallCounts()
+{
+    P2Quantile median(0.5);
+    CHECK(median.value() == 0.0);
+    median.add(30.0);
+    CHECK(median.value() == 30.0);
+    median.add(10.0);
+    median.add(20.0);
+    CHECK(median.value() == 20.0);
+    median.reset();
+    CHECK(median.count() == 0 && median.value() == 0.0);
+}
+
+static void testUniform()
+{
+    Random random(1);
+    std::vector<double> samples(100000);
+    for(size_t i = 0; i < samples.size(); i ++)
+        samples[i] = 10.0 + 10.0 * random.next();
+    checkStream("uniform", samples, 0.002, 0.002);
+}
+
+// a bell around 16.7 ms, the sum of four uniforms
+static void testBell()
+{
+    Random random(2);
+    std::vector<double> samples(100000);
+    for(size_t i = 0; i < samples.size(); i ++)
+        samples[i] = 16.7 + (random.next() + random.next() + random.next() + random.next() - 2.0) * 2.0;
+    checkStream("bell", samples, 0.002, 0.002);
+}
+
+// frame times with a long tail: 16.7 ms with 2% of frames between 33 and 100 ms, the shape the
+// p99 is meant for; the tail is sparse, so its rank is held more tightly than its value
+static void testHeavyTail()
+{
+    Random random(3);
+    std::vector<double> samples(100000);
+    for(size_t i = 0; i < samples.size(); i ++) {
+        double u = random.next();
+        samples[i] = u < 0.02 ? 33.0 + 67.0 * random.next() : 16.7 + random.next() - 0.5;
+    }
+    checkStream("heavy tail", samples, 0.002, 0.01);
+}
+
+// sorted input is the worst order for the markers, which must still not stray
+static void testSortedInput()
+{
+    std::vector<double> samples(20000);
+    for(size_t i = 0; i < samples.size(); i ++)
+        samples[i] = (double)i;
+    checkStream("ascending", samples, 0.002, 0.001);
+    std::reverse(samples.begin(), samples.end());
+    checkStream("descending", samples, 0.002, 0.001);
+}
+
+// after a change of scene the figures follow within two rotations, none of the old frames remain
+static void testRotation()
+{
+    Random random(4);
+    FrameQuantiles quantiles;
+    for(int i = 0; i < 5000; i ++)
+        quantiles.add(16.7 + random.next() - 0.5);
+    quantiles.rotate();
+    for(int i = 0; i < 5000; i ++)
+        quantiles.add(33.3 + random.next() - 0.5);
+    // the older bank still holds the 60 fps frames
+    CHECK(quantiles.value(FrameQuantiles::q_p50) < 30.0);
+    quantiles.rotate();
+    CHECK(quantiles.count() == 5000);
+    for(int i = 0; i < 5000; i ++)
+        quantiles.add(33.3 + random.next() - 0.5);
+    CHECK_NEAR(quantiles.value(FrameQuantiles::q_p50), 33.3, 0.05);
+    CHECK_NEAR(quantiles.value(FrameQuantiles::q_p99), 33.79, 0.05);
+    quantiles.reset();
+    CHECK(quantiles.count() == 0);
+}
+
+// how far an estimate is from the exact quantile of sorted, in rank and relative to its value
+static void errorsOf(const std::vector<double>& sorted, double p, double estimate, double& rankError, double& valueError)
+{
+    double exact = sorted[(size_t)(p * (double)(sorted.size() - 1))];
+    rankError = fabs(rankOf(sorted, estimate) - p);
+    valueError = fabs(estimate - exact) / exact;
+}
+
+// the frame times of data/recorded_60hz.ftc in the order they were recorded: a vsynced half stacked at
+// multiples of the refresh, then an unsynced half that follows the work. Unlike the generated streams
+// these drift, the unsynced median wanders between 2.4 and 3.6 ms, and P-square leans towards the
+// recent frames; the bounds are on the rank, since frame times come in tight clusters where a small
+// error in value spans many ranks and with gaps where a small error in rank is a large one in value.
+// The tails the overlay is for stay within a few percent, the median within a fifth
+static void testRecordedTrace(const std::string& dataDir)
+{
+    static const double ps[] = { 0.5, 0.95, 0.99 };
+    static const double rankBounds[] = { 0.2, 0.03, 0.03 };
+    CaptureFileHeader header;
+    std::vector<FrameRecord> records;
+    CHECK(readRecordedTrace(dataDir + "/recorded_60hz.ftc", header, records));
+    if(records.size() < 2)
+        return;
+    std::vector<double> samples;
+    size_t synced = 0;
+    for(size_t i = 1; i < records.size(); i ++) {
+        samples.push_back((double)(records[i].presentStart - records[i - 1].presentStart) * 1000.0 / (double)header.tickFrequency);
+        if(records[i].syncInterval)
+            synced = i;
+    }
+
+    // each half as one stream
+    for(int half = 0; half < 2; half ++) {
+        std::vector<double> stream(samples.begin() + (half ? synced : 0), half ? samples.end() : samples.begin() + synced);
+        std::vector<double> sorted(stream);
+        std::sort(sorted.begin(), sorted.end());
+        for(int q = 0; q < 3; q ++) {
+            P2Quantile estimator(ps[q]);
+            for(size_t i = 0; i < stream.size(); i ++)
+                estimator.add(stream[i]);
+            double rankError, valueError;
+            errorsOf(sorted, ps[q], estimator.value(), rankError, valueError);
+            printf("recorded %s p%g: rank off by %.3f, value by %.2f%%\n", half ? "no vsync" : "vsync", ps[q] * 100.0,
+                rankError, valueError * 100.0);
+            CHECK(rankError <= rankBounds[q]);
+        }
+    }
+
+    // the whole trace through FrameQuantiles, published every second and rotated every four as the
+    // overlay does, against the frames the bank has seen. A bank that saw the change lags behind it,
+    // P-square moves a marker one position a sample; those seconds are only counted, the overlay's
+    // figures must be back within the bounds two rotations after the change
+    FrameQuantiles quantiles;
+    double elapsed = 0.0;
+    int seconds = 0, checked = 0, mixed = 0;
+    double worstRank = 0.0, worstValue = 0.0;
+    for(size_t i = 0; i < samples.size(); i ++) {
+        quantiles.add(samples[i]);
+        elapsed += samples[i];
+        if(elapsed < 1000.0)
+            continue;
+        elapsed -= 1000.0;
+        if(++ seconds % 4 == 0)
+            quantiles.rotate();
+        size_t first = i + 1 - quantiles.count();
+        if(first < synced && i >= synced) {
+            mixed ++;
+            continue;
+        }
+        std::vector<double> window(samples.begin() + first, samples.begin() + (i + 1));
+        std::sort(window.begin(), window.end());
+        for(int q = 0; q < FrameQuantiles::quantile_count; q ++) {
+            double rankError, valueError;
+            errorsOf(window, ps[q], quantiles.value(q), rankError, valueError);
+            bool ok = rankError <= rankBounds[q];
+            if(!ok)
+                printf("recorded second %d p%g: rank off by %.3f, value by %.2f%%\n", seconds, ps[q] * 100.0, rankError, valueError * 100.0);
+            CHECK(ok);
+            worstRank = std::max(worstRank, rankError);
+            worstValue = std::max(worstValue, valueError);
+        }
+        checked ++;
+    }
+    CHECK(checked >= 20);
+    CHECK(mixed <= 8);
+    printf("recorded overlay: %d seconds, rank off by %.3f and value by %.2f%% at most, %d seconds across the change\n",
+        checked, worstRank, worstValue * 100.0, mixed);
+}
+
+int main(int argc, char** argv)
+{
+    testSmallCounts();
+    testUniform();
+    testBell();
+    testHeavyTail();
+    testSortedInput();
+    testRotation();
+    testRecordedTrace(argc > 1 ? argv[1] : "data");
+    return testResult("QuantileEstimatorTest");
+}
@@ -0,0 +1,144 @@
+#include "OverlayGeometry.h"
+#include "SoftwareRenderer.h"
+#include "BlockCompress.h"
+#include "CaptureFormat.h"
+#include "FrameArena.h"
+#include "TextLayout.h"
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Records the frame time trace in data/ that the predictor and quantile
+ * tests replay: a real frame loop on this machine, timed with
+ * clock_gettime(CLOCK_MONOTONIC), written as a version 4 capture with
+ * nanosecond ticks. Each frame renders a 1280x720 scene and the HUD with
+ * SoftwareRenderer, rebuilds the BC4 atlases every 30th frame and
+ * several times over on every 240th, the way a game streams in a new area.
+ * For the first half of the time it presents with vsync against a 60 Hz
+ * display: Present returns at the first vblank after the call and the frame
+ * is shown then. For the second half it presents without vsync. Not built
+ * as a test; RecordTrace <file> [seconds] writes a new trace.
+ */
+
+static const int        g_width = 1280;
+static const int        g_height = 720;
+static const uint64_t   g_freq = 1000000000;
+static const uint64_t   g_refresh = g_freq / 60;
+static const char* const g_labels[] = { "fps", "p50 ms", "p95 ms", "p99 ms" };
+static const int        g_rows = sizeof(g_labels) / sizeof(g_labels[0]);
+static const uint32_t   g_capacity = 120;
+
+static uint64_t now()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * g_freq + (uint64_t)ts.tv_nsec;
+}
+
+static void sleepUntil(uint64_t ticks)
+{
+    timespec ts;
+    ts.tv_sec = (time_t)(ticks / g_freq);
+    ts.tv_nsec = (long)(ticks % g_freq);
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) != 0)
+        ;
+}
+
+// the game's part of a frame: a scene that moves, and the overlay over it
+static void renderFrame(image& target, TextBatch& batch, const int numbers[g_rows], const uint32_t samplesUs[g_capacity],
+    uint64_t sampleCount, int frame)
+{
+    for(int y = 0; y < g_height; y ++) {
+        byte* p = target.get_data(0, y);
+        for(int x = 0; x < g_width; x ++, p += 4) {
+            p[0] = (byte)(x + frame);
+            p[1] = (byte)(y - frame);
+            p[2] = (byte)((x ^ y) + frame * 3);
+            p[3] = 255;
+        }
+    }
+    static const float color[4] = { 1.f, 0.85f, 0.1f, 0.9f };
+    const OverlayGeometry& geometry = OverlayGeometry::instance();
+    SoftwareRenderer renderer(target, geometry.numberAtlas(), geometry.textAtlas());
+    geometry.drawNumbers(renderer, numbers, g_rows, 15.f, 15.f, 0.f, color);
+    geometry.layoutLabels(batch, g_labels, g_rows, 15.f, 15.f, 0.f, color);
+    geometry.drawText(renderer, batch);
+    geometry.drawGraph(renderer, samplesUs, g_capacity, sampleCount, 15.f, 15.f + geometry.numberHeight() * g_rows, color);
+}
+
+int main(int argc, char** argv)
+{
+    if(argc < 2) {
+        printf("usage: RecordTrace <file> [seconds]\n");
+        return 1;
+    }
+    int seconds = argc > 2 ? atoi(argv[2]) : 30;
+    if(seconds < 1)
+        return 1;
+
+    image target;
+    target.create(image::fmt_rgba, g_width, g_height);
+    TextBatch batch;
+    std::vector<byte> blocks;
+    std::vector<FrameRecord> records;
+    records.reserve(seconds * 1000);
+    int numbers[g_rows] = { 60, 16, 17, 18 };
+    uint32_t samplesUs[g_capacity] = {};
+    uint64_t sampleCount = 0;
+
+    uint64_t vblank0 = now();
+    uint64_t unsynced = vblank0 + seconds * g_freq / 2;
+    uint64_t end = vblank0 + seconds * g_freq;
+    uint64_t lastStart = 0;
+    for(int i = 0; lastStart < end; i ++) {
+        FrameArena::current().beginFrame();
+        renderFrame(target, batch, numbers, samplesUs, sampleCount, i);
+        int encodes = i % 240 == 239 ? 24 : i % 30 == 29 ? 1 : 0;
+        for(int e = 0; e < encodes; e ++) {
+            encodeBC4(OverlayGeometry::instance().numberAtlas(), 0, blocks);
+            encodeBC4(OverlayGeometry::instance().textAtlas(), 0, blocks);
+        }
+
+        FrameRecord rec;
+        memset(&rec, 0, sizeof(rec));
+        rec.presentStart = now();
+        bool vsync = rec.presentStart < unsynced;
+        rec.syncInterval = vsync ? 1 : 0;
+        rec.presentId = (uint32_t)i + 1;
+        uint64_t refresh = (rec.presentStart - vblank0) / g_refresh + 1;
+        if(vsync)
+            sleepUntil(vblank0 + refresh * g_refresh);
+        rec.presentEnd = now();
+        rec.displayTime = vblank0 + refresh * g_refresh;
+        rec.displayRefresh = (uint32_t)refresh;
+
+        if(lastStart) {
+            uint64_t us = (rec.presentStart - lastStart) / 1000;
+            samplesUs[sampleCount % g_capacity] = (uint32_t)us;
+            sampleCount ++;
+            numbers[0] = (int)(1000000 / (us ? us : 1));
+            numbers[1] = (int)(us / 1000);
+        }
+        lastStart = rec.presentStart;
+        records.push_back(rec);
+    }
+    int frames = (int)records.size();
+
+    CaptureFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CAPTURE_MAGIC, sizeof(header.magic));
+    header.version = CAPTURE_VERSION;
+    header.recordSize = sizeof(FrameRecord);
+    header.tickFrequency = g_freq;
+    header.frameCount = frames;
+    FILE* f = fopen(argv[1], "wb");
+    if(!f)
+        return 1;
+    bool written = fwrite(&header, sizeof(header), 1, f) == 1 && fwrite(&records.front(), sizeof(FrameRecord), frames, f) == (size_t)frames;
+    fclose(f);
+    printf("%d frames, %.1f s, written to %s\n", frames, (double)(records[frames - 1].presentEnd - records[0].presentStart) / g_freq, argv[1]);
+    return written ? 0 : 1;
+}
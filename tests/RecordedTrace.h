@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CaptureFormat.h"
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+/*
+ * The frames of the capture RecordTrace wrote to data/, for the tests that
+ * replay it. Only the version 4 layout it writes is read.
+ */
+static bool readRecordedTrace(const std::string& path, CaptureFileHeader& header, std::vector<FrameRecord>& records)
+{
+    FILE* f = fopen(path.c_str(), "rb");
+    if(!f)
+        return false;
+    bool read = fread(&header, sizeof(header), 1, f) == 1 && !memcmp(header.magic, CAPTURE_MAGIC, sizeof(header.magic))
+        && header.version == CAPTURE_VERSION && header.recordSize == sizeof(FrameRecord) && header.frameCount;
+    if(read) {
+        records.resize((size_t)header.frameCount);
+        read = fread(&records.front(), sizeof(FrameRecord), records.size(), f) == records.size();
+    }
+    fclose(f);
+    if(!read)
+        printf("cannot read the recorded trace %s\n", path.c_str());
+    return read;
+}
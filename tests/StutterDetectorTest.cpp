@@ -0,0 +1,137 @@
+#include "StutterDetector.h"
+#include "TestCheck.h"
+
+static const uint64_t   g_freq = 10000000;      /* 100 ns ticks */
+
+// frame times around a level with uniform noise of +-jitter, deterministic
+class Trace
+{
+public:
+    Trace(): m_seed(1) {}
+    uint64_t next(double ms, double jitter)
+    {
+        m_seed = m_seed * 1664525u + 1013904223u;
+        double u = (double)(m_seed >> 8) / (double)(1u << 24) * 2.0 - 1.0;
+        return (uint64_t)((ms + u * jitter) * (double)g_freq / 1000.0);
+    }
+
+private:
+    uint32_t            m_seed;
+};
+
+static uint64_t ticks(double ms)
+{
+    return (uint64_t)(ms * (double)g_freq / 1000.0);
+}
+
+// the first window is only collected, nothing is reported
+static void testWarmup()
+{
+    StutterDetector detector(g_freq);
+    for(int i = 0; i < 30; i ++)
+        CHECK(detector.onFrame(ticks(i == 10 ? 200.0 : 16.7), 0) == 0);
+    CHECK(detector.onFrame(ticks(16.7), 0) == 0);
+    CHECK_NEAR(detector.medianMs(), 16.7, 0.01);
+    CHECK_NEAR(detector.baselineMs(), 16.7, 0.01);
+}
+
+// ten minutes of 60 fps with 5% noise: no hitch, no level shift
+static void testSteadyNoFalsePositives()
+{
+    StutterDetector detector(g_freq);
+    Trace trace;
+    int events = 0;
+    for(int i = 0; i < 36000; i ++)
+        events += detector.onFrame(trace.next(16.7, 0.8), 0) ? 1 : 0;
+    CHECK(events == 0);
+    CHECK_NEAR(detector.baselineMs(), 16.7, 0.2);
+}
+
+// single long frames are hitches, flagged present bound when most of the frame was blocked,
+// and they do not move the baseline
+static void testHitches()
+{
+    StutterDetector detector(g_freq);
+    Trace trace;
+    for(int i = 0; i < 200; i ++)
+        detector.onFrame(trace.next(16.7, 0.5), 0);
+    double baseline = detector.baselineMs();
+    CHECK(detector.onFrame(ticks(60.0), ticks(5.0)) == fe_hitch);
+    CHECK(detector.onFrame(trace.next(16.7, 0.5), 0) == 0);
+    CHECK(detector.onFrame(ticks(45.0), ticks(40.0)) == (fe_hitch | fe_present_bound));
+    CHECK_NEAR(detector.baselineMs(), baseline, 0.2);
+    // 2.4x the median is no hitch, and as a single frame no level shift either
+    CHECK(detector.onFrame(ticks(16.7 * 2.4), 0) == 0);
+    for(int i = 0; i < 100; i ++)
+        CHECK(detector.onFrame(trace.next(16.7, 0.5), 0) == 0);
+}
+
+// at 1000 fps a 3 ms frame is three times the median but under the 2 ms minimum step
+static void testHighFrameRate()
+{
+    StutterDetector detector(g_freq);
+    Trace trace;
+    for(int i = 0; i < 200; i ++)
+        detector.onFrame(trace.next(1.0, 0.05), 0);
+    CHECK((detector.onFrame(ticks(2.9), 0) & fe_hitch) == 0);
+    CHECK(detector.onFrame(ticks(3.5), 0) == fe_hitch);
+}
+
+// a heavier scene, 60 to 45 fps, is reported once within a few frames, then becomes the baseline
+static void testLevelShift()
+{
+    StutterDetector detector(g_freq);
+    Trace trace;
+    for(int i = 0; i < 500; i ++)
+        detector.onFrame(trace.next(16.7, 0.5), 0);
+    int first = -1;
+    int shifts = 0;
+    for(int i = 0; i < 1000; i ++) {
+        uint32_t events = detector.onFrame(trace.next(22.2, 0.5), 0);
+        CHECK((events & fe_hitch) == 0);
+        if(events & fe_level_shift) {
+            shifts ++;
+            if(first < 0)
+                first = i;
+        }
+    }
+    CHECK(first >= 0 && first < 10);
+    CHECK(shifts == 1);
+    CHECK_NEAR(detector.baselineMs(), 22.2, 0.3);
+
+    // and back up, on the low side of the CUSUM
+    first = -1;
+    shifts = 0;
+    for(int i = 0; i < 1000; i ++) {
+        if(detector.onFrame(trace.next(16.7, 0.5), 0) & fe_level_shift) {
+            shifts ++;
+            if(first < 0)
+                first = i;
+        }
+    }
+    CHECK(first >= 0 && first < 10);
+    CHECK(shifts == 1);
+}
+
+// a drift of a few percent over minutes is followed by the baseline, not reported
+static void testSlowDrift()
+{
+    StutterDetector detector(g_freq);
+    Trace trace;
+    int events = 0;
+    for(int i = 0; i < 20000; i ++)
+        events += detector.onFrame(trace.next(16.7 + 1.0 * i / 20000.0, 0.5), 0) ? 1 : 0;
+    CHECK(events == 0);
+    CHECK_NEAR(detector.baselineMs(), 17.7, 0.2);
+}
+
+int main()
+{
+    testWarmup();
+    testSteadyNoFalsePositives();
+    testHitches();
+    testHighFrameRate();
+    testLevelShift();
+    testSlowDrift();
+    return testResult("StutterDetectorTest");
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+
+/*
+ * The checks of the tests in this directory: a failed one prints where it is
+ * and is counted, and main returns the count, so ctest sees any failure.
+ */
+static int g_failures = 0;
+
+#define CHECK(cond) do { \
+        if(!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            g_failures ++; \
+        } \
+    } while(0)
+
+#define CHECK_NEAR(a, b, eps) do { \
+        double a_ = (double)(a), b_ = (double)(b); \
+        if(!(fabs(a_ - b_) <= (eps))) { \
+            printf("%s:%d: CHECK_NEAR(%s, %s) failed, %g and %g\n", __FILE__, __LINE__, #a, #b, a_, b_); \
+            g_failures ++; \
+        } \
+    } while(0)
+
+// monotonic nanoseconds, for the benchmarks
+static inline double benchNs()
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static int testResult(const char* name)
+{
+    printf("%s: %s\n", name, g_failures ? "FAILED" : "passed");
+    return g_failures;
+}
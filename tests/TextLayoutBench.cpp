@@ -0,0 +1,108 @@
+#include "TextLayout.h"
+#include "TextAtlas.h"
+#include "TestCheck.h"
+#include <string>
+#include <string.h>
+
+static const float      g_white[4] = { 1.f, 1.f, 1.f, 1.f };
+static const char* const g_labels[] = { "fps", "max ms", "hitch ms", "p50 ms", "p95 ms", "p99 ms" };
+static const int        g_labelCount = sizeof(g_labels) / sizeof(g_labels[0]);
+
+// the run against the atlas directly: one quad per inked glyph, the width the sum of the advances
+static void testRunGeometry()
+{
+    TextLayoutCache cache;
+    const char* text = "p99 ms ~";
+    float size = 18.f;
+    const TextRun* run = cache.layout(text, size);
+    CHECK(run && run->length == strlen(text) && strcmp(run->text, text) == 0);
+    float width = 0.f;
+    uint32_t quads = 0;
+    for(const char* p = text; *p; p ++) {
+        const TextGlyph& glyph = g_textGlyphs[*p - text_first_char];
+        width += glyph.advance * size / g_textAtlasLineHeight;
+        quads += glyph.width > 0 ? 1 : 0;
+    }
+    CHECK(run->quadCount == quads);
+    CHECK_NEAR(run->width, width, 1e-3);
+    // found again without a second layout, a different size is a different run
+    CHECK(cache.layout(text, size) == run && cache.runCount() == 1);
+    CHECK(cache.layout(text, 24.f) != run && cache.runCount() == 2);
+    // a string longer than the whole arena is refused
+    std::string huge(TextLayoutCache::arena_size, 'x');
+    CHECK(cache.layout(huge.c_str(), size) == nullptr);
+}
+
+// more distinct strings than the table holds: it starts over and every string still comes out right
+static void testChurn()
+{
+    TextLayoutCache cache;
+    char text[32];
+    bool allRight = true;
+    for(int i = 0; i < 10 * TextLayoutCache::table_size; i ++) {
+        snprintf(text, sizeof(text), "label %d", i);
+        const TextRun* run = cache.layout(text, 16.f);
+        allRight = allRight && run && strcmp(run->text, text) == 0 && run->size == 16.f;
+    }
+    CHECK(allRight);
+    CHECK(cache.runCount() <= TextLayoutCache::table_size * 3 / 4);
+}
+
+// the overlay's frame: the same labels at the same places come out the same every frame
+static void testSteadyFrames()
+{
+    TextBatch batch;
+    uint32_t quads = 0;
+    bool steady = true;
+    for(int frame = 0; frame < 100; frame ++) {
+        batch.clear();
+        for(int i = 0; i < g_labelCount; i ++)
+            batch.add(g_labels[i], 200.f, 10.f + 20.f * i, 18.f, g_white);
+        if(frame == 1)
+            quads = batch.quadCount();
+        else if(frame > 1)
+            steady = steady && batch.quadCount() == quads;
+    }
+    CHECK(steady && quads > 0);
+    const TextVertex* v = batch.vertices();
+    // the first glyph of "fps" sits right of x = 200 on the first line
+    CHECK(v && v[0].position[0] >= 200.f && v[0].position[1] >= 10.f && v[3].position[1] <= 10.f + 18.f);
+}
+
+int main()
+{
+    testRunGeometry();
+    testChurn();
+    testSteadyFrames();
+
+    const int rounds = 200000;
+    TextLayoutCache cache;
+    float sink = 0.f;
+    // a label drawn every frame: one hash and one compare
+    double start = benchNs();
+    for(int r = 0; r < rounds; r ++)
+        sink += cache.layout(g_labels[r % g_labelCount], 18.f)->width;
+    double hitNs = (benchNs() - start) / rounds;
+    // what every frame would cost without the cache
+    start = benchNs();
+    for(int r = 0; r < rounds; r ++) {
+        if(r % g_labelCount == 0)
+            cache.clear();
+        sink += cache.layout(g_labels[r % g_labelCount], 18.f)->width;
+    }
+    double missNs = (benchNs() - start) / rounds;
+    // a whole overlay frame of labels into the batch
+    TextBatch batch;
+    start = benchNs();
+    for(int r = 0; r < rounds / g_labelCount; r ++) {
+        batch.clear();
+        for(int i = 0; i < g_labelCount; i ++)
+            batch.add(g_labels[i], 200.f, 10.f + 20.f * i, 18.f, g_white);
+    }
+    double frameNs = (benchNs() - start) / (rounds / g_labelCount);
+    CHECK(hitNs < missNs);
+
+    printf("layout cached %.1f ns, uncached %.1f ns, frame of %d labels (%u quads) %.1f ns (%d)\n",
+        hitNs, missNs, g_labelCount, batch.quadCount(), frameNs, (int)sink & 1);
+    return testResult("TextLayoutBench");
+}
@@ -0,0 +1,258 @@
+#pragma once
+
+/*
+ * A D3D11 device, immediate context and swapchain that draw nothing. The
+ * context keeps what is bound and counts the Gets and Sets reaching it, the
+ * device counts what it creates; buffers keep their contents so Map and
+ * UpdateSubresource have somewhere to write. References the Gets hand out
+ * are counted in g_outstanding, objects the device creates delete themselves
+ * at their last Release like the real ones.
+ */
+
+#include <d3d11.h>
+#include <string.h>
+#include <vector>
+
+// references handed out by the mock's Gets and not released yet
+static int g_outstanding = 0;
+
+template<class Interface>
+struct Fake : Interface
+{
+    ULONG AddRef() { return (ULONG)++ g_outstanding; }
+    ULONG Release() { return (ULONG)-- g_outstanding; }
+};
+
+// what a mock device creates
+template<class Interface>
+struct Created : Interface
+{
+    ULONG               refs;
+
+    Created(): refs(1) {}
+    ULONG AddRef() { return ++ refs; }
+    ULONG Release()
+    {
+        ULONG left = -- refs;
+        if(left == 0)
+            delete this;
+        return left;
+    }
+};
+
+struct MockBuffer : Created<ID3D11Buffer>
+{
+    std::vector<BYTE>   data;
+};
+
+template<class Interface>
+static Interface* addRef(Interface* p)
+{
+    if(p)
+        p->AddRef();
+    return p;
+}
+
+// what is bound on the mock context
+struct Bindings
+{
+    ID3D11VertexShader*         vs;
+    ID3D11PixelShader*          ps;
+    ID3D11ShaderResourceView*   vsResource;
+    ID3D11ShaderResourceView*   psResources[2];
+    ID3D11Buffer*               vsConstants;
+    ID3D11SamplerState*         psSampler;
+    ID3D11InputLayout*          layout;
+    ID3D11Buffer*               vb;
+    UINT                        vbStride;
+    UINT                        vbOffset;
+    ID3D11Buffer*               ib;
+    DXGI_FORMAT                 ibFormat;
+    UINT                        ibOffset;
+    D3D11_PRIMITIVE_TOPOLOGY    topology;
+    ID3D11BlendState*           blend;
+    FLOAT                       blendFactor[4];
+    UINT                        sampleMask;
+    ID3D11DepthStencilState*    depth;
+    UINT                        stencilRef;
+    ID3D11RasterizerState*      raster;
+    ID3D11RenderTargetView*     targets[D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT];
+    ID3D11DepthStencilView*     depthTarget;
+    D3D11_VIEWPORT              viewports[D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE];
+    UINT                        viewportCount;
+
+    Bindings() { memset(this, 0, sizeof(*this)); }
+    bool operator==(const Bindings& that) const { return memcmp(this, &that, sizeof(*this)) == 0; }
+};
+
+// a context that keeps its bindings and counts the calls reaching it
+class MockContext : public Fake<ID3D11DeviceContext>
+{
+public:
+    Bindings            bound;
+    int                 gets;
+    int                 sets;
+    int                 maps;
+    int                 draws;
+
+    MockContext(): gets(0), sets(0), maps(0), draws(0) {}
+
+    void VSGetShader(ID3D11VertexShader** ppShader, ID3D11ClassInstance**, UINT* pNumInstances)
+    { gets ++; *ppShader = addRef(bound.vs); *pNumInstances = 0; }
+    void VSSetShader(ID3D11VertexShader* pShader, ID3D11ClassInstance* const*, UINT) { sets ++; bound.vs = pShader; }
+    void PSGetShader(ID3D11PixelShader** ppShader, ID3D11ClassInstance**, UINT* pNumInstances)
+    { gets ++; *ppShader = addRef(bound.ps); *pNumInstances = 0; }
+    void PSSetShader(ID3D11PixelShader* pShader, ID3D11ClassInstance* const*, UINT) { sets ++; bound.ps = pShader; }
+    void VSGetShaderResources(UINT, UINT, ID3D11ShaderResourceView** ppViews) { gets ++; *ppViews = addRef(bound.vsResource); }
+    void VSSetShaderResources(UINT, UINT, ID3D11ShaderResourceView* const* ppViews) { sets ++; bound.vsResource = *ppViews; }
+    void PSGetShaderResources(UINT slot, UINT, ID3D11ShaderResourceView** ppViews) { gets ++; *ppViews = addRef(bound.psResources[slot]); }
+    void PSSetShaderResources(UINT slot, UINT, ID3D11ShaderResourceView* const* ppViews) { sets ++; bound.psResources[slot] = *ppViews; }
+    void VSGetConstantBuffers(UINT, UINT, ID3D11Buffer** ppBuffers) { gets ++; *ppBuffers = addRef(bound.vsConstants); }
+    void VSSetConstantBuffers(UINT, UINT, ID3D11Buffer* const* ppBuffers) { sets ++; bound.vsConstants = *ppBuffers; }
+    void PSGetSamplers(UINT, UINT, ID3D11SamplerState** ppSamplers) { gets ++; *ppSamplers = addRef(bound.psSampler); }
+    void PSSetSamplers(UINT, UINT, ID3D11SamplerState* const* ppSamplers) { sets ++; bound.psSampler = *ppSamplers; }
+    void IAGetInputLayout(ID3D11InputLayout** ppLayout) { gets ++; *ppLayout = addRef(bound.layout); }
+    void IASetInputLayout(ID3D11InputLayout* pLayout) { sets ++; bound.layout = pLayout; }
+    void IAGetVertexBuffers(UINT, UINT, ID3D11Buffer** ppBuffers, UINT* pStrides, UINT* pOffsets)
+    { gets ++; *ppBuffers = addRef(bound.vb); *pStrides = bound.vbStride; *pOffsets = bound.vbOffset; }
+    void IASetVertexBuffers(UINT, UINT, ID3D11Buffer* const* ppBuffers, const UINT* pStrides, const UINT* pOffsets)
+    { sets ++; bound.vb = *ppBuffers; bound.vbStride = *pStrides; bound.vbOffset = *pOffsets; }
+    void IAGetIndexBuffer(ID3D11Buffer** ppBuffer, DXGI_FORMAT* pFormat, UINT* pOffset)
+    { gets ++; *ppBuffer = addRef(bound.ib); *pFormat = bound.ibFormat; *pOffset = bound.ibOffset; }
+    void IASetIndexBuffer(ID3D11Buffer* pBuffer, DXGI_FORMAT format, UINT offset)
+    { sets ++; bound.ib = pBuffer; bound.ibFormat = format; bound.ibOffset = offset; }
+    void IAGetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY* pTopology) { gets ++; *pTopology = bound.topology; }
+    void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology) { sets ++; bound.topology = topology; }
+    void OMGetBlendState(ID3D11BlendState** ppState, FLOAT blendFactor[4], UINT* pSampleMask)
+    { gets ++; *ppState = addRef(bound.blend); memcpy(blendFactor, bound.blendFactor, sizeof(bound.blendFactor)); *pSampleMask = bound.sampleMask; }
+    void OMSetBlendState(ID3D11BlendState* pState, const FLOAT blendFactor[4], UINT sampleMask)
+    { sets ++; bound.blend = pState; memcpy(bound.blendFactor, blendFactor, sizeof(bound.blendFactor)); bound.sampleMask = sampleMask; }
+    void OMGetDepthStencilState(ID3D11DepthStencilState** ppState, UINT* pStencilRef)
+    { gets ++; *ppState = addRef(bound.depth); *pStencilRef = bound.stencilRef; }
+    void OMSetDepthStencilState(ID3D11DepthStencilState* pState, UINT stencilRef) { sets ++; bound.depth = pState; bound.stencilRef = stencilRef; }
+    void RSGetState(ID3D11RasterizerState** ppState) { gets ++; *ppState = addRef(bound.raster); }
+    void RSSetState(ID3D11RasterizerState* pState) { sets ++; bound.raster = pState; }
+    void OMGetRenderTargets(UINT numViews, ID3D11RenderTargetView** ppTargets, ID3D11DepthStencilView** ppDepth)
+    {
+        gets ++;
+        for(UINT i = 0; i < numViews; i ++)
+            ppTargets[i] = addRef(bound.targets[i]);
+        *ppDepth = addRef(bound.depthTarget);
+    }
+    void OMSetRenderTargets(UINT numViews, ID3D11RenderTargetView* const* ppTargets, ID3D11DepthStencilView* pDepth)
+    {
+        sets ++;
+        for(UINT i = 0; i < D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT; i ++)
+            bound.targets[i] = i < numViews ? ppTargets[i] : nullptr;
+        bound.depthTarget = pDepth;
+    }
+    void RSGetViewports(UINT* pNumViewports, D3D11_VIEWPORT* pViewports)
+    {
+        gets ++;
+        memcpy(pViewports, bound.viewports, bound.viewportCount * sizeof(D3D11_VIEWPORT));
+        *pNumViewports = bound.viewportCount;
+    }
+    void RSSetViewports(UINT numViewports, const D3D11_VIEWPORT* pViewports)
+    {
+        sets ++;
+        memset(bound.viewports, 0, sizeof(bound.viewports));
+        memcpy(bound.viewports, pViewports, numViewports * sizeof(D3D11_VIEWPORT));
+        bound.viewportCount = numViewports;
+    }
+    HRESULT Map(ID3D11Resource* pResource, UINT, D3D11_MAP, UINT, D3D11_MAPPED_SUBRESOURCE* pMapped)
+    {
+        MockBuffer* pBuffer = dynamic_cast<MockBuffer*>(pResource);
+        if(!pBuffer || pBuffer->data.empty())
+            return E_FAIL;
+        maps ++;
+        pMapped->pData = &pBuffer->data.front();
+        pMapped->RowPitch = (UINT)pBuffer->data.size();
+        pMapped->DepthPitch = pMapped->RowPitch;
+        return S_OK;
+    }
+    void Unmap(ID3D11Resource*, UINT) {}
+    void UpdateSubresource(ID3D11Resource* pResource, UINT, const D3D11_BOX* pBox, const void* pData, UINT, UINT)
+    {
+        MockBuffer* pBuffer = dynamic_cast<MockBuffer*>(pResource);
+        if(!pBuffer)
+            return;
+        UINT first = pBox ? pBox->left : 0;
+        UINT end = pBox ? pBox->right : (UINT)pBuffer->data.size();
+        if(first < end && end <= pBuffer->data.size())
+            memcpy(&pBuffer->data[first], pData, end - first);
+    }
+    void ClearRenderTargetView(ID3D11RenderTargetView*, const FLOAT[4]) {}
+    void Draw(UINT, UINT) { draws ++; }
+    void DrawIndexed(UINT, UINT, int) { draws ++; }
+};
+
+// a device whose objects are only references to count
+class MockDevice : public Fake<ID3D11Device>
+{
+public:
+    MockContext         immediate;
+    int                 creates;
+
+    MockDevice(): creates(0) {}
+
+    HRESULT CreateBuffer(const D3D11_BUFFER_DESC* pDesc, const D3D11_SUBRESOURCE_DATA* pData, ID3D11Buffer** ppBuffer)
+    {
+        creates ++;
+        MockBuffer* pBuffer = new MockBuffer;
+        pBuffer->data.resize(pDesc->ByteWidth);
+        if(pData)
+            memcpy(&pBuffer->data.front(), pData->pSysMem, pDesc->ByteWidth);
+        *ppBuffer = pBuffer;
+        return S_OK;
+    }
+    HRESULT CreateTexture2D(const D3D11_TEXTURE2D_DESC*, const D3D11_SUBRESOURCE_DATA*, ID3D11Texture2D** ppTexture)
+    { return create(ppTexture); }
+    HRESULT CreateShaderResourceView(ID3D11Resource*, const D3D11_SHADER_RESOURCE_VIEW_DESC*, ID3D11ShaderResourceView** ppView)
+    { return create(ppView); }
+    HRESULT CreateRenderTargetView(ID3D11Resource*, const D3D11_RENDER_TARGET_VIEW_DESC*, ID3D11RenderTargetView** ppView)
+    { return create(ppView); }
+    HRESULT CreateSamplerState(const D3D11_SAMPLER_DESC*, ID3D11SamplerState** ppState) { return create(ppState); }
+    HRESULT CreateVertexShader(const void*, size_t, ID3D11ClassInstance*, ID3D11VertexShader** ppShader) { return create(ppShader); }
+    HRESULT CreatePixelShader(const void*, size_t, ID3D11ClassInstance*, ID3D11PixelShader** ppShader) { return create(ppShader); }
+    HRESULT CreateInputLayout(const D3D11_INPUT_ELEMENT_DESC*, UINT, const void*, size_t, ID3D11InputLayout** ppLayout)
+    { return create(ppLayout); }
+    HRESULT CreateBlendState(const D3D11_BLEND_DESC*, ID3D11BlendState** ppState) { return create(ppState); }
+    HRESULT CreateDepthStencilState(const D3D11_DEPTH_STENCIL_DESC*, ID3D11DepthStencilState** ppState) { return create(ppState); }
+    HRESULT CreateRasterizerState(const D3D11_RASTERIZER_DESC*, ID3D11RasterizerState** ppState) { return create(ppState); }
+    HRESULT CheckFormatSupport(DXGI_FORMAT format, UINT* pSupport)
+    {
+        *pSupport = format == DXGI_FORMAT_BC4_UNORM ? D3D11_FORMAT_SUPPORT_TEXTURE2D : 0;
+        return S_OK;
+    }
+    HRESULT CheckFeatureSupport(D3D11_FEATURE feature, void* pData, UINT)
+    {
+        if(feature != D3D11_FEATURE_D3D11_OPTIONS)
+            return E_FAIL;
+        ((D3D11_FEATURE_DATA_D3D11_OPTIONS*)pData)->MapNoOverwriteOnDynamicBufferSRV = TRUE;
+        return S_OK;
+    }
+    void GetImmediateContext(ID3D11DeviceContext** ppContext) { *ppContext = addRef(&immediate); }
+
+private:
+    template<class Interface>
+    HRESULT create(Interface** pp)
+    {
+        creates ++;
+        *pp = new Created<Interface>;
+        return S_OK;
+    }
+};
+
+class MockSwapChain : public Fake<IDXGISwapChain>
+{
+public:
+    MockDevice*         pDevice;
+
+    MockSwapChain(MockDevice* p): pDevice(p) {}
+
+    HRESULT GetDevice(REFIID, void** ppDevice)
+    {
+        *ppDevice = addRef(static_cast<ID3D11Device*>(pDevice));
+        return S_OK;
+    }
+};
@@ -0,0 +1,60 @@
+#pragma once
+
+/*
+ * The few Win32 types and calls the hook's D3D11 code uses besides D3D11
+ * itself, for building it on Linux. The tests run on one thread, so the
+ * locks do nothing.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef unsigned char           BYTE;
+typedef unsigned int            UINT;
+typedef unsigned long           ULONG;
+typedef unsigned long           DWORD;
+typedef long                    LONG;
+typedef float                   FLOAT;
+typedef int                     BOOL;
+typedef int32_t                 HRESULT;
+typedef void*                   HANDLE;
+typedef void*                   LPVOID;
+
+#define TRUE                    1
+#define FALSE                   0
+#define S_OK                    ((HRESULT)0)
+#define E_FAIL                  ((HRESULT)0x80004005)
+#define SUCCEEDED(hr)           ((HRESULT)(hr) >= 0)
+#define FAILED(hr)              ((HRESULT)(hr) < 0)
+#define __stdcall
+#define MB_OK                   0
+
+#define ZeroMemory(p, size)     memset((p), 0, (size))
+#define _snprintf               snprintf
+
+struct FILETIME
+{
+    DWORD               dwLowDateTime;
+    DWORD               dwHighDateTime;
+};
+
+struct SRWLOCK
+{
+    void*               Ptr;
+};
+
+#define SRWLOCK_INIT            { nullptr }
+
+inline void InitializeSRWLock(SRWLOCK*) {}
+inline void AcquireSRWLockShared(SRWLOCK*) {}
+inline void ReleaseSRWLockShared(SRWLOCK*) {}
+inline void AcquireSRWLockExclusive(SRWLOCK*) {}
+inline void ReleaseSRWLockExclusive(SRWLOCK*) {}
+
+inline int MessageBoxA(void*, const char* text, const char*, UINT)
+{
+    fprintf(stderr, "%s\n", text);
+    return 0;
+}
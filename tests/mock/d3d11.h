@@ -0,0 +1,222 @@
+#pragma once
+
+/*
+ * Just enough of d3d11.h to build the hook's D3D11 code on Linux against the
+ * mock device and context of the tests. Interfaces carry the methods that
+ * code calls, with the SDK's signatures less the calling convention; the
+ * device's, the context's and the swapchain's are pure, so a mock has to
+ * account for every one of them. IIDs are not modelled, __uuidof is 0.
+ */
+
+#include <Windows.h>
+#include <float.h>
+
+typedef int                     REFIID;
+#define __uuidof(type)          0
+
+enum DXGI_FORMAT
+{
+    DXGI_FORMAT_UNKNOWN = 0,
+    DXGI_FORMAT_R32G32B32A32_FLOAT = 2,
+    DXGI_FORMAT_R32G32_FLOAT = 16,
+    DXGI_FORMAT_R8G8B8A8_UNORM = 28,
+    DXGI_FORMAT_R32_FLOAT = 41,
+    DXGI_FORMAT_R32_UINT = 42,
+    DXGI_FORMAT_R16_UINT = 57,
+    DXGI_FORMAT_R8_UNORM = 61,
+    DXGI_FORMAT_BC4_UNORM = 80,
+};
+
+enum D3D11_PRIMITIVE_TOPOLOGY
+{
+    D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED = 0,
+    D3D11_PRIMITIVE_TOPOLOGY_POINTLIST = 1,
+    D3D11_PRIMITIVE_TOPOLOGY_LINELIST = 2,
+    D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP = 3,
+    D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4,
+    D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP = 5,
+};
+
+enum D3D11_USAGE { D3D11_USAGE_DEFAULT, D3D11_USAGE_IMMUTABLE, D3D11_USAGE_DYNAMIC, D3D11_USAGE_STAGING };
+enum D3D11_MAP { D3D11_MAP_READ = 1, D3D11_MAP_WRITE, D3D11_MAP_READ_WRITE, D3D11_MAP_WRITE_DISCARD, D3D11_MAP_WRITE_NO_OVERWRITE };
+enum D3D11_SRV_DIMENSION { D3D11_SRV_DIMENSION_BUFFER = 1, D3D11_SRV_DIMENSION_TEXTURE2D = 4 };
+enum D3D11_TEXTURE_ADDRESS_MODE { D3D11_TEXTURE_ADDRESS_WRAP = 1, D3D11_TEXTURE_ADDRESS_CLAMP = 3 };
+enum D3D11_COMPARISON_FUNC { D3D11_COMPARISON_NEVER = 1, D3D11_COMPARISON_ALWAYS = 8 };
+enum D3D11_FILTER { D3D11_FILTER_MIN_MAG_MIP_LINEAR = 0x15 };
+enum D3D11_INPUT_CLASSIFICATION { D3D11_INPUT_PER_VERTEX_DATA, D3D11_INPUT_PER_INSTANCE_DATA };
+enum D3D11_BLEND { D3D11_BLEND_ONE = 2, D3D11_BLEND_SRC_ALPHA = 5, D3D11_BLEND_INV_SRC_ALPHA = 6 };
+enum D3D11_BLEND_OP { D3D11_BLEND_OP_ADD = 1 };
+enum D3D11_FILL_MODE { D3D11_FILL_SOLID = 3 };
+enum D3D11_CULL_MODE { D3D11_CULL_NONE = 1 };
+enum D3D11_DEPTH_WRITE_MASK { D3D11_DEPTH_WRITE_MASK_ZERO, D3D11_DEPTH_WRITE_MASK_ALL };
+enum D3D11_FEATURE { D3D11_FEATURE_THREADING = 0, D3D11_FEATURE_D3D11_OPTIONS = 7 };
+enum D3D11_DEVICE_CONTEXT_TYPE { D3D11_DEVICE_CONTEXT_IMMEDIATE, D3D11_DEVICE_CONTEXT_DEFERRED };
+
+#define D3D11_BIND_VERTEX_BUFFER                                    0x1
+#define D3D11_BIND_INDEX_BUFFER                                     0x2
+#define D3D11_BIND_CONSTANT_BUFFER                                  0x4
+#define D3D11_BIND_SHADER_RESOURCE                                  0x8
+#define D3D11_BIND_RENDER_TARGET                                    0x20
+#define D3D11_CPU_ACCESS_WRITE                                      0x10000
+#define D3D11_FORMAT_SUPPORT_TEXTURE2D                              0x20
+#define D3D11_COLOR_WRITE_ENABLE_ALL                                15
+#define D3D11_APPEND_ALIGNED_ELEMENT                                0xffffffff
+#define D3D11_FLOAT32_MAX                                           FLT_MAX
+#define D3D11_SHADER_MAX_INTERFACES                                 253
+#define D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT                      8
+#define D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE    16
+
+struct DXGI_SAMPLE_DESC
+{
+    UINT                Count;
+    UINT                Quality;
+};
+
+struct D3D11_VIEWPORT
+{
+    FLOAT               TopLeftX;
+    FLOAT               TopLeftY;
+    FLOAT               Width;
+    FLOAT               Height;
+    FLOAT               MinDepth;
+    FLOAT               MaxDepth;
+};
+
+struct D3D11_BOX { UINT left, top, front, right, bottom, back; };
+struct D3D11_BUFFER_DESC { UINT ByteWidth; D3D11_USAGE Usage; UINT BindFlags, CPUAccessFlags, MiscFlags, StructureByteStride; };
+struct D3D11_TEXTURE2D_DESC
+{
+    UINT Width, Height, MipLevels, ArraySize;
+    DXGI_FORMAT Format;
+    DXGI_SAMPLE_DESC SampleDesc;
+    D3D11_USAGE Usage;
+    UINT BindFlags, CPUAccessFlags, MiscFlags;
+};
+struct D3D11_SUBRESOURCE_DATA { const void* pSysMem; UINT SysMemPitch, SysMemSlicePitch; };
+struct D3D11_MAPPED_SUBRESOURCE { void* pData; UINT RowPitch, DepthPitch; };
+struct D3D11_BUFFER_SRV { UINT FirstElement, NumElements; };
+struct D3D11_SHADER_RESOURCE_VIEW_DESC { DXGI_FORMAT Format; D3D11_SRV_DIMENSION ViewDimension; D3D11_BUFFER_SRV Buffer; };
+struct D3D11_RENDER_TARGET_VIEW_DESC;
+struct D3D11_SAMPLER_DESC
+{
+    D3D11_FILTER Filter;
+    D3D11_TEXTURE_ADDRESS_MODE AddressU, AddressV, AddressW;
+    FLOAT MipLODBias;
+    UINT MaxAnisotropy;
+    D3D11_COMPARISON_FUNC ComparisonFunc;
+    FLOAT BorderColor[4];
+    FLOAT MinLOD, MaxLOD;
+};
+struct D3D11_INPUT_ELEMENT_DESC
+{
+    const char* SemanticName;
+    UINT SemanticIndex;
+    DXGI_FORMAT Format;
+    UINT InputSlot, AlignedByteOffset;
+    D3D11_INPUT_CLASSIFICATION InputSlotClass;
+    UINT InstanceDataStepRate;
+};
+struct D3D11_RENDER_TARGET_BLEND_DESC
+{
+    BOOL BlendEnable;
+    D3D11_BLEND SrcBlend, DestBlend;
+    D3D11_BLEND_OP BlendOp;
+    D3D11_BLEND SrcBlendAlpha, DestBlendAlpha;
+    D3D11_BLEND_OP BlendOpAlpha;
+    BYTE RenderTargetWriteMask;
+};
+struct D3D11_BLEND_DESC { BOOL AlphaToCoverageEnable, IndependentBlendEnable; D3D11_RENDER_TARGET_BLEND_DESC RenderTarget[8]; };
+struct D3D11_DEPTH_STENCIL_DESC { BOOL DepthEnable; D3D11_DEPTH_WRITE_MASK DepthWriteMask; D3D11_COMPARISON_FUNC DepthFunc; BOOL StencilEnable; };
+struct D3D11_RASTERIZER_DESC { D3D11_FILL_MODE FillMode; D3D11_CULL_MODE CullMode; BOOL FrontCounterClockwise; BOOL DepthClipEnable; };
+struct D3D11_FEATURE_DATA_D3D11_OPTIONS { BOOL MapNoOverwriteOnDynamicConstantBuffer; BOOL MapNoOverwriteOnDynamicBufferSRV; };
+
+struct IUnknown
+{
+    virtual ~IUnknown() {}
+    virtual ULONG AddRef() = 0;
+    virtual ULONG Release() = 0;
+};
+
+struct ID3D11DeviceChild : IUnknown {};
+struct ID3D11Resource : ID3D11DeviceChild {};
+struct ID3D11Buffer : ID3D11Resource {};
+struct ID3D11Texture2D : ID3D11Resource {};
+struct ID3D11VertexShader : ID3D11DeviceChild {};
+struct ID3D11PixelShader : ID3D11DeviceChild {};
+struct ID3D11ClassInstance : ID3D11DeviceChild {};
+struct ID3D11ShaderResourceView : ID3D11DeviceChild {};
+struct ID3D11SamplerState : ID3D11DeviceChild {};
+struct ID3D11InputLayout : ID3D11DeviceChild {};
+struct ID3D11BlendState : ID3D11DeviceChild {};
+struct ID3D11DepthStencilState : ID3D11DeviceChild {};
+struct ID3D11RasterizerState : ID3D11DeviceChild {};
+struct ID3D11RenderTargetView : ID3D11DeviceChild {};
+struct ID3D11DepthStencilView : ID3D11DeviceChild {};
+
+struct ID3D11DeviceContext : ID3D11DeviceChild
+{
+    virtual void VSGetShader(ID3D11VertexShader** ppShader, ID3D11ClassInstance** ppInstances, UINT* pNumInstances) = 0;
+    virtual void VSSetShader(ID3D11VertexShader* pShader, ID3D11ClassInstance* const* ppInstances, UINT numInstances) = 0;
+    virtual void PSGetShader(ID3D11PixelShader** ppShader, ID3D11ClassInstance** ppInstances, UINT* pNumInstances) = 0;
+    virtual void PSSetShader(ID3D11PixelShader* pShader, ID3D11ClassInstance* const* ppInstances, UINT numInstances) = 0;
+    virtual void VSGetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView** ppViews) = 0;
+    virtual void VSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* ppViews) = 0;
+    virtual void PSGetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView** ppViews) = 0;
+    virtual void PSSetShaderResources(UINT startSlot, UINT numViews, ID3D11ShaderResourceView* const* ppViews) = 0;
+    virtual void VSGetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer** ppBuffers) = 0;
+    virtual void VSSetConstantBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* ppBuffers) = 0;
+    virtual void PSGetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState** ppSamplers) = 0;
+    virtual void PSSetSamplers(UINT startSlot, UINT numSamplers, ID3D11SamplerState* const* ppSamplers) = 0;
+    virtual void IAGetInputLayout(ID3D11InputLayout** ppLayout) = 0;
+    virtual void IASetInputLayout(ID3D11InputLayout* pLayout) = 0;
+    virtual void IAGetVertexBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer** ppBuffers, UINT* pStrides, UINT* pOffsets) = 0;
+    virtual void IASetVertexBuffers(UINT startSlot, UINT numBuffers, ID3D11Buffer* const* ppBuffers, const UINT* pStrides, const UINT* pOffsets) = 0;
+    virtual void IAGetIndexBuffer(ID3D11Buffer** ppBuffer, DXGI_FORMAT* pFormat, UINT* pOffset) = 0;
+    virtual void IASetIndexBuffer(ID3D11Buffer* pBuffer, DXGI_FORMAT format, UINT offset) = 0;
+    virtual void IAGetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY* pTopology) = 0;
+    virtual void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology) = 0;
+    virtual void OMGetBlendState(ID3D11BlendState** ppState, FLOAT blendFactor[4], UINT* pSampleMask) = 0;
+    virtual void OMSetBlendState(ID3D11BlendState* pState, const FLOAT blendFactor[4], UINT sampleMask) = 0;
+    virtual void OMGetDepthStencilState(ID3D11DepthStencilState** ppState, UINT* pStencilRef) = 0;
+    virtual void OMSetDepthStencilState(ID3D11DepthStencilState* pState, UINT stencilRef) = 0;
+    virtual void RSGetState(ID3D11RasterizerState** ppState) = 0;
+    virtual void RSSetState(ID3D11RasterizerState* pState) = 0;
+    virtual void OMGetRenderTargets(UINT numViews, ID3D11RenderTargetView** ppTargets, ID3D11DepthStencilView** ppDepth) = 0;
+    virtual void OMSetRenderTargets(UINT numViews, ID3D11RenderTargetView* const* ppTargets, ID3D11DepthStencilView* pDepth) = 0;
+    virtual void RSGetViewports(UINT* pNumViewports, D3D11_VIEWPORT* pViewports) = 0;
+    virtual void RSSetViewports(UINT numViewports, const D3D11_VIEWPORT* pViewports) = 0;
+    virtual HRESULT Map(ID3D11Resource* pResource, UINT subresource, D3D11_MAP mapType, UINT mapFlags, D3D11_MAPPED_SUBRESOURCE* pMapped) = 0;
+    virtual void Unmap(ID3D11Resource* pResource, UINT subresource) = 0;
+    virtual void UpdateSubresource(ID3D11Resource* pResource, UINT subresource, const D3D11_BOX* pBox, const void* pData,
+        UINT rowPitch, UINT depthPitch) = 0;
+    virtual void ClearRenderTargetView(ID3D11RenderTargetView* pTarget, const FLOAT color[4]) = 0;
+    virtual void Draw(UINT vertexCount, UINT startVertex) = 0;
+    virtual void DrawIndexed(UINT indexCount, UINT startIndex, int baseVertex) = 0;
+};
+
+struct ID3D11Device : IUnknown
+{
+    virtual HRESULT CreateBuffer(const D3D11_BUFFER_DESC* pDesc, const D3D11_SUBRESOURCE_DATA* pData, ID3D11Buffer** ppBuffer) = 0;
+    virtual HRESULT CreateTexture2D(const D3D11_TEXTURE2D_DESC* pDesc, const D3D11_SUBRESOURCE_DATA* pData, ID3D11Texture2D** ppTexture) = 0;
+    virtual HRESULT CreateShaderResourceView(ID3D11Resource* pResource, const D3D11_SHADER_RESOURCE_VIEW_DESC* pDesc,
+        ID3D11ShaderResourceView** ppView) = 0;
+    virtual HRESULT CreateRenderTargetView(ID3D11Resource* pResource, const D3D11_RENDER_TARGET_VIEW_DESC* pDesc,
+        ID3D11RenderTargetView** ppView) = 0;
+    virtual HRESULT CreateSamplerState(const D3D11_SAMPLER_DESC* pDesc, ID3D11SamplerState** ppState) = 0;
+    virtual HRESULT CreateVertexShader(const void* pBytecode, size_t length, ID3D11ClassInstance* pLinkage, ID3D11VertexShader** ppShader) = 0;
+    virtual HRESULT CreatePixelShader(const void* pBytecode, size_t length, ID3D11ClassInstance* pLinkage, ID3D11PixelShader** ppShader) = 0;
+    virtual HRESULT CreateInputLayout(const D3D11_INPUT_ELEMENT_DESC* pDescs, UINT count, const void* pBytecode, size_t length,
+        ID3D11InputLayout** ppLayout) = 0;
+    virtual HRESULT CreateBlendState(const D3D11_BLEND_DESC* pDesc, ID3D11BlendState** ppState) = 0;
+    virtual HRESULT CreateDepthStencilState(const D3D11_DEPTH_STENCIL_DESC* pDesc, ID3D11DepthStencilState** ppState) = 0;
+    virtual HRESULT CreateRasterizerState(const D3D11_RASTERIZER_DESC* pDesc, ID3D11RasterizerState** ppState) = 0;
+    virtual HRESULT CheckFormatSupport(DXGI_FORMAT format, UINT* pSupport) = 0;
+    virtual HRESULT CheckFeatureSupport(D3D11_FEATURE feature, void* pData, UINT size) = 0;
+    virtual void GetImmediateContext(ID3D11DeviceContext** ppContext) = 0;
+};
+
+// of dxgi.h, which the real d3d11.h includes
+struct IDXGISwapChain : IUnknown
+{
+    virtual HRESULT GetDevice(REFIID riid, void** ppDevice) = 0;
+};
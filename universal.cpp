@@ -1,65 +1,73 @@
 ﻿#include <Windows.h>
+#include <atomic>
 #include <vector>
 #include <unordered_map>
 #include <d3d11.h>
+#include <dxgi1_2.h>
 #include <stdio.h>
 #include "DrawNumber.h"
+#include "TextLayout.h"
+#include "Config.h"
+#include "Benchmark.h"
+#include "ControlChannel.h"
+#include "FrameCapture.h"
+#include "FrameClock.h"
+#include "FramePacer.h"
+#include "DeviceActivity.h"
+#include "StutterDetector.h"
+#include "FrameHistogram.h"
+#include "LatencyControl.h"
+#include "TextFormat.h"
+#include "SwapChainStats.h"
+#include "DisplayTimeline.h"
+#include "OverlayRecorder.h"
+#include "FrameArena.h"
 
 #pragma comment(lib, "d3d11.lib")
 #pragma comment(lib, "dxgi.lib")
 
 #include "MinHook/include/MinHook.h" //detour x86&x64
-#include <atltime.h>
 
 typedef HRESULT(__stdcall *D3D11PresentHook) (IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT Flags);
 
 D3D11PresentHook phookD3D11Present = NULL;
 
-DWORD_PTR* pSwapChainVtable = NULL;
+typedef ULONG(__stdcall *DXGISwapChainReleaseHook) (IDXGISwapChain* pSwapChain);
+typedef HRESULT(__stdcall *DXGIPresent1Hook) (IDXGISwapChain1* pSwapChain, UINT SyncInterval, UINT PresentFlags, const DXGI_PRESENT_PARAMETERS* pPresentParameters);
+typedef HRESULT(__stdcall *DXGIResizeBuffersHook) (IDXGISwapChain* pSwapChain, UINT BufferCount, UINT Width, UINT Height, DXGI_FORMAT NewFormat, UINT SwapChainFlags);
+typedef HRESULT(__stdcall *DXGIResizeTargetHook) (IDXGISwapChain* pSwapChain, const DXGI_MODE_DESC* pNewTargetParameters);
+typedef HANDLE(__stdcall *DXGIGetFrameLatencyWaitableObjectHook) (IDXGISwapChain2* pSwapChain);
 
-int g_nFPS = 0;
+DXGISwapChainReleaseHook phookDXGISwapChainRelease = NULL;
+DXGIPresent1Hook phookDXGIPresent1 = NULL;
+DXGIResizeBuffersHook phookDXGIResizeBuffers = NULL;
+DXGIResizeTargetHook phookDXGIResizeTarget = NULL;
+DXGIGetFrameLatencyWaitableObjectHook phookDXGIGetFrameLatencyWaitableObject = NULL;
 
-class AnimFrameCounter
-{
-public:
-    AnimFrameCounter()
-    {
-        m_pfFrequency = 1.f;
-        m_lastTick.QuadPart = 0xffffffffffffffff;
-        m_fpsCounter = 0;
-        LARGE_INTEGER pff;
-        QueryPerformanceFrequency(&pff);
-        setFrequency((float)pff.QuadPart);
-    }
-    void setFrequency(float bf) { m_pfFrequency = bf; }
-    void onFrameStart()
-    {
-        LARGE_INTEGER pfc;
-        QueryPerformanceCounter(&pfc);
-        if(m_lastTick.QuadPart == 0xffffffffffffffff)
-        {
-            m_lastTick = pfc;
-            m_fpsCounter = 0;
-            return;
-        }
-        m_fpsCounter ++;
-        float intv = (float)(pfc.QuadPart - m_lastTick.QuadPart) / m_pfFrequency;
-        if(intv >= 1.f)
-        {
-            //qDebug() << "FPS: " << m_fpsCounter;
-            g_nFPS = m_fpsCounter;
-            m_lastTick = pfc;
-            m_fpsCounter = 0;
-        }
-    }
+// non-zero while a Present or Present1 detour runs on this thread, so a runtime or another
+// overlay that forwards one call to the other does not count the frame twice
+static thread_local int g_presentDepth = 0;
 
-protected:
-    float						m_pfFrequency;
-    LARGE_INTEGER				m_lastTick;
-    int						    m_fpsCounter;
-};
+DWORD_PTR* pSwapChainVtable = NULL;
+
+// set by the primary swapchain's thread, read by every presenting thread
+std::atomic<OverlayMode> g_overlayMode(om_fps);
+
+SystemPacingClock               g_pacingClock;
+FramePacer                      g_framePacer(g_pacingClock);
 
-AnimFrameCounter                g_frameCounter;
+// set by InitializeHook, FrameClock calibrates on first use and that must not happen under the loader lock
+uint64_t                        g_tickFrequency = 0;
+// whole-session distribution of the primary swapchain for soak tests, summarised in the log once a minute
+FrameHistogram                  g_sessionHistogram;
+uint64_t                        g_nextSessionReport = 0;
+// display times of the primary swapchain's frames, which hold them back until DXGI reports on them
+DisplayTimeline                 g_displayTimeline;
+IDXGISwapChain*                 g_pDisplaySwapChain = NULL;     /* identity only, no reference held */
+// overlay time spent in the primary swapchain's Present, logged every ten seconds to compare overlay_deferred settings
+uint64_t                        g_overlayTicks = 0;
+uint32_t                        g_overlayFrames = 0;
+uint64_t                        g_nextOverlayReport = 0;
 
 class MyMutex
 {
@@ -116,14 +124,27 @@ public:
         return m_pMyLog;
    }
 
+    void reopen(const char* szLogPath) {
+        MyMutex::instance().lock();
+
+        if (m_f != NULL) {
+            fclose(m_f);
+        }
+        m_f = fopen(szLogPath, "wb");
+
+        MyMutex::instance().unlock();
+    }
+
     void hookLog(const char* str) {
         MyMutex::instance().lock();
 
-        DWORD dwCurrentTid = GetCurrentThreadId();
-        char buf[1024];
-        _snprintf(buf, sizeof(buf), "tid:%d %s\r\n", dwCurrentTid, str);
-        fputs(buf, m_f);
-        fflush(m_f);
+        if (m_f != NULL) {
+            DWORD dwCurrentTid = GetCurrentThreadId();
+            char buf[1024];
+            _snprintf(buf, sizeof(buf), "tid:%d %s\r\n", dwCurrentTid, str);
+            fputs(buf, m_f);
+            fflush(m_f);
+        }
 
         MyMutex::instance().unlock();
    }
@@ -131,34 +152,470 @@ public:
 
 MyLog* MyLog::m_pMyLog = NULL;
 
+HMODULE g_hModule = NULL;
+
+static void onConfigChanged(const OverlayConfig& oldConfig, const OverlayConfig& newConfig)
+{
+    if (oldConfig.logPath != newConfig.logPath) {
+        MyLog::Instance("")->reopen(newConfig.logPath.c_str());
+    }
+}
+
+static void loadConfig()
+{
+    char szPath[MAX_PATH];
+    DWORD len = GetModuleFileNameA(g_hModule, szPath, MAX_PATH);
+    char* pSlash = strrchr(szPath, '\\');
+    if (len == 0 || len >= MAX_PATH || pSlash == NULL) {
+        return;
+    }
+    strcpy(pSlash + 1, "d3d11hook.ini");
+    ConfigManager::instance().load(szPath);
+}
+
 //==========================================================================================================================
 
-static void ShowFPS(IDXGISwapChain* pSwapChain)
+// applies requests from the control channel; runs on the render thread once per Present
+static void drainControlCommands(const OverlayConfig& cfg)
+{
+    ControlCommand cmd;
+    while (ControlServer::instance().popCommand(cmd)) {
+        switch (cmd.type) {
+        case cc_capture_start:
+            FrameCapture::instance().start(cmd.arg[0] ? cmd.arg : cfg.capturePath.c_str());
+            break;
+        case cc_capture_stop:
+            FrameCapture::instance().stop();
+            break;
+        case cc_overlay_mode:
+            g_overlayMode.store((OverlayMode)cmd.value, std::memory_order_relaxed);
+            break;
+        case cc_benchmark_start:
+            if (!BenchmarkController::instance().arm(cmd.bench, cmd.arg, cfg.capturePath.c_str())) {
+                MyLog::Instance("")->hookLog("benchmark rejected: a capture or benchmark is already running");
+            }
+            break;
+        case cc_benchmark_cancel:
+            BenchmarkController::instance().cancel();
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+// a label right of each overlay row, all of them in one draw; the layouts are cached across frames
+static void drawLabels(IDXGISwapChain* pSwapChain, SwapChainStats& stats, const char* const* labels, int count, float x, float y, const OverlayConfig& cfg)
+{
+    DrawNumberTool& tool = DrawNumberTool::instance();
+    tool.layoutLabels(stats.text, labels, count, x, y, cfg);
+    tool.drawText(pSwapChain, stats.text, stats.textBuffers, (float)stats.width, (float)stats.height);
+}
+
+// the rows of the overlay: the numbers blitted from the swapchain's cached HUD with the labels drawn over them,
+// or with composition off kept as widgets, of which only a row whose value changed is uploaded again
+static void drawHud(IDXGISwapChain* pSwapChain, SwapChainStats& stats, const OverlayFrame& frame, const OverlayConfig& cfg)
+{
+    DrawNumberTool& tool = DrawNumberTool::instance();
+    if (cfg.overlayCompose) {
+        tool.composeNumbers(pSwapChain, stats.hud, frame.numbers, frame.count, frame.x, frame.y, (float)stats.width, (float)stats.height, cfg);
+        if (frame.labels) {
+            drawLabels(pSwapChain, stats, frame.labels, frame.count, frame.x, frame.y, cfg);
+        }
+    }
+    else {
+        tool.layoutWidgets(stats.widgets, frame.numbers, frame.labels, frame.count, frame.x, frame.y, cfg);
+        tool.drawWidgets(pSwapChain, stats.widgets, stats.widgetBuffers, (float)stats.width, (float)stats.height);
+    }
+}
+
+static void reportOverlayCost(uint64_t ticks, const OverlayConfig& cfg)
+{
+    g_overlayTicks += ticks;
+    g_overlayFrames++;
+    uint64_t now = FrameClock::instance().now();
+    if (g_nextOverlayReport == 0) {
+        g_nextOverlayReport = now + 10 * g_tickFrequency;
+        return;
+    }
+    if ((int64_t)(now - g_nextOverlayReport) < 0) {
+        return;
+    }
+    g_nextOverlayReport = now + 10 * g_tickFrequency;
+    double presentUs = (double)FrameClock::instance().toNs(g_overlayTicks) / 1000.0 / g_overlayFrames;
+    g_overlayTicks = 0;
+    g_overlayFrames = 0;
+    char szLog[160];
+    double recordUs;
+    bool driverCommandLists;
+    if (OverlayRecorder::instance().takeRecordCost(recordUs, driverCommandLists) && cfg.overlayDeferred) {
+        _snprintf(szLog, sizeof(szLog), "overlay: deferred, %.1f us per frame in Present, %.1f us recording on the worker, driver command lists %s",
+            presentUs, recordUs, driverCommandLists ? "yes" : "no (emulated by the runtime)");
+    }
+    else {
+        _snprintf(szLog, sizeof(szLog), "overlay: %s, %.1f us per frame in Present", cfg.overlayDeferred ? "deferred" : "immediate", presentUs);
+    }
+    szLog[sizeof(szLog) - 1] = 0;
+    MyLog::Instance("")->hookLog(szLog);
+}
+
+// draws the frame's overlay, or with overlay_deferred executes the list recorded for an earlier frame and hands this one over
+static void drawOverlay(IDXGISwapChain* pSwapChain, SwapChainStats& stats, OverlayFrame& frame, const OverlayConfig& cfg, int configPin, bool primary)
+{
+    uint64_t start = FrameClock::instance().now();
+    if (cfg.overlayDeferred) {
+        frame.width = (float)stats.width;
+        frame.height = (float)stats.height;
+        frame.cfg = &cfg;
+        frame.cfgPin = configPin;
+        if (frame.graph) {
+            memcpy(frame.frameUs, stats.frameUs, sizeof(frame.frameUs));
+            frame.frameCount = stats.frameCount;
+        }
+        OverlayRecorder::instance().submit(pSwapChain, stats.deferred, frame);
+    }
+    else {
+        if (stats.deferred.submitted) {
+            stats.deferred.release();
+        }
+        drawHud(pSwapChain, stats, frame, cfg);
+        if (frame.graph) {
+            DrawNumberTool& tool = DrawNumberTool::instance();
+            tool.drawGraph(pSwapChain, stats.graph, stats.frameUs, SwapChainStats::ring_size, stats.frameCount,
+                frame.x, frame.y + tool.numberHeight(), (float)stats.width, (float)stats.height, cfg);
+        }
+    }
+    if (primary) {
+        reportOverlayCost(FrameClock::instance().now() - start, cfg);
+    }
+}
+
+// configPin holds the snapshot current() returns for the whole call
+static void ShowFPS(IDXGISwapChain* pSwapChain, SwapChainStats& stats, int configPin, bool primary)
 {
-    g_frameCounter.onFrameStart();
+    const OverlayConfig& cfg = ConfigManager::instance().current();
 
-    CString strFps;
-    strFps.Format(_T("fps: %d "), g_nFPS);
+    // commands, captures and benchmarks belong to the primary swapchain's thread
+    if (primary) {
+        drainControlCommands(cfg);
+        FrameCapture::instance().setCsvExport(cfg.captureCsv);
 
-    CTime tm = CTime::GetCurrentTime();
-    
-    //CString strTm = tm.Format(_T("%Y-%m-%d"));
-    CString strTm;
-    strTm.Format("time: %d:%d:%d", tm.GetHour(), tm.GetMinute(), tm.GetSecond());
+        static bool s_autoBenchmarkDone = false;
+        if (!s_autoBenchmarkDone && !cfg.benchmarkAuto.empty()) {
+            s_autoBenchmarkDone = true;
+            BenchmarkRequest req;
+            char label[CONTROL_ARG_SIZE];
+            const char* error = nullptr;
+            if (ControlProtocol::parseBenchmark(cfg.benchmarkAuto.c_str(), req, label, sizeof(label), error)) {
+                BenchmarkController::instance().arm(req, label, cfg.capturePath.c_str());
+            }
+        }
+    }
 
-    CString strLog =  strFps + strTm;
+    if (stats.frameCounter.onFrameStart()) {
+        stats.pushTelemetry();
+        SwapChainRegistry::instance().updatePrimary(pSwapChain, stats);
+        // what the control channel's "telemetry" answers, once a second
+        if (SwapChainRegistry::instance().isPrimary(pSwapChain)) {
+            TelemetrySample samples[SwapChainStats::telemetry_size];
+            ControlServer::instance().publishTelemetry(samples, stats.copyTelemetry(samples));
+        }
+    }
+    int fps = stats.frameCounter.fps();
+
+    // formatted by hand, this runs every frame and must not allocate
+    SYSTEMTIME tm;
+    GetLocalTime(&tm);
+    char szLog[64];
+    char* p = szLog;
+    if (SwapChainRegistry::instance().activeCount() > 1) {
+        p = appendString(p, "swapchain ");
+        p = appendUInt(p, stats.id);
+        *p++ = ' ';
+    }
+    p = appendString(p, "fps: ");
+    p = appendInt(p, fps);
+    p = appendString(p, " time: ");
+    p = appendUInt(p, tm.wHour);
+    *p++ = ':';
+    p = appendUInt(p, tm.wMinute);
+    *p++ = ':';
+    p = appendUInt(p, tm.wSecond);
+    *p = 0;
 
     MyLog* pLog = MyLog::Instance("");
 
-    pLog->hookLog((const char*)((LPSTR)(LPCTSTR)strLog));
+    pLog->hookLog(szLog);
+
+    OverlayFrame frame;
+    frame.numbers[0] = fps;
+    frame.count = 1;
+    frame.labels = NULL;
+    frame.graph = false;
+    stats.placeOverlay(cfg, frame.x, frame.y);
+    OverlayMode mode = g_overlayMode.load(std::memory_order_relaxed);
+    if (mode == om_detailed) {
+        // the last hitch stays on screen for three seconds
+        bool recentHitch = stats.lastHitchTick && FrameClock::instance().now() - stats.lastHitchTick < 3 * g_tickFrequency;
+        frame.numbers[1] = stats.frameCounter.maxFrameMs();
+        frame.numbers[2] = recentHitch ? stats.lastHitchMs : 0;
+        frame.count = 3;
+        static const char* const labels[] = { "fps", "max ms", "hitch ms" };
+        frame.labels = labels;
+    }
+    else if (mode == om_percentiles) {
+        const AnimFrameCounter& counter = stats.frameCounter;
+        frame.numbers[1] = (int)((counter.p50Us() + 500) / 1000);
+        frame.numbers[2] = (int)((counter.p95Us() + 500) / 1000);
+        frame.numbers[3] = (int)((counter.p99Us() + 500) / 1000);
+        frame.count = 4;
+        static const char* const labels[] = { "fps", "p50 ms", "p95 ms", "p99 ms" };
+        frame.labels = labels;
+    }
+    else if (mode == om_graph) {
+        frame.graph = true;
+    }
+    else if (mode != om_fps) {
+        if (stats.deferred.submitted) {
+            stats.deferred.release();
+        }
+        return;
+    }
+    drawOverlay(pSwapChain, stats, frame, cfg, configPin, primary);
+}
+
+// holds the frame until the fps_limit slot; runs after the overlay so its cost is part of the frame
+static void limitFrameRate()
+{
+    g_framePacer.setTargetFps(ConfigManager::instance().current().fpsLimit);
+    g_framePacer.wait();
+
+    PacerReport report;
+    if (g_framePacer.takeReport(report)) {
+        char szLog[160];
+        _snprintf(szLog, sizeof(szLog), "limiter: %d fps, lateness avg %.1f us max %.1f us, spin %.1f us, resyncs %llu",
+            g_framePacer.targetFps(), report.avgLatenessUs, report.maxLatenessUs, report.sleepSlackUs, (unsigned long long)report.resyncs);
+        szLog[sizeof(szLog) - 1] = 0;
+        MyLog::Instance("")->hookLog(szLog);
+    }
+}
+
+static uint16_t saturate16(uint64_t value)
+{
+    return value > 0xffff ? 0xffff : (uint16_t)value;
+}
+
+// fills the event fields of the frame that ends with this Present and logs hitches with their context;
+// device activity and the capture backlog are process wide and only reported on the primary swapchain
+static void classifyFrame(SwapChainStats& stats, FrameRecord& rec, bool primary)
+{
+    uint32_t resources = 0, shaders = 0;
+    if (primary) {
+        DeviceActivity::instance().takeCounts(resources, shaders);
+    }
+    rec.resourcesCreated = saturate16(resources);
+    rec.shadersCreated = saturate16(shaders);
+    rec.captureBacklog = primary ? saturate16((uint64_t)FrameCapture::instance().backlog()) : 0;
+    rec.events = 0;
+    // the frame spans the previous Present call to this one, so it contains the previous Present's blocking
+    uint64_t frameTicks = rec.presentStart - stats.lastPresentStart;
+    if (stats.lastPresentStart) {
+        rec.events = (uint16_t)stats.detector.onFrame(frameTicks, stats.lastPresentBlocked);
+        stats.pushFrame(frameTicks);
+        if (primary) {
+            g_sessionHistogram.recordTicks(frameTicks, g_tickFrequency);
+        }
+    }
+    uint64_t blockedTicks = stats.lastPresentBlocked;
+    stats.lastPresentStart = rec.presentStart;
+    stats.lastPresentBlocked = rec.presentEnd - rec.presentStart;
+    if (rec.events == 0) {
+        return;
+    }
+
+    double msPerTick = 1000.0 / (double)g_tickFrequency;
+    double frameMs = (double)frameTicks * msPerTick;
+    if (rec.events & fe_hitch) {
+        stats.lastHitchMs = (int)(frameMs + 0.5);
+        stats.lastHitchTick = rec.presentStart;
+    }
+    char szLog[256];
+    _snprintf(szLog, sizeof(szLog), "swapchain %u %s %.1f ms (median %.1f ms, baseline %.1f ms)%s, blocked %.1f ms, created %u resources %u shaders, capture backlog %u",
+        stats.id, (rec.events & fe_hitch) ? "hitch" : "level shift", frameMs, stats.detector.medianMs(), stats.detector.baselineMs(),
+        (rec.events & fe_present_bound) ? " present bound" : "", (double)blockedTicks * msPerTick,
+        (unsigned)rec.resourcesCreated, (unsigned)rec.shadersCreated, (unsigned)rec.captureBacklog);
+    szLog[sizeof(szLog) - 1] = 0;
+    MyLog::Instance("")->hookLog(szLog);
+}
+
+static void reportSession(uint64_t now)
+{
+    if (g_nextSessionReport == 0) {
+        g_nextSessionReport = now + 60 * g_tickFrequency;
+        return;
+    }
+    if ((int64_t)(now - g_nextSessionReport) < 0) {
+        return;
+    }
+    g_nextSessionReport = now + 60 * g_tickFrequency;
+    char szLog[160];
+    _snprintf(szLog, sizeof(szLog), "session: %llu frames, p50 %.2f ms, p99 %.2f ms, p99.9 %.2f ms, max %.2f ms, %llu not displayed",
+        (unsigned long long)g_sessionHistogram.count(), g_sessionHistogram.percentile(50.0) / 1e6,
+        g_sessionHistogram.percentile(99.0) / 1e6, g_sessionHistogram.percentile(99.9) / 1e6, g_sessionHistogram.maxValue() / 1e6,
+        (unsigned long long)g_displayTimeline.droppedCount());
+    szLog[sizeof(szLog) - 1] = 0;
+    MyLog::Instance("")->hookLog(szLog);
+}
+
+static void emitFrame(const FrameRecord& rec)
+{
+    if (!BenchmarkController::instance().onFrame(rec) && FrameCapture::instance().isActive()) {
+        FrameCapture::instance().record(rec);
+    }
+}
+
+// polls the frame statistics once after the real Present and passes on the frames whose display time is now known
+static void recordDisplay(IDXGISwapChain* pSwapChain, const FrameRecord& rec)
+{
+    FrameRecord settled;
+    if (pSwapChain != g_pDisplaySwapChain) {
+        // present counts are per swapchain, the frames of the previous primary cannot be resolved any more
+        g_displayTimeline.flush();
+        while (g_displayTimeline.pop(settled)) {
+            emitFrame(settled);
+        }
+        g_displayTimeline.reset();
+        g_pDisplaySwapChain = pSwapChain;
+    }
+    UINT presentId = 0;
+    if (FAILED(pSwapChain->GetLastPresentCount(&presentId))) {
+        presentId = 0;
+    }
+    // fails with DXGI_ERROR_FRAME_STATISTICS_DISJOINT after mode changes, and always for windowed blt model swapchains
+    DXGI_FRAME_STATISTICS stats;
+    DisplayStatsSample sample;
+    bool valid = SUCCEEDED(pSwapChain->GetFrameStatistics(&stats)) && stats.SyncQPCTime.QuadPart != 0;
+    if (valid) {
+        sample.presentCount = stats.PresentCount;
+        sample.presentRefreshCount = stats.PresentRefreshCount;
+        sample.syncRefreshCount = stats.SyncRefreshCount;
+        sample.syncTime = FrameClock::instance().fromOsTimestamp((uint64_t)stats.SyncQPCTime.QuadPart);
+    }
+    g_displayTimeline.onPresent(rec, presentId, valid ? &sample : NULL);
+    while (g_displayTimeline.pop(settled)) {
+        emitFrame(settled);
+    }
+}
+
+static HRESULT callPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT Flags, const DXGI_PRESENT_PARAMETERS* pParameters, bool present1)
+{
+    if (present1) {
+        return phookDXGIPresent1(static_cast<IDXGISwapChain1*>(pSwapChain), SyncInterval, Flags, pParameters);
+    }
+    return phookD3D11Present(pSwapChain, SyncInterval, Flags);
+}
 
-    DrawNumberTool::instance().drawNumber(pSwapChain, g_nFPS);
+// shared by Present and Present1: overlay, pacing, timing and capture around the real call
+static HRESULT presentFrame(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT Flags, const DXGI_PRESENT_PARAMETERS* pParameters, bool present1)
+{
+    // DXGI_PRESENT_TEST only checks occlusion, no frame is shown
+    if (g_presentDepth > 0 || (Flags & DXGI_PRESENT_TEST)) {
+        return callPresent(pSwapChain, SyncInterval, Flags, pParameters, present1);
+    }
+    SwapChainRegistry& registry = SwapChainRegistry::instance();
+    SwapChainStats* pStats = registry.acquire(pSwapChain);
+    if (pStats == NULL) {
+        return callPresent(pSwapChain, SyncInterval, Flags, pParameters, present1);
+    }
+    g_presentDepth ++;
+    // process wide work follows one swapchain, so a second window does not double pace or mix captures;
+    // held to the end of the frame, so a takeover meanwhile never has two threads in that state
+    bool primary = registry.beginPrimaryFrame(pSwapChain);
+    // settings read during the frame stay valid through a reload until here is unpinned
+    int configPin = ConfigManager::instance().pin();
+    // scratch the overlay allocated on this thread two frames ago is reused from here
+    FrameArena::current().beginFrame();
+    DeviceActivity::instance().beginOverlay();
+	ShowFPS(pSwapChain, *pStats, configPin, primary);
+    DeviceActivity::instance().endOverlay();
+    if (primary) {
+        limitFrameRate();
+    }
+    // timestamps bracket the real Present only, so the overlay cost is not counted as blocked time
+    FrameRecord rec;
+    rec.presentStart = FrameClock::instance().now();
+    HRESULT hr = callPresent(pSwapChain, SyncInterval, Flags, pParameters, present1);
+    rec.presentEnd = FrameClock::instance().now();
+    rec.syncInterval = SyncInterval;
+    rec.presentFlags = Flags;
+    classifyFrame(*pStats, rec, primary);
+    if (primary) {
+        reportSession(rec.presentStart);
+        recordDisplay(pSwapChain, rec);
+        LatencyControl::instance().afterPresent(pSwapChain, ConfigManager::instance().current().latencyMode, rec);
+    }
+    if (primary) {
+        registry.endPrimaryFrame();
+    }
+    ConfigManager::instance().unpin(configPin);
+    g_presentDepth --;
+    return hr;
 }
 
 HRESULT __stdcall hookD3D11Present(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT Flags)
 {
-	ShowFPS(pSwapChain);
-	return phookD3D11Present(pSwapChain, SyncInterval, Flags);
+    return presentFrame(pSwapChain, SyncInterval, Flags, NULL, false);
+}
+
+HRESULT __stdcall hookDXGIPresent1(IDXGISwapChain1* pSwapChain, UINT SyncInterval, UINT PresentFlags, const DXGI_PRESENT_PARAMETERS* pPresentParameters)
+{
+    return presentFrame(pSwapChain, SyncInterval, PresentFlags, pPresentParameters, true);
+}
+
+// only a recorded overlay list not executed yet references the back buffer, it is dropped first;
+// the cached size is refreshed here once instead of being queried on every Present
+HRESULT __stdcall hookDXGIResizeBuffers(IDXGISwapChain* pSwapChain, UINT BufferCount, UINT Width, UINT Height, DXGI_FORMAT NewFormat, UINT SwapChainFlags)
+{
+    SwapChainStats* pStats = SwapChainRegistry::instance().find(pSwapChain);
+    if (pStats && pStats->deferred.submitted) {
+        pStats->deferred.release();
+    }
+    HRESULT hr = phookDXGIResizeBuffers(pSwapChain, BufferCount, Width, Height, NewFormat, SwapChainFlags);
+    if (SUCCEEDED(hr)) {
+        SwapChainRegistry::instance().onResize(pSwapChain);
+    }
+    return hr;
+}
+
+HRESULT __stdcall hookDXGIResizeTarget(IDXGISwapChain* pSwapChain, const DXGI_MODE_DESC* pNewTargetParameters)
+{
+    HRESULT hr = phookDXGIResizeTarget(pSwapChain, pNewTargetParameters);
+    if (SUCCEEDED(hr)) {
+        SwapChainRegistry::instance().onResize(pSwapChain);
+    }
+    return hr;
+}
+
+// drops the stats of a swapchain before its last reference goes, so the overlay recorder is done with it
+// and a new swapchain at the same address starts clean
+ULONG __stdcall hookDXGISwapChainRelease(IDXGISwapChain* pSwapChain)
+{
+    if (SwapChainRegistry::instance().find(pSwapChain)) {
+        // the count without taking a reference of our own, 1 when this call releases the last one
+        pSwapChain->AddRef();
+        if (phookDXGISwapChainRelease(pSwapChain) == 1) {
+            SwapChainRegistry::instance().remove(pSwapChain);
+            LatencyControl::instance().forgetSwapChain(pSwapChain);
+        }
+    }
+    return phookDXGISwapChainRelease(pSwapChain);
+}
+
+// a game that asks for the waitable object waits on it itself, so the latency mode must not take its signals
+HANDLE __stdcall hookDXGIGetFrameLatencyWaitableObject(IDXGISwapChain2* pSwapChain)
+{
+    LatencyControl::instance().onWaitableRequested(pSwapChain);
+    return phookDXGIGetFrameLatencyWaitableObject(pSwapChain);
 }
 
 static void errorMsg(const wchar_t* lpcsMsg)
@@ -178,6 +635,19 @@ DWORD __stdcall InitializeHook(LPVOID)
 	} while (!hDXGIDLL);
 	Sleep(100);
 
+    loadConfig();
+    // read before the watcher runs, so nothing can be reloaded and reclaimed under them
+    MyLog::Instance((char*)ConfigManager::instance().current().logPath.c_str());
+    ControlServer::instance().start(ConfigManager::instance().current().controlPipe.c_str());
+    ConfigManager::instance().startWatching(onConfigChanged);
+
+    g_tickFrequency = FrameClock::instance().frequency();
+    char szClock[64];
+    _snprintf(szClock, sizeof(szClock), "clock: %s, %.3f MHz", FrameClock::instance().backendName(),
+        (double)FrameClock::instance().frequency() / 1e6);
+    szClock[sizeof(szClock) - 1] = 0;
+    MyLog::Instance("")->hookLog(szClock);
+
     IDXGISwapChain* pSwapChain;
 
 	WNDCLASSEXA wc = { sizeof(WNDCLASSEX), CS_CLASSDC, DXGIMsgProc, 0L, 0L, GetModuleHandleA(NULL), NULL, NULL, NULL, NULL, "DX", NULL };
@@ -255,6 +725,46 @@ DWORD __stdcall InitializeHook(LPVOID)
     DWORD dwOld;
     VirtualProtect(phookD3D11Present, 2, PAGE_EXECUTE_READWRITE, &dwOld);
 
+    // without it a destroyed swapchain keeps its slot until the process exits
+    if (MH_CreateHook((DWORD_PTR*)pSwapChainVtable[2], hookDXGISwapChainRelease, reinterpret_cast<void**>(&phookDXGISwapChainRelease)) != MH_OK ||
+        MH_EnableHook((DWORD_PTR*)pSwapChainVtable[2]) != MH_OK) {
+        MyLog::Instance("")->hookLog("swapchain release hook failed, per-swapchain stats are not freed");
+    }
+    if (MH_CreateHook((DWORD_PTR*)pSwapChainVtable[13], hookDXGIResizeBuffers, reinterpret_cast<void**>(&phookDXGIResizeBuffers)) != MH_OK ||
+        MH_EnableHook((DWORD_PTR*)pSwapChainVtable[13]) != MH_OK ||
+        MH_CreateHook((DWORD_PTR*)pSwapChainVtable[14], hookDXGIResizeTarget, reinterpret_cast<void**>(&phookDXGIResizeTarget)) != MH_OK ||
+        MH_EnableHook((DWORD_PTR*)pSwapChainVtable[14]) != MH_OK) {
+        MyLog::Instance("")->hookLog("swapchain resize hooks failed, the overlay keeps the size of the first frame");
+    }
+    // Present1 (index 22) only exists when the runtime implements IDXGISwapChain1
+    IDXGISwapChain1* pSwapChain1 = NULL;
+    if (SUCCEEDED(pSwapChain->QueryInterface(__uuidof(IDXGISwapChain1), (void**)&pSwapChain1))) {
+        DWORD_PTR* pSwapChain1Vtable = (DWORD_PTR*)((DWORD_PTR*)pSwapChain1)[0];
+        if (MH_CreateHook((DWORD_PTR*)pSwapChain1Vtable[22], hookDXGIPresent1, reinterpret_cast<void**>(&phookDXGIPresent1)) != MH_OK ||
+            MH_EnableHook((DWORD_PTR*)pSwapChain1Vtable[22]) != MH_OK) {
+            MyLog::Instance("")->hookLog("present1 hook failed, frames presented with Present1 are not measured");
+        }
+        pSwapChain1->Release();
+    }
+    // GetFrameLatencyWaitableObject (index 33) only exists when the runtime implements IDXGISwapChain2
+    IDXGISwapChain2* pSwapChain2 = NULL;
+    if (SUCCEEDED(pSwapChain->QueryInterface(__uuidof(IDXGISwapChain2), (void**)&pSwapChain2))) {
+        DWORD_PTR* pSwapChain2Vtable = (DWORD_PTR*)((DWORD_PTR*)pSwapChain2)[0];
+        if (MH_CreateHook((DWORD_PTR*)pSwapChain2Vtable[33], hookDXGIGetFrameLatencyWaitableObject,
+                reinterpret_cast<void**>(&phookDXGIGetFrameLatencyWaitableObject)) != MH_OK ||
+            MH_EnableHook((DWORD_PTR*)pSwapChain2Vtable[33]) != MH_OK) {
+            MyLog::Instance("")->hookLog("waitable object hook failed, the latency mode leaves every waitable swapchain to the game");
+        } else {
+            LatencyControl::instance().setWaitableHooked();
+        }
+        pSwapChain2->Release();
+    }
+
+    // only feeds the context of stutter events, so the overlay works without it
+    if (!DeviceActivity::instance().install(pDevice)) {
+        MyLog::Instance("")->hookLog("device activity hooks failed, stutter events will not report resource creation");
+    }
+
 	pDevice->Release();
 	pContext->Release();
 	pSwapChain->Release();
@@ -270,13 +780,23 @@ BOOL __stdcall DllMain(HINSTANCE hModule, DWORD dwReason, LPVOID lpReserved)
 	{
 	case DLL_PROCESS_ATTACH: // A process is loading the DLL.
 		DisableThreadLibraryCalls(hModule);
+        g_hModule = hModule;
 		CreateThread(NULL, 0, InitializeHook, NULL, 0, NULL);
-        MyLog::Instance("C:\\Users\\Administrator\\Desktop\\fpslog.txt");
 		break;
 
 	case DLL_PROCESS_DETACH: // A process unloads the DLL.
 		if (MH_Uninitialize() != MH_OK) { return 1; }
 		if (MH_DisableHook((DWORD_PTR*)pSwapChainVtable[8]) != MH_OK) { return 1; }
+		MH_DisableHook((DWORD_PTR*)pSwapChainVtable[2]);
+		MH_DisableHook((DWORD_PTR*)pSwapChainVtable[13]);
+		MH_DisableHook((DWORD_PTR*)pSwapChainVtable[14]);
+		MH_DisableHook((DWORD_PTR*)pSwapChainVtable[22]);
+		MH_DisableHook((DWORD_PTR*)pSwapChainVtable[33]);
+        ConfigManager::instance().stopWatching();
+        ControlServer::instance().stop();
+        FrameCapture::instance().shutdown();
+        BenchmarkController::instance().shutdown();
+        OverlayRecorder::instance().shutdown();
         delete MyLog::Instance("");
 		break;
 	}